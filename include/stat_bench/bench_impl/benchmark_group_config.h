@@ -26,6 +26,7 @@
 #include "stat_bench/measurement_config.h"
 #include "stat_bench/measurer/generate_default_measurement_configs.h"
 #include "stat_bench/measurer/measurement_type.h"
+#include "stat_bench/param/parameter_name.h"
 #include "stat_bench/plots/i_plot.h"
 #include "stat_bench/util/ordered_map.h"
 
@@ -62,6 +63,15 @@ public:
      */
     void clear_measurement_configs() noexcept { measurement_configs_.clear(); }
 
+    /*!
+     * \brief Add a parameter used to fit models of asymptotic complexity.
+     *
+     * \param[in] parameter_name Parameter name.
+     */
+    void add_complexity_parameter(param::ParameterName parameter_name) {
+        complexity_parameters_.push_back(std::move(parameter_name));
+    }
+
     /*!
      * \brief Get the plots in the group.
      *
@@ -82,6 +92,16 @@ public:
         return measurement_configs_;
     }
 
+    /*!
+     * \brief Get the parameters used to fit models of asymptotic complexity.
+     *
+     * \return Parameter names.
+     */
+    [[nodiscard]] auto complexity_parameters() const noexcept
+        -> const std::vector<param::ParameterName>& {
+        return complexity_parameters_;
+    }
+
 private:
     //! Plots only in the group.
     std::vector<std::shared_ptr<plots::IPlot>> plots_;
@@ -89,6 +109,9 @@ private:
     //! Configurations of measurements in the group.
     util::OrderedMap<measurer::MeasurementType, MeasurementConfig>
         measurement_configs_{measurer::generate_default_measurement_configs()};
+
+    //! Parameters used to fit models of asymptotic complexity.
+    std::vector<param::ParameterName> complexity_parameters_{};
 };
 
 }  // namespace stat_bench::bench_impl
@@ -19,10 +19,14 @@
  */
 #pragma once
 
+#include <cstddef>
+
 #include "stat_bench/bench_impl/benchmark_group.h"
 #include "stat_bench/benchmark_group_name.h"
 #include "stat_bench/measurement_config.h"
 #include "stat_bench/plot_options.h"
+#include "stat_bench/plots/density_plot.h"
+#include "stat_bench/plots/histogram_plot.h"
 #include "stat_bench/util/string_view.h"
 
 namespace stat_bench::bench_impl {
@@ -117,6 +121,74 @@ public:
         PlotOptions options = PlotOptions()) noexcept
         -> BenchmarkGroupRegister&;
 
+    /*!
+     * \brief Fit models of asymptotic complexity to mean processing time with
+     * respect to a numeric parameter in each case.
+     *
+     * Models O(1), O(log n), O(n), O(n log n), O(n^2), and O(n^k) with a
+     * fitted exponent are fitted, and the best model is reported to the
+     * console and data files. A line plot of processing time with respect to
+     * the parameter with fitted curves is also added.
+     *
+     * \param[in] parameter_name Parameter name.
+     * \param[in] options Options for the plot.
+     * \return Reference to this object.
+     */
+    auto add_complexity_fit(util::StringView parameter_name,
+        PlotOptions options = PlotOptions().log_parameter(true)) noexcept
+        -> BenchmarkGroupRegister&;
+
+    /*!
+     * \brief Add a line plot of speedups and parallel efficiencies with
+     * respect to numbers of threads to the group.
+     *
+     * Speedups are calculated from aggregate throughput relative to the
+     * measurement with one thread in each case, and curves of the Universal
+     * Scalability Law fitted in each case are drawn together.
+     *
+     * \return Reference to this object.
+     */
+    auto add_thread_scaling_plot() noexcept -> BenchmarkGroupRegister&;
+
+    /*!
+     * \brief Add a plot of durations of samples with respect to numbers of
+     * iterations to the group.
+     *
+     * Lines fitted by ordinary least squares and Theil-Sen estimator are
+     * drawn together. Only measurements added by add_regression_measurement
+     * function are plotted.
+     *
+     * \return Reference to this object.
+     */
+    auto add_iteration_regression_plot() noexcept -> BenchmarkGroupRegister&;
+
+    /*!
+     * \brief Add a histogram of processing time to the group.
+     *
+     * \param[in] num_bins Number of bins.
+     * \param[in] log_bins Whether to use log-spaced bins.
+     * \param[in] num_threads Number of threads to process measurements.
+     * \return Reference to this object.
+     */
+    auto add_histogram_plot(
+        std::size_t num_bins = plots::default_histogram_bins,
+        bool log_bins = true, std::size_t num_threads = 1) noexcept
+        -> BenchmarkGroupRegister&;
+
+    /*!
+     * \brief Add a line plot of probability density of processing time
+     * estimated using Gaussian kernels to the group.
+     *
+     * \param[in] num_points Number of points per trace.
+     * \param[in] log_scale Whether to estimate density in the log scale.
+     * \param[in] num_threads Number of threads to process measurements.
+     * \return Reference to this object.
+     */
+    auto add_density_plot(
+        std::size_t num_points = plots::default_density_points,
+        bool log_scale = true, std::size_t num_threads = 1) noexcept
+        -> BenchmarkGroupRegister&;
+
     /*!
      * \brief Add a measurement configuration to the group.
      *
@@ -126,6 +198,29 @@ public:
     auto add_measurement_config(const MeasurementConfig& config) noexcept
         -> BenchmarkGroupRegister&;
 
+    /*!
+     * \brief Add measurement of processing time with cold CPU caches
+     * ("Cold Processing Time") to the group.
+     *
+     * \note CPU caches are evicted before each sample, and the time to evict
+     * caches is not measured. Benchmarks with multiple threads fail in this
+     * measurement.
+     *
+     * \return Reference to this object.
+     */
+    auto add_cold_cache_measurement() noexcept -> BenchmarkGroupRegister&;
+
+    /*!
+     * \brief Add measurement of processing time estimated by linear
+     * regression ("Regression Processing Time") to the group.
+     *
+     * \note Numbers of iterations increase linearly in samples, and the time
+     * per iteration is estimated by the slope of durations.
+     *
+     * \return Reference to this object.
+     */
+    auto add_regression_measurement() noexcept -> BenchmarkGroupRegister&;
+
     /*!
      * \brief Clear all measurement configurations.
      *
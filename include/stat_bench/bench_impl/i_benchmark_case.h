@@ -50,6 +50,14 @@ public:
      */
     virtual void execute() = 0;
 
+    /*!
+     * \brief Release resources cached across executions of this case.
+     *
+     * \note This is called after executions of all conditions of this case
+     * in a measurement type.
+     */
+    virtual void release_cached_resources() = 0;
+
     IBenchmarkCase(const IBenchmarkCase&) = delete;
     IBenchmarkCase(IBenchmarkCase&&) = delete;
     auto operator=(const IBenchmarkCase&) -> IBenchmarkCase& = delete;
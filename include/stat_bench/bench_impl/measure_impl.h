@@ -15,7 +15,8 @@
  */
 /*!
  * \file
- * \brief Definition of STAT_BENCH_IMPL_MEASURE_IMPL macro.
+ * \brief Definition of STAT_BENCH_IMPL_MEASURE_IMPL and
+ * STAT_BENCH_IMPL_MEASURE_BATCH_IMPL macros.
  */
 #pragma once
 
@@ -56,6 +57,36 @@ private:
     InvocationContext& context_;
 };
 
+/*!
+ * \brief Helper class to measure a function running iterations by itself.
+ */
+class BatchFunctionMeasurer {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] context Context.
+     */
+    explicit BatchFunctionMeasurer(
+        InvocationContext& context = current_invocation_context())
+        : context_(context) {}
+
+    /*!
+     * \brief Measure a function.
+     *
+     * \tparam Func Type of the function.
+     * \param[in] func Function.
+     */
+    template <typename Func>
+    void operator<<(const Func& func) {
+        context_.measure_batch(func);
+    }
+
+private:
+    //! Context.
+    InvocationContext& context_;
+};
+
 }  // namespace stat_bench::impl
 
 /*!
@@ -70,3 +101,16 @@ private:
     ::stat_bench::impl::FunctionMeasurer()                                 \
         << [&](std::size_t THREAD_INDEX_VAR, std::size_t SAMPLE_INDEX_VAR, \
                std::size_t ITERATION_INDEX_VAR)
+
+/*!
+ * \brief Macro to measure a function running iterations by itself.
+ *
+ * \param[in] THREAD_INDEX_VAR Variable name of the index of the thread.
+ * \param[in] SAMPLE_INDEX_VAR Variable name of the index of the sample.
+ * \param[in] ITERATIONS_VAR Variable name of the number of iterations.
+ */
+#define STAT_BENCH_IMPL_MEASURE_BATCH_IMPL(                                \
+    THREAD_INDEX_VAR, SAMPLE_INDEX_VAR, ITERATIONS_VAR)                    \
+    ::stat_bench::impl::BatchFunctionMeasurer()                            \
+        << [&](std::size_t THREAD_INDEX_VAR, std::size_t SAMPLE_INDEX_VAR, \
+               std::size_t ITERATIONS_VAR)
@@ -21,6 +21,7 @@
 
 // IWYU pragma: no_include <version>
 
+#include <cstddef>
 #include <cstdlib>
 #include <exception>
 #include <future>
@@ -90,6 +91,32 @@ auto invoke_and_ignore_return_value(const Func& func, Args&&... args)
 }
 #endif
 
+/*!
+ * \brief Wrapper of functions which run all iterations of a sample in one
+ * call.
+ *
+ * The function is called once per sample with the index of the thread, the
+ * index of the sample, and the number of iterations, and must run the
+ * iterations itself.
+ *
+ * \tparam Func Type of the function.
+ */
+template <typename Func>
+struct BatchFunction {
+    //! Function.
+    const Func& func;
+};
+
+/*!
+ * \brief Function object to prepare no sample.
+ */
+struct NoSamplePreparation {
+    /*!
+     * \brief Prepare a sample. (No operation.)
+     */
+    void operator()(std::size_t /*thread_index*/) const noexcept {}
+};
+
 /*!
  * \brief Class to invoke functions measuring durations in threads if needed.
  */
@@ -102,13 +129,19 @@ public:
      * \param[in] iterations Number of iterations.
      * \param[in] samples Number of samples (including samples for warming up).
      * \param[in] warm_up_samples Number of samples for warming up.
+     * \param[in] linear_iterations Whether to increase the number of
+     * iterations linearly in samples for measurement. If true, the i-th
+     * sample for measurement (zero-based) runs (i + 1) * iterations
+     * iterations, and samples for warming up run iterations iterations.
      */
     ThreadableInvoker(std::size_t num_threads, std::size_t iterations,
-        std::size_t samples, std::size_t warm_up_samples)
+        std::size_t samples, std::size_t warm_up_samples,
+        bool linear_iterations = false)
         : num_threads_(num_threads),
           iterations_(iterations),
           samples_(samples),
-          warm_up_samples_(warm_up_samples) {
+          warm_up_samples_(warm_up_samples),
+          linear_iterations_(linear_iterations) {
         if (num_threads_ == 0) {
             throw StatBenchException("Number of threads must be at least one.");
         }
@@ -137,10 +170,57 @@ public:
      */
     template <typename Func>
     [[nodiscard]] auto measure(const Func& func) const
+        -> std::vector<std::vector<clock::Duration>> {
+        return measure(func, [](std::size_t /*thread_index*/) {
+            // no operation
+        });
+    }
+
+    /*!
+     * \brief Measure time with setup in each thread.
+     *
+     * The setup function is called with the index of the thread in each
+     * thread before synchronization of threads at the start of the
+     * measurement, so memory first touched in the function is allocated near
+     * the thread in NUMA systems, and the time of the setup is not measured.
+     *
+     * \tparam Func Type of function.
+     * \tparam SetupFunc Type of the function to setup each thread.
+     * \param[in] func Function.
+     * \param[in] setup_thread Function to setup each thread.
+     * \return Measured durations per thread.
+     */
+    template <typename Func, typename SetupFunc>
+    [[nodiscard]] auto measure(const Func& func,
+        const SetupFunc& setup_thread) const
+        -> std::vector<std::vector<clock::Duration>> {
+        return measure(func, setup_thread, NoSamplePreparation());
+    }
+
+    /*!
+     * \brief Measure time with setup in each thread and preparation of each
+     * sample.
+     *
+     * The preparation function is called with the index of the thread before
+     * each sample, and the time of the preparation is excluded from the
+     * measured durations (for example, to evict caches).
+     *
+     * \tparam Func Type of function.
+     * \tparam SetupFunc Type of the function to setup each thread.
+     * \tparam PrepareFunc Type of the function to prepare each sample.
+     * \param[in] func Function.
+     * \param[in] setup_thread Function to setup each thread.
+     * \param[in] prepare_sample Function to prepare each sample.
+     * \return Measured durations per thread.
+     */
+    template <typename Func, typename SetupFunc, typename PrepareFunc>
+    [[nodiscard]] auto measure(const Func& func, const SetupFunc& setup_thread,
+        const PrepareFunc& prepare_sample) const
         -> std::vector<std::vector<clock::Duration>> {
         if (num_threads_ == 1) {
+            setup_thread(static_cast<std::size_t>(0));
             return std::vector<std::vector<clock::Duration>>{
-                measure_here(func, 0)};
+                measure_here(func, prepare_sample, 0)};
         }
 
         std::vector<std::promise<std::vector<clock::Duration>>> promises;
@@ -156,10 +236,24 @@ public:
         std::exception_ptr error;
         try {
             for (std::size_t i = 0; i < num_threads_; ++i) {
-                threads.emplace_back([this, &func, i, &promises]() {
-                    barrier_->wait();
-                    measure_here(func, i, promises[i]);
-                });
+                threads.emplace_back(
+                    [this, &func, &setup_thread, &prepare_sample, i,
+                        &promises]() {
+                        // All threads must reach the barrier even when the
+                        // setup fails.
+                        std::exception_ptr setup_error;
+                        try {
+                            setup_thread(i);
+                        } catch (...) {
+                            setup_error = std::current_exception();
+                        }
+                        barrier_->wait();
+                        if (setup_error) {
+                            promises[i].set_exception(setup_error);
+                            return;
+                        }
+                        measure_here(func, prepare_sample, i, promises[i]);
+                    });
             }
         } catch (const std::exception& e) {
             // If thread cannot be created, nothing can be done here.
@@ -180,41 +274,97 @@ public:
     }
 
 private:
+    /*!
+     * \brief Invoke a function for iterations in a sample.
+     *
+     * \tparam Func Type of the function.
+     * \param[in] func Function called for each iteration.
+     * \param[in] thread_index Index of this thread.
+     * \param[in] sample_index Index of the sample.
+     * \param[in] iterations Number of iterations in the sample.
+     */
+    template <typename Func>
+    void invoke_sample(const Func& func, std::size_t thread_index,
+        std::size_t sample_index, std::size_t iterations) const {
+        for (std::size_t iteration_index = 0; iteration_index < iterations;
+            ++iteration_index) {
+            invoke_and_ignore_return_value(
+                func, thread_index, sample_index, iteration_index);
+        }
+    }
+
+    /*!
+     * \brief Invoke a function running all iterations in a sample.
+     *
+     * \tparam Func Type of the function.
+     * \param[in] batch Function called once for the sample.
+     * \param[in] thread_index Index of this thread.
+     * \param[in] sample_index Index of the sample.
+     * \param[in] iterations Number of iterations in the sample.
+     */
+    template <typename Func>
+    void invoke_sample(const BatchFunction<Func>& batch,
+        std::size_t thread_index, std::size_t sample_index,
+        std::size_t iterations) const {
+        invoke_and_ignore_return_value(
+            batch.func, thread_index, sample_index, iterations);
+    }
+
+    /*!
+     * \brief Calculate the number of iterations in a sample.
+     *
+     * \param[in] sample_index Index of the sample (including samples for
+     * warming up).
+     * \return Number of iterations.
+     */
+    [[nodiscard]] auto iterations_of(std::size_t sample_index) const noexcept
+        -> std::size_t {
+        if (!linear_iterations_ || sample_index < warm_up_samples_) {
+            return iterations_;
+        }
+        return (sample_index - warm_up_samples_ + 1U) * iterations_;
+    }
+
     /*!
      * \brief Measure time in the current thread.
      *
      * \tparam Func Type of the function.
+     * \tparam PrepareFunc Type of the function to prepare each sample.
      * \param[in] func Function.
+     * \param[in] prepare_sample Function to prepare each sample.
      * \param[in] thread_index Index of this thread.
      * \return Measured durations.
      */
-    template <typename Func>
+    template <typename Func, typename PrepareFunc>
     [[nodiscard]] auto measure_here(const Func& func,
-        std::size_t thread_index) const -> std::vector<clock::Duration> {
+        const PrepareFunc& prepare_sample, std::size_t thread_index) const
+        -> std::vector<clock::Duration> {
+        constexpr bool prepares_samples =
+            !std::is_same_v<PrepareFunc, NoSamplePreparation>;
         clock::StopWatch watch;
 
         // warming up
         std::size_t sample_index = 0;
         for (; sample_index < warm_up_samples_; ++sample_index) {
-            memory_barrier();
-            for (std::size_t iteration_index = 0; iteration_index < iterations_;
-                ++iteration_index) {
-                invoke_and_ignore_return_value(
-                    func, thread_index, sample_index, iteration_index);
+            if constexpr (prepares_samples) {
+                prepare_sample(thread_index);
             }
             memory_barrier();
+            invoke_sample(func, thread_index, sample_index, iterations_);
+            memory_barrier();
         }
 
         // actual measurement
         watch.start(samples_);
         for (; sample_index < samples_; ++sample_index) {
-            memory_barrier();
-            for (std::size_t iteration_index = 0; iteration_index < iterations_;
-                ++iteration_index) {
-                invoke_and_ignore_return_value(
-                    func, thread_index, sample_index, iteration_index);
+            const std::size_t iterations = iterations_of(sample_index);
+            if constexpr (prepares_samples) {
+                prepare_sample(thread_index);
+                watch.restart_lap();
             }
             memory_barrier();
+            invoke_sample(func, thread_index, sample_index, iterations);
+            memory_barrier();
             watch.lap();
         }
         return watch.calc_durations();
@@ -224,15 +374,19 @@ private:
      * \brief Measure time in the current thread.
      *
      * \tparam Func Type of the function.
+     * \tparam PrepareFunc Type of the function to prepare each sample.
      * \param[in] func Function.
+     * \param[in] prepare_sample Function to prepare each sample.
      * \param[in] thread_index Index of this thread.
      * \param[out] promise Promise object to store the result.
      */
-    template <typename Func>
-    void measure_here(const Func& func, std::size_t thread_index,
+    template <typename Func, typename PrepareFunc>
+    void measure_here(const Func& func, const PrepareFunc& prepare_sample,
+        std::size_t thread_index,
         std::promise<std::vector<clock::Duration>>& promise) const {
         try {
-            promise.set_value(measure_here(func, thread_index));
+            promise.set_value(
+                measure_here(func, prepare_sample, thread_index));
         } catch (...) {
             promise.set_exception(std::current_exception());
         }
@@ -250,6 +404,9 @@ private:
     //! Number of samples for warming up.
     std::size_t warm_up_samples_;
 
+    //! Whether to increase the number of iterations linearly in samples.
+    bool linear_iterations_;
+
     //! Barrier to synchronize threads.
     std::shared_ptr<util::ISyncBarrier> barrier_;
 };
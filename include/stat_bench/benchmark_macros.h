@@ -27,6 +27,7 @@
 #include "stat_bench/bench_impl/measure_impl.h"
 #include "stat_bench/bench_impl/unique_name.h"
 #include "stat_bench/fixture_base.h"  // IWYU pragma: keep
+#include "stat_bench/repeat_unrolled.h"  // IWYU pragma: export
 
 /*!
  * \brief Macro to define and configure a group.
@@ -89,6 +90,30 @@
     STAT_BENCH_MEASURE_INDEXED( \
         /*THREAD_INDEX_VAR*/, /*SAMPLE_INDEX_VAR*/, /*ITERATION_INDEX_VAR*/)
 
+/*!
+ * \brief Macro to measure a function running iterations by itself.
+ *
+ * The function is called once per sample and must run the given number of
+ * iterations, so that overhead of calls per iteration is removed for very
+ * short processes. Statistics are still calculated per iteration.
+ *
+ * \code {.cpp}
+ * STAT_BENCH_MEASURE_BATCH(thread_index, sample_index, iterations) {
+ *     stat_bench::repeat_unrolled<4>(iterations, [&](std::size_t i) {
+ *         return values[i % values.size()] * 2.0;
+ *     });
+ * };
+ * \endcode
+ *
+ * \param[in] THREAD_INDEX_VAR Variable name of the index of the thread.
+ * \param[in] SAMPLE_INDEX_VAR Variable name of the index of the sample.
+ * \param[in] ITERATIONS_VAR Variable name of the number of iterations.
+ */
+#define STAT_BENCH_MEASURE_BATCH(                       \
+    THREAD_INDEX_VAR, SAMPLE_INDEX_VAR, ITERATIONS_VAR) \
+    STAT_BENCH_IMPL_MEASURE_BATCH_IMPL(                 \
+        THREAD_INDEX_VAR, SAMPLE_INDEX_VAR, ITERATIONS_VAR)
+
 /*!
  * \brief Macro of default main function.
  */
@@ -56,15 +56,28 @@ public:
      * \param[in] num_laps Number of laps.
      */
     void start(std::size_t num_laps) {
-        time_points_.clear();
-        time_points_.reserve(num_laps + 1);
-        lap();
+        lap_starts_.clear();
+        lap_starts_.reserve(num_laps);
+        lap_ends_.clear();
+        lap_ends_.reserve(num_laps);
+        current_lap_start_ = MonotoneTimePoint::now();
     }
 
     /*!
      * \brief Measure a time point for a lap.
      */
-    void lap() { time_points_.push_back(MonotoneTimePoint::now()); }
+    void lap() {
+        const auto now = MonotoneTimePoint::now();
+        lap_starts_.push_back(current_lap_start_);
+        lap_ends_.push_back(now);
+        current_lap_start_ = now;
+    }
+
+    /*!
+     * \brief Restart the current lap excluding the time since the last time
+     * point from the lap.
+     */
+    void restart_lap() { current_lap_start_ = MonotoneTimePoint::now(); }
 
     /*!
      * \brief Calculate measured durations.
@@ -72,20 +85,26 @@ public:
      * \return Durations.
      */
     [[nodiscard]] auto calc_durations() const {
-        if (time_points_.size() < 2) {
+        if (lap_ends_.empty()) {
             throw std::runtime_error("Too few number of time points.");
         }
         std::vector<Duration> durations;
-        durations.reserve(time_points_.size() - 1);
-        for (std::size_t i = 0; i < time_points_.size() - 1; ++i) {
-            durations.push_back(time_points_[i + 1] - time_points_[i]);
+        durations.reserve(lap_ends_.size());
+        for (std::size_t i = 0; i < lap_ends_.size(); ++i) {
+            durations.push_back(lap_ends_[i] - lap_starts_[i]);
         }
         return durations;
     }
 
 private:
-    //! Time points.
-    std::vector<MonotoneTimePoint> time_points_{};
+    //! Time points at the start of laps.
+    std::vector<MonotoneTimePoint> lap_starts_{};
+
+    //! Time points at the end of laps.
+    std::vector<MonotoneTimePoint> lap_ends_{};
+
+    //! Time point at the start of the current lap.
+    MonotoneTimePoint current_lap_start_{MonotoneTimePoint::now()};
 };
 
 }  // namespace stat_bench::clock
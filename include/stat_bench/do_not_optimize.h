@@ -15,22 +15,86 @@
  */
 /*!
  * \file
- * \brief Definition of do_not_optimize function.
+ * \brief Definition of do_not_optimize, clobber_memory, and escape functions.
  */
 #pragma once
 
+#include <atomic>
+#include <type_traits>
+
 namespace stat_bench {
 namespace impl {
 
 /*!
  * \brief Use a pointer to prevent deletion of a variable.
  *
+ * \note This is used in compilers without inline assembly.
+ *
  * \param[in] ptr Pointer.
  */
 void use_pointer(void* ptr) noexcept;
 
 }  // namespace impl
 
+#if defined(__GNUC__) || defined(__clang__)
+
+/*!
+ * \brief Prevent compilers to optimize away a value.
+ *
+ * Values small enough for registers are kept in registers, and other values
+ * are kept in memory, without calling functions.
+ *
+ * \warning This won't prevent optimizations in processes to evaluate the value.
+ *
+ * \tparam T Type.
+ * \param[in] val Value.
+ */
+template <typename T>
+inline void do_not_optimize(T&& val) noexcept {
+    using Value = std::remove_reference_t<T>;
+    if constexpr (std::is_const_v<Value>) {
+        // NOLINTNEXTLINE(hicpp-no-assembler)
+        asm volatile("" : : "r,m"(val) : "memory");
+    } else if constexpr (std::is_trivially_copyable_v<Value> &&
+        sizeof(Value) <= sizeof(void*) &&
+        (sizeof(Value) & (sizeof(Value) - 1U)) == 0U) {
+        // GCC accepts register constraints only for sizes of registers, so
+        // aggregates of other sizes (e.g. 3 bytes) are kept in memory.
+#if defined(__clang__)
+        // NOLINTNEXTLINE(hicpp-no-assembler)
+        asm volatile("" : "+r,m"(val) : : "memory");
+#else
+        // NOLINTNEXTLINE(hicpp-no-assembler)
+        asm volatile("" : "+r"(val) : : "memory");
+#endif
+    } else {
+        // NOLINTNEXTLINE(hicpp-no-assembler)
+        asm volatile("" : "+m"(val) : : "memory");
+    }
+}
+
+/*!
+ * \brief Prevent compilers to optimize away writes to memory and to move
+ * accesses to memory beyond this function call.
+ */
+inline void clobber_memory() noexcept {
+    // NOLINTNEXTLINE(hicpp-no-assembler)
+    asm volatile("" : : : "memory");
+}
+
+/*!
+ * \brief Make memory pointed by a pointer visible to an unknown code, so that
+ * compilers cannot optimize away writes to the memory.
+ *
+ * \param[in] ptr Pointer.
+ */
+inline void escape(const volatile void* ptr) noexcept {
+    // NOLINTNEXTLINE(hicpp-no-assembler)
+    asm volatile("" : : "g"(ptr) : "memory");
+}
+
+#else
+
 /*!
  * \brief Prevent compilers to optimize away a value.
  *
@@ -41,7 +105,32 @@ void use_pointer(void* ptr) noexcept;
  */
 template <typename T>
 inline void do_not_optimize(T&& val) noexcept {
-    impl::use_pointer(reinterpret_cast<void*>(&val));
+    // Without inline assembly, the value is passed to a function in another
+    // translation unit.
+    impl::use_pointer(const_cast<void*>(  // NOLINT
+        static_cast<const volatile void*>(&val)));
+    std::atomic_signal_fence(std::memory_order_seq_cst);
 }
 
+/*!
+ * \brief Prevent compilers to optimize away writes to memory and to move
+ * accesses to memory beyond this function call.
+ */
+inline void clobber_memory() noexcept {
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+/*!
+ * \brief Make memory pointed by a pointer visible to an unknown code, so that
+ * compilers cannot optimize away writes to the memory.
+ *
+ * \param[in] ptr Pointer.
+ */
+inline void escape(const volatile void* ptr) noexcept {
+    impl::use_pointer(const_cast<void*>(ptr));  // NOLINT
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+#endif
+
 }  // namespace stat_bench
@@ -20,17 +20,25 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "stat_bench/bench_impl/i_benchmark_case.h"
 #include "stat_bench/current_invocation_context.h"
 #include "stat_bench/invocation_context.h"
+#include "stat_bench/param/auto_num_threads.h"
 #include "stat_bench/param/num_threads_parameter_name.h"
 #include "stat_bench/param/parameter_config.h"
+#include "stat_bench/param/parameter_dict.h"
+#include "stat_bench/param/parameter_generator.h"
 #include "stat_bench/param/parameter_name.h"
+#include "stat_bench/param/parameter_sampling.h"
 #include "stat_bench/param/parameter_value_vector.h"
+#include "stat_bench/util/cpu_topology.h"
 
 namespace stat_bench {
 
@@ -44,6 +52,49 @@ public:
      */
     ///@{
 
+    /*!
+     * \brief Setup once for each condition (combination of parameters)
+     * before the first execution with the condition.
+     *
+     * The state prepared here is kept while the same condition is executed
+     * for determining the number of iterations, warming up, and measurement,
+     * and released by tear_down_once function when the condition changes or
+     * all conditions of the case have been measured in a measurement type.
+     *
+     * \note This can be implemented in fixtures to perform expensive
+     * initialization process such as loading large data.
+     *
+     * \param[in] context Context.
+     */
+    virtual void setup_once(InvocationContext& context) {
+        // no operation in default implementation
+        (void)context;
+    }
+
+    /*!
+     * \brief Tear down the state prepared by setup_once function.
+     *
+     * \note This can be implemented in fixtures to release resources
+     * allocated in setup_once function.
+     */
+    virtual void tear_down_once() {
+        // no operation in default implementation
+    }
+
+    /*!
+     * \brief Reset the state prepared by setup_once function before each
+     * execution.
+     *
+     * \note This can be implemented in fixtures to restore the state modified
+     * in previous executions cheaply. This is called before setup function.
+     *
+     * \param[in] context Context.
+     */
+    virtual void reset(InvocationContext& context) {
+        // no operation in default implementation
+        (void)context;
+    }
+
     /*!
      * \brief Setup before running actual process.
      *
@@ -57,12 +108,38 @@ public:
         (void)context;
     }
 
+    /*!
+     * \brief Setup in each thread before measurement.
+     *
+     * This is called in each thread used in measurement before threads start
+     * measurement together, and the time of this function is not measured.
+     * Data first touched here is allocated near the thread in NUMA systems.
+     * Use stat_bench::InvocationContext::emplace_thread_state to keep data
+     * for the thread, and stat_bench::InvocationContext::thread_state to
+     * access it in measured functions.
+     *
+     * \note This can be implemented in fixtures to initialize data per
+     * thread. This is called concurrently in multiple threads, and called
+     * each time processing time is measured.
+     *
+     * \param[in] context Context.
+     * \param[in] thread_index Index of the thread.
+     */
+    virtual void setup_thread(
+        InvocationContext& context, std::size_t thread_index) {
+        // no operation in default implementation
+        (void)context;
+        (void)thread_index;
+    }
+
     /*!
      * \brief Tear down after running actual process.
      *
      * \note This can be implemented in fixtures to perform common
      * finalization process.
      * \note This will be called even when errors occurred in run function.
+     * \note Buffers allocated by InvocationContext::allocate_buffer function
+     * are released after this function.
      *
      * \param[in] context Context.
      */
@@ -114,6 +191,90 @@ public:
         return add_param<std::size_t>(param::num_threads_parameter_name());
     }
 
+    /*!
+     * \brief Add a parameter of the number of threads with values generated
+     * from the topology of CPUs of the current host.
+     *
+     * Values are 1, powers of two less than the number of physical cores,
+     * the number of physical cores in a socket, the number of all physical
+     * cores, and the number of all logical CPUs.
+     *
+     * \note Command line options --threads and --max_threads override the
+     * values.
+     *
+     * \param[in] annotate_placement Whether to add a parameter
+     * expected_placement ("cores", "cross_socket", "smt", or
+     * "cross_socket+smt") iterated together with the number of threads. The
+     * placement is expected from the number of threads and isn't enforced,
+     * because threads aren't pinned to CPUs.
+     * \return Vector of parameter values.
+     */
+    auto add_auto_threads_param(bool annotate_placement = false)
+        -> std::shared_ptr<param::ParameterValueVector<std::size_t>> {
+        const auto& topology = util::detect_cpu_topology();
+        return params_.set_auto_threads(
+            param::generate_auto_num_threads(topology), topology,
+            annotate_placement);
+    }
+
+    /*!
+     * \brief Iterate parameters together instead of using the Cartesian
+     * product.
+     *
+     * The i-th values of the given parameters are used together, so the
+     * parameters must have the same number of values.
+     *
+     * \param[in] param_names Names of parameters.
+     */
+    void zip_params(std::vector<param::ParameterName> param_names) {
+        params_.zip(std::move(param_names));
+    }
+
+    /*!
+     * \brief Iterate parameters together instead of using the Cartesian
+     * product.
+     *
+     * \param[in] param_names Names of parameters.
+     */
+    void zip_params(const std::vector<std::string>& param_names) {
+        std::vector<param::ParameterName> names;
+        names.reserve(param_names.size());
+        for (const auto& param_name : param_names) {
+            names.emplace_back(param_name);
+        }
+        zip_params(std::move(names));
+    }
+
+    /*!
+     * \brief Add a constraint of parameters.
+     *
+     * Combinations of parameters for which the constraint returns false are
+     * skipped without calling setup function.
+     *
+     * \param[in] constraint Constraint.
+     */
+    void add_param_constraint(param::ParameterConstraint constraint) {
+        params_.add_constraint(std::move(constraint));
+    }
+
+    /*!
+     * \brief Measure a sampled subset of combinations of parameters instead
+     * of all combinations.
+     *
+     * \note Command line options to sample parameters override this setting.
+     *
+     * \param[in] method Method of sampling.
+     * \param[in] max_conditions Maximum number of combinations of
+     * parameters.
+     * \param[in] seed Seed of random numbers.
+     */
+    void sample_params(param::ParameterSamplingMethod method,
+        std::size_t max_conditions,
+        std::uint32_t seed = param::default_parameter_sampling_seed) {
+        params_.set_sampling(
+            param::ParameterSamplingConfig{method, max_conditions, seed});
+    }
+
     ///@}
 
     /*!
@@ -144,14 +305,33 @@ private:
     //! \copydoc stat_bench::bench_impl::IBenchmarkCase::execute
     void execute() final {
         auto& context = current_invocation_context();
+        if (!prepared_params_ || !(*prepared_params_ == context.params())) {
+            release_cached_resources();
+            setup_once(context);
+            prepared_params_ = context.params();
+        }
+        context.set_thread_setup([this, &context](std::size_t thread_index) {
+            setup_thread(context, thread_index);
+        });
+        reset(context);
         setup(context);
         try {
             run();
             tear_down(context);
         } catch (...) {
             tear_down(context);
+            context.release_buffers();
             throw;
         }
+        context.release_buffers();
+    }
+
+    //! \copydoc stat_bench::bench_impl::IBenchmarkCase::release_cached_resources
+    void release_cached_resources() final {
+        if (prepared_params_) {
+            prepared_params_.reset();
+            tear_down_once();
+        }
     }
 
     //! \copydoc stat_bench::bench_impl::IBenchmarkCase::params
@@ -162,6 +342,9 @@ private:
 
     //! Parameters.
     param::ParameterConfig params_{};
+
+    //! Parameters of the condition prepared by setup_once function.
+    std::optional<param::ParameterDict> prepared_params_{};
 };
 
 }  // namespace stat_bench
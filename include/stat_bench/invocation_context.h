@@ -20,8 +20,10 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -29,8 +31,12 @@
 #include "stat_bench/benchmark_condition.h"
 #include "stat_bench/clock/duration.h"
 #include "stat_bench/custom_output_name.h"
+#include "stat_bench/param/parameter_dict.h"
 #include "stat_bench/param/parameter_name.h"
 #include "stat_bench/stat/custom_stat_output.h"
+#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/aligned_buffer.h"
+#include "stat_bench/util/cache_evictor.h"
 
 namespace stat_bench {
 
@@ -52,7 +58,8 @@ public:
         : cond_(std::move(cond)),
           iterations_(iterations),
           samples_(samples),
-          warming_up_samples_(warming_up_samples) {}
+          warming_up_samples_(warming_up_samples),
+          thread_states_(cond_.threads()) {}
 
     InvocationContext(const InvocationContext&) = delete;
     InvocationContext(InvocationContext&&) = delete;
@@ -73,9 +80,21 @@ public:
         return cond_.threads();
     }
 
+    /*!
+     * \brief Get the parameters.
+     *
+     * \return Parameters.
+     */
+    [[nodiscard]] auto params() const noexcept -> const param::ParameterDict& {
+        return cond_.params();
+    }
+
     /*!
      * \brief Get the number of iterations.
      *
+     * \note When the number of iterations increases linearly in samples,
+     * this is the number of iterations in the first sample for measurement.
+     *
      * \return Number of iterations.
      */
     [[nodiscard]] auto iterations() const noexcept -> std::size_t {
@@ -169,17 +188,187 @@ public:
         add_custom_output(CustomOutputName(std::move(name)), value);
     }
 
+    /*!
+     * \brief Allocate a buffer.
+     *
+     * \note Buffers are released after stat_bench::FixtureBase::tear_down.
+     * To keep buffers for multiple executions, use util::AlignedBuffer in
+     * fixtures directly. This function must not be called in multiple threads
+     * at once; use emplace_thread_state to create buffers in each thread.
+     *
+     * \param[in] size Size of the buffer in bytes.
+     * \param[in] options Options of the buffer.
+     * \return Pointer to the beginning of the buffer.
+     */
+    auto allocate_buffer(std::size_t size,
+        const util::BufferOptions& options = util::BufferOptions()) -> void* {
+        return buffers_.emplace_back(size, options).data();
+    }
+
+    /*!
+     * \brief Allocate a buffer of an array.
+     *
+     * \note Elements are not initialized unless pages are touched at
+     * allocation (then filled with zeros).
+     *
+     * \tparam T Type of elements.
+     * \param[in] num_elements Number of elements.
+     * \param[in] options Options of the buffer.
+     * \return Pointer to the beginning of the array.
+     */
+    template <typename T>
+    auto allocate_array(std::size_t num_elements,
+        const util::BufferOptions& options = util::BufferOptions()) -> T* {
+        static_assert(std::is_trivially_default_constructible_v<T> &&
+                std::is_trivially_destructible_v<T>,
+            "Arrays in buffers are supported only for trivial types.");
+        return static_cast<T*>(
+            allocate_buffer(num_elements * sizeof(T), options));
+    }
+
+    /*!
+     * \brief Release buffers allocated by allocate_buffer function.
+     */
+    void release_buffers() noexcept { buffers_.clear(); }
+
+    /*!
+     * \brief Set whether to evict CPU caches before each sample.
+     *
+     * \note This is set from stat_bench::MeasurementConfig::cold_cache.
+     * Measurement with this option throws an exception for conditions with
+     * multiple threads.
+     *
+     * \param[in] value Whether to evict CPU caches.
+     */
+    void set_cold_cache(bool value) noexcept { cold_cache_ = value; }
+
+    /*!
+     * \brief Check whether CPU caches are evicted before each sample.
+     *
+     * \retval true CPU caches are evicted.
+     * \retval false CPU caches are not evicted.
+     */
+    [[nodiscard]] auto cold_cache() const noexcept -> bool {
+        return cold_cache_;
+    }
+
+    /*!
+     * \brief Set whether to increase the number of iterations linearly in
+     * samples.
+     *
+     * \note This is set from stat_bench::MeasurementConfig::linear_iterations.
+     *
+     * \param[in] value Whether to increase the number of iterations linearly.
+     */
+    void set_linear_iterations(bool value) noexcept {
+        linear_iterations_ = value;
+    }
+
+    /*!
+     * \brief Check whether the number of iterations increases linearly in
+     * samples.
+     *
+     * \retval true The i-th sample for measurement (zero-based) runs
+     * (i + 1) * iterations() iterations.
+     * \retval false All samples run iterations() iterations.
+     */
+    [[nodiscard]] auto linear_iterations() const noexcept -> bool {
+        return linear_iterations_;
+    }
+
+    /*!
+     * \brief Add a buffer to flush from CPU caches before each sample.
+     *
+     * \note When no buffer is added, CPU caches are evicted by reading
+     * through a buffer larger than the last level cache instead. Buffers
+     * added are ignored on CPUs other than x86, which cannot flush cache
+     * lines, and caches are evicted in the same way.
+     *
+     * \param[in] data Beginning of the buffer.
+     * \param[in] size Size of the buffer in bytes.
+     */
+    void add_buffer_to_flush(const void* data, std::size_t size) {
+        flushed_regions_.emplace_back(data, size);
+    }
+
+    /*!
+     * \brief Set the function to setup each thread before measurement.
+     *
+     * \note This is set by fixtures to call
+     * stat_bench::FixtureBase::setup_thread.
+     *
+     * \param[in] setup_thread Function called with the index of each thread
+     * in the thread.
+     */
+    void set_thread_setup(std::function<void(std::size_t)> setup_thread) {
+        setup_thread_ = std::move(setup_thread);
+    }
+
+    /*!
+     * \brief Create the state of a thread.
+     *
+     * \note This is expected to be called in
+     * stat_bench::FixtureBase::setup_thread so that the state is allocated in
+     * the thread.
+     *
+     * \tparam T Type of the state.
+     * \tparam Args Types of arguments of the constructor.
+     * \param[in] thread_index Index of the thread.
+     * \param[in] args Arguments of the constructor.
+     * \return State.
+     */
+    template <typename T, typename... Args>
+    auto emplace_thread_state(std::size_t thread_index, Args&&... args)
+        -> T& {
+        auto state = std::make_shared<T>(std::forward<Args>(args)...);
+        T& ref = *state;
+        thread_states_.at(thread_index) = std::move(state);
+        return ref;
+    }
+
+    /*!
+     * \brief Get the state of a thread.
+     *
+     * \tparam T Type of the state. (Must be the same as the type used in
+     * emplace_thread_state function.)
+     * \param[in] thread_index Index of the thread.
+     * \return State.
+     */
+    template <typename T>
+    [[nodiscard]] auto thread_state(std::size_t thread_index) const -> T& {
+        const auto& state = thread_states_.at(thread_index);
+        if (!state) {
+            throw StatBenchException(
+                "State of a thread is requested before creation.");
+        }
+        return *std::static_pointer_cast<T>(state);
+    }
+
     /*!
      * \brief Measure time.
      *
      * \tparam Func Type of function.
-     * \param[in] func Function.
+     * \param[in] func Function called for each iteration with the index of
+     * the thread, the index of the sample, and the index of the iteration.
      */
     template <typename Func>
     void measure(const Func& func) {
-        durations_ = bench_impl::ThreadableInvoker(
-            cond_.threads(), iterations_, samples_, warming_up_samples_)
-                         .measure(func);
+        measure_impl(func);
+    }
+
+    /*!
+     * \brief Measure time of functions running iterations by themselves.
+     *
+     * \note Statistics of durations are calculated per iteration as in
+     * measure function.
+     *
+     * \tparam Func Type of function.
+     * \param[in] func Function called for each sample with the index of the
+     * thread, the index of the sample, and the number of iterations.
+     */
+    template <typename Func>
+    void measure_batch(const Func& func) {
+        measure_impl(bench_impl::BatchFunction<Func>{func});
     }
 
     /*!
@@ -215,6 +404,44 @@ public:
     }
 
 private:
+    /*!
+     * \brief Measure time.
+     *
+     * \tparam Func Type of function passed to bench_impl::ThreadableInvoker.
+     * \param[in] func Function.
+     */
+    template <typename Func>
+    void measure_impl(const Func& func) {
+        const bench_impl::ThreadableInvoker invoker(
+            cond_.threads(), iterations_, samples_, warming_up_samples_,
+            linear_iterations_);
+        const auto setup_thread = [this](std::size_t thread_index) {
+            if (setup_thread_) {
+                setup_thread_(thread_index);
+            }
+        };
+        if (!cold_cache_) {
+            durations_ = invoker.measure(func, setup_thread);
+            return;
+        }
+        if (cond_.threads() > 1U) {
+            // Evicting caches in a thread would evict caches used by the
+            // function measured in other threads.
+            throw StatBenchException(
+                "Caches can be evicted only in measurements with one thread.");
+        }
+        if (flushed_regions_.empty() || !util::can_flush_cache_lines()) {
+            const util::CacheEvictor& evictor =
+                util::shared_streaming_cache_evictor();
+            durations_ = invoker.measure(func, setup_thread,
+                [&evictor](std::size_t /*thread_index*/) { evictor.evict(); });
+            return;
+        }
+        const util::CacheEvictor evictor(flushed_regions_);
+        durations_ = invoker.measure(func, setup_thread,
+            [&evictor](std::size_t /*thread_index*/) { evictor.evict(); });
+    }
+
     //! Condition.
     BenchmarkCondition cond_;
 
@@ -235,6 +462,24 @@ private:
 
     //! Custom outputs without statistics.
     std::vector<std::pair<CustomOutputName, double>> custom_outputs_{};
+
+    //! Function to setup each thread.
+    std::function<void(std::size_t)> setup_thread_{};
+
+    //! States of threads.
+    std::vector<std::shared_ptr<void>> thread_states_;
+
+    //! Buffers.
+    std::vector<util::AlignedBuffer> buffers_{};
+
+    //! Whether to evict CPU caches before each sample.
+    bool cold_cache_{false};
+
+    //! Whether to increase the number of iterations linearly in samples.
+    bool linear_iterations_{false};
+
+    //! Regions of memory to flush from CPU caches.
+    std::vector<util::CacheEvictor::MemoryRegion> flushed_regions_{};
 };
 
 }  // namespace stat_bench
@@ -61,6 +61,22 @@ public:
      */
     auto warming_up_samples(std::size_t value) -> MeasurementConfig&;
 
+    /*!
+     * \brief Set the maximum number of samples for warming up determined by
+     * detection of steady states.
+     *
+     * \note If this is set, samples are run from the start of each
+     * measurement until durations reach a steady state (tested by
+     * stat_bench::stat::detect_steady_state) in trials before the
+     * measurement, instead of running for a fixed duration. The number of
+     * samples set by warming_up_samples function has priority over this.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    auto max_steady_state_warming_up_samples(std::size_t value)
+        -> MeasurementConfig&;
+
     /*!
      * \brief Set the number of iterations.
      *
@@ -69,6 +85,34 @@ public:
      */
     auto iterations(std::size_t value) -> MeasurementConfig&;
 
+    /*!
+     * \brief Set whether to evict CPU caches before each sample.
+     *
+     * \note Time to evict caches is not measured. Only the first iteration
+     * in each sample runs with cold caches, so use one iteration per sample.
+     * Benchmarks with multiple threads fail in this measurement.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    auto cold_cache(bool value) -> MeasurementConfig&;
+
+    /*!
+     * \brief Set whether to increase the number of iterations linearly in
+     * samples.
+     *
+     * \note If true, the i-th sample (zero-based) runs (i + 1) * k iterations
+     * for a base number of iterations k, and the time per iteration is
+     * estimated by linear regression of durations on numbers of iterations.
+     * The number of iterations set in this object is used as k, otherwise k
+     * is determined so that the total time of samples is similar to the case
+     * without this option.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    auto linear_iterations(bool value) -> MeasurementConfig&;
+
     /*!
      * \brief Get the measurement type.
      *
@@ -92,6 +136,15 @@ public:
     [[nodiscard]] auto warming_up_samples() const noexcept
         -> std::optional<std::size_t>;
 
+    /*!
+     * \brief Get the maximum number of samples for warming up determined by
+     * detection of steady states.
+     *
+     * \return Maximum number of samples for warming up.
+     */
+    [[nodiscard]] auto max_steady_state_warming_up_samples() const noexcept
+        -> std::optional<std::size_t>;
+
     /*!
      * \brief Get the number of iterations.
      *
@@ -100,6 +153,21 @@ public:
     [[nodiscard]] auto iterations() const noexcept
         -> std::optional<std::size_t>;
 
+    /*!
+     * \brief Get whether to evict CPU caches before each sample.
+     *
+     * \return Whether to evict CPU caches before each sample.
+     */
+    [[nodiscard]] auto cold_cache() const noexcept -> bool;
+
+    /*!
+     * \brief Get whether to increase the number of iterations linearly in
+     * samples.
+     *
+     * \return Whether to increase the number of iterations linearly.
+     */
+    [[nodiscard]] auto linear_iterations() const noexcept -> bool;
+
 private:
     //! Measurement type.
     measurer::MeasurementType type_;
@@ -110,8 +178,17 @@ private:
     //! Number of samples for warming up.
     std::optional<std::size_t> warming_up_samples_;
 
+    //! Maximum number of samples for warming up determined by steady states.
+    std::optional<std::size_t> max_steady_state_warming_up_samples_;
+
     //! Number of iterations.
     std::optional<std::size_t> iterations_;
+
+    //! Whether to evict CPU caches before each sample.
+    bool cold_cache_{false};
+
+    //! Whether to increase the number of iterations linearly in samples.
+    bool linear_iterations_{false};
 };
 
 }  // namespace stat_bench
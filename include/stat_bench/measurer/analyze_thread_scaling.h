@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of analyze_thread_scaling function.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "stat_bench/benchmark_case_name.h"
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/param/parameter_dict.h"
+#include "stat_bench/stat/scalability_fit.h"
+
+namespace stat_bench::measurer {
+
+/*!
+ * \brief Struct of metrics of scaling with a number of threads.
+ */
+struct ThreadScalingPoint {
+    //! Number of threads.
+    std::size_t num_threads;
+
+    //! Aggregate throughput of all threads. [iterations / s]
+    double throughput;
+
+    //! Speedup relative to one thread.
+    double speedup;
+
+    //! Parallel efficiency. (Speedup divided by the number of threads.)
+    double efficiency;
+};
+
+/*!
+ * \brief Struct of results of analysis of scaling with numbers of threads in a
+ * case.
+ */
+struct CaseThreadScaling {
+    //! Name of the case.
+    BenchmarkCaseName case_name;
+
+    //! Parameters other than the number of threads.
+    param::ParameterDict params;
+
+    //! Metrics in the ascending order of the number of threads.
+    std::vector<ThreadScalingPoint> points;
+
+    //! Result of fitting of Amdahl's law.
+    stat::ScalabilityFitResult amdahl;
+
+    //! Result of fitting of the Universal Scalability Law.
+    stat::ScalabilityFitResult usl;
+};
+
+/*!
+ * \brief Analyze scaling of throughput with numbers of threads in each case.
+ *
+ * Measurements are grouped by cases and parameters other than the number of
+ * threads and the placement of threads. Groups without a measurement with one
+ * thread or without measurements with other numbers of threads are skipped.
+ *
+ * \param[in] measurements Measurements.
+ * \return Results.
+ */
+[[nodiscard]] auto analyze_thread_scaling(
+    const std::vector<std::shared_ptr<const Measurement>>& measurements)
+    -> std::vector<CaseThreadScaling>;
+
+}  // namespace stat_bench::measurer
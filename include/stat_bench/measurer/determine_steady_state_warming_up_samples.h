@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of determine_steady_state_warming_up_samples function.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "stat_bench/bench_impl/i_benchmark_case.h"
+#include "stat_bench/benchmark_condition.h"
+#include "stat_bench/measurer/measurement_type.h"
+
+namespace stat_bench::measurer {
+
+/*!
+ * \brief Determine number of samples for warming up by detection of steady
+ * states.
+ *
+ * Durations are measured from the start of the case without warming up, and
+ * stat::detect_steady_state function is applied. If no steady state is
+ * detected, the number of samples in the trial is doubled up to the sum of
+ * max_warming_up_samples and samples. Trials are measured in the same way as
+ * the measurement itself, so durations in the trials are comparable to those
+ * in the measurement.
+ *
+ * \param[in] bench_case Case.
+ * \param[in] cond Condition.
+ * \param[in] measurement_type Measurement type.
+ * \param[in] iterations Number of iterations.
+ * \param[in] samples Number of samples for measurement.
+ * \param[in] max_warming_up_samples Maximum number of samples for warming up.
+ * \param[in] cold_cache Whether to evict CPU caches before each sample.
+ * \param[in] linear_iterations Whether to increase the number of iterations
+ * linearly in samples. (iterations is used as the number of iterations in the
+ * first sample.)
+ * \return Number of samples for warming up. (max_warming_up_samples if no
+ * steady state is detected.)
+ */
+[[nodiscard]] auto determine_steady_state_warming_up_samples(
+    bench_impl::IBenchmarkCase* bench_case, const BenchmarkCondition& cond,
+    const MeasurementType& measurement_type, std::size_t iterations,
+    std::size_t samples, std::size_t max_warming_up_samples,
+    bool cold_cache = false, bool linear_iterations = false) -> std::size_t;
+
+}  // namespace stat_bench::measurer
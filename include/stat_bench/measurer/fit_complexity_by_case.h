@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of fit_complexity_by_case function.
+ */
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "stat_bench/benchmark_case_name.h"
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/param/parameter_dict.h"
+#include "stat_bench/param/parameter_name.h"
+#include "stat_bench/stat/complexity_fit.h"
+
+namespace stat_bench::measurer {
+
+/*!
+ * \brief Struct of results of fitting of complexity in a case.
+ */
+struct CaseComplexityFit {
+    //! Name of the case.
+    BenchmarkCaseName case_name;
+
+    //! Parameters other than the parameter used in fitting.
+    param::ParameterDict params;
+
+    //! Measurements used in fitting in the ascending order of the parameter.
+    std::vector<std::shared_ptr<const Measurement>> measurements;
+
+    //! Result of fitting.
+    stat::ComplexityFitResult result;
+};
+
+/*!
+ * \brief Fit models of asymptotic complexity to mean processing time with
+ * respect to a numeric parameter in each case.
+ *
+ * Measurements are grouped by cases and parameters other than the given
+ * parameter. Groups without enough measurements, and measurements without
+ * numeric values of the parameter, are skipped.
+ *
+ * \param[in] measurements Measurements.
+ * \param[in] parameter_name Parameter name.
+ * \return Results.
+ */
+[[nodiscard]] auto fit_complexity_by_case(
+    const std::vector<std::shared_ptr<const Measurement>>& measurements,
+    const param::ParameterName& parameter_name)
+    -> std::vector<CaseComplexityFit>;
+
+}  // namespace stat_bench::measurer
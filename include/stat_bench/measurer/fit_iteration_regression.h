@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of fit_iteration_regression function.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/stat/linear_regression.h"
+
+namespace stat_bench::measurer {
+
+/*!
+ * \brief Struct of results of linear regression of durations on numbers of
+ * iterations.
+ */
+struct IterationRegression {
+    //! Number of iterations in each sample.
+    std::vector<double> iterations;
+
+    //! Duration of each sample averaged over threads. [sec]
+    std::vector<double> durations;
+
+    //! Result of ordinary least squares. (Slope is in sec / iteration.)
+    stat::LinearRegressionResult ordinary_least_squares;
+
+    //! Result of Theil-Sen estimator. (Slope is in sec / iteration.)
+    stat::LinearRegressionResult theil_sen;
+};
+
+/*!
+ * \brief Fit lines to durations of samples with linearly increasing numbers
+ * of iterations.
+ *
+ * \param[in] durations Durations of samples in threads. The i-th sample
+ * (zero-based) must have (i + 1) * base_iterations iterations.
+ * \param[in] base_iterations Number of iterations in the first sample.
+ * \return Result.
+ */
+[[nodiscard]] auto fit_iteration_regression(
+    const std::vector<std::vector<clock::Duration>>& durations,
+    std::size_t base_iterations) -> IterationRegression;
+
+/*!
+ * \brief Convert durations of samples with linearly increasing numbers of
+ * iterations to durations of base_iterations iterations.
+ *
+ * \param[in,out] durations Durations of samples in threads. The i-th sample
+ * (zero-based) is divided by (i + 1).
+ */
+void normalize_linear_iteration_durations(
+    std::vector<std::vector<clock::Duration>>& durations);
+
+}  // namespace stat_bench::measurer
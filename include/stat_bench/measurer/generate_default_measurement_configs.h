@@ -15,7 +15,8 @@
  */
 /*!
  * \file
- * \brief Definition of generate_default_measurement_configs function.
+ * \brief Definition of functions to generate built-in measurement
+ * configurations.
  */
 #pragma once
 
@@ -33,4 +34,28 @@ namespace stat_bench::measurer {
 auto generate_default_measurement_configs()
     -> util::OrderedMap<MeasurementType, MeasurementConfig>;
 
+/*!
+ * \brief Generate the configuration of processing time measured with cold
+ * CPU caches.
+ *
+ * \note Caches are evicted before each sample, and each sample has one
+ * iteration, so that this can be compared with "Processing Time" in the
+ * default configurations.
+ *
+ * \return Measurement configuration.
+ */
+auto generate_cold_cache_measurement_config() -> MeasurementConfig;
+
+/*!
+ * \brief Generate the configuration of processing time estimated by linear
+ * regression of durations on numbers of iterations.
+ *
+ * \note Numbers of iterations increase linearly in samples, and the slope of
+ * the regression line is the time per iteration without constant overheads
+ * of samples (for example, reading clocks).
+ *
+ * \return Measurement configuration.
+ */
+auto generate_regression_measurement_config() -> MeasurementConfig;
+
 }  // namespace stat_bench::measurer
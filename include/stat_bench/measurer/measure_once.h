@@ -37,11 +37,15 @@ namespace stat_bench::measurer {
  * \param[in] iterations Number of iterations.
  * \param[in] samples Number of samples (except for warming up).
  * \param[in] warming_up_samples Number of samples for warming up.
+ * \param[in] cold_cache Whether to evict CPU caches before each sample.
+ * \param[in] linear_iterations Whether to increase the number of iterations
+ * linearly in samples. (iterations is used as the number of iterations in the
+ * first sample.)
  * \return Result.
  */
 [[nodiscard]] auto measure_once(bench_impl::IBenchmarkCase* bench_case,
     const BenchmarkCondition& cond, const MeasurementType& measurement_type,
-    std::size_t iterations, std::size_t samples, std::size_t warming_up_samples)
-    -> Measurement;
+    std::size_t iterations, std::size_t samples, std::size_t warming_up_samples,
+    bool cold_cache = false, bool linear_iterations = false) -> Measurement;
 
 }  // namespace stat_bench::measurer
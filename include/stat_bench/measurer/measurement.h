@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -28,9 +29,11 @@
 #include "stat_bench/benchmark_full_name.h"
 #include "stat_bench/clock/duration.h"
 #include "stat_bench/custom_output_name.h"
+#include "stat_bench/measurer/fit_iteration_regression.h"
 #include "stat_bench/measurer/measurement_type.h"
 #include "stat_bench/stat/calc_stat.h"
 #include "stat_bench/stat/custom_stat_output.h"
+#include "stat_bench/stat/drift_diagnostics.h"
 #include "stat_bench/stat/statistics.h"
 
 namespace stat_bench::measurer {
@@ -51,6 +54,10 @@ public:
      * \param[in] durations Measured durations.
      * \param[in] custom_stat_outputs Custom outputs with statistics.
      * \param[in] custom_outputs Custom outputs without statistics.
+     * \param[in] warming_up_samples Number of samples for warming up.
+     * \param[in] iteration_regression Result of linear regression of
+     * durations on numbers of iterations (only when numbers of iterations
+     * increase linearly in samples).
      */
     Measurement(BenchmarkFullName case_info, BenchmarkCondition cond,
         MeasurementType measurement_type, std::size_t iterations,
@@ -58,16 +65,23 @@ public:
         std::vector<std::vector<clock::Duration>> durations,
         std::vector<std::shared_ptr<stat::CustomStatOutput>>
             custom_stat_outputs,
-        std::vector<std::pair<CustomOutputName, double>> custom_outputs)
+        std::vector<std::pair<CustomOutputName, double>> custom_outputs,
+        std::size_t warming_up_samples = 0,
+        std::optional<IterationRegression> iteration_regression = std::nullopt)
         : case_info_(std::move(case_info)),
           cond_(std::move(cond)),
           measurement_type_(std::move(measurement_type)),
           iterations_(iterations),
           samples_(samples),
           durations_(std::move(durations)),
-          durations_stat_(stat::calc_stat(durations_, iterations)),
+          drift_diagnostics_(
+              diagnose_drift(durations_, iteration_regression.has_value())),
+          durations_stat_(stat::adjust_standard_error(
+              stat::calc_stat(durations_, iterations), drift_diagnostics_)),
           custom_stat_outputs_(std::move(custom_stat_outputs)),
-          custom_outputs_(std::move(custom_outputs)) {
+          custom_outputs_(std::move(custom_outputs)),
+          warming_up_samples_(warming_up_samples),
+          iteration_regression_(std::move(iteration_regression)) {
         custom_stat_.reserve(custom_stat_outputs_.size());
         for (const auto& out : custom_stat_outputs_) {
             out->preprocess(durations_);
@@ -121,6 +135,16 @@ public:
         return samples_;
     }
 
+    /*!
+     * \brief Get the number of samples for warming up.
+     *
+     * \return Number of samples for warming up.
+     */
+    [[nodiscard]] auto warming_up_samples() const noexcept
+        -> const std::size_t& {
+        return warming_up_samples_;
+    }
+
     /*!
      * \brief Get the measured durations.
      *
@@ -133,9 +157,25 @@ public:
         return durations_;
     }
 
+    /*!
+     * \brief Get the diagnostics of drifts and autocorrelation of durations.
+     *
+     * \note Drifts aren't diagnosed for measurements with
+     * iteration_regression().
+     *
+     * \return Diagnostics.
+     */
+    [[nodiscard]] auto drift_diagnostics() const noexcept
+        -> const stat::DriftDiagnostics& {
+        return drift_diagnostics_;
+    }
+
     /*!
      * \brief Get the statistics of durations.
      *
+     * \note The standard error is adjusted using the effective sample size in
+     * drift_diagnostics().
+     *
      * \return Statistics of durations.
      */
     [[nodiscard]] auto durations_stat() const noexcept
@@ -173,7 +213,47 @@ public:
         return custom_outputs_;
     }
 
+    /*!
+     * \brief Get the result of linear regression of durations on numbers of
+     * iterations.
+     *
+     * \note This is available only when numbers of iterations increase
+     * linearly in samples. Then, durations() returns durations converted to
+     * ones of iterations() iterations.
+     *
+     * \return Result.
+     */
+    [[nodiscard]] auto iteration_regression() const noexcept
+        -> const std::optional<IterationRegression>& {
+        return iteration_regression_;
+    }
+
 private:
+    /*!
+     * \brief Diagnose drifts of durations.
+     *
+     * Durations normalized for the linear regression on numbers of iterations
+     * decrease in samples by design, so drifts aren't diagnosed for them.
+     *
+     * \param[in] durations Durations.
+     * \param[in] has_iteration_regression Whether the linear regression on
+     * numbers of iterations was done.
+     * \return Diagnostics.
+     */
+    [[nodiscard]] static auto diagnose_drift(
+        const std::vector<std::vector<clock::Duration>>& durations,
+        bool has_iteration_regression) -> stat::DriftDiagnostics {
+        if (!has_iteration_regression) {
+            return stat::diagnose_drift(durations);
+        }
+        stat::DriftDiagnostics diagnostics;
+        for (const auto& thread_durations : durations) {
+            diagnostics.effective_sample_size +=
+                static_cast<double>(thread_durations.size());
+        }
+        return diagnostics;
+    }
+
     //! Information of the case.
     BenchmarkFullName case_info_;
 
@@ -192,6 +272,9 @@ private:
     //! Measured durations.
     std::vector<std::vector<clock::Duration>> durations_;
 
+    //! Diagnostics of drifts and autocorrelation of durations.
+    stat::DriftDiagnostics drift_diagnostics_;
+
     //! Statistics of durations.
     stat::Statistics durations_stat_;
 
@@ -203,6 +286,12 @@ private:
 
     //! Custom outputs without statistics.
     std::vector<std::pair<CustomOutputName, double>> custom_outputs_;
+
+    //! Number of samples for warming up.
+    std::size_t warming_up_samples_;
+
+    //! Result of linear regression of durations on numbers of iterations.
+    std::optional<IterationRegression> iteration_regression_;
 };
 
 }  // namespace stat_bench::measurer
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions for adaptive refinement of parameters.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace stat_bench::param {
+
+//! Default threshold of changes in adaptive refinement of parameters.
+static constexpr double default_refinement_threshold = 0.2;
+
+/*!
+ * \brief Struct of configurations of adaptive refinement of a numeric
+ * parameter.
+ */
+struct AdaptiveRefinementConfig {
+    //! Maximum number of values added in each case.
+    std::size_t max_points{0};
+
+    /*!
+     * \brief Threshold of changes in processing time per value of the
+     * parameter.
+     *
+     * Intervals with larger relative jumps or changes of slopes in the log
+     * scale are refined.
+     */
+    double threshold{default_refinement_threshold};
+};
+
+/*!
+ * \brief Struct of intervals of parameter values to refine.
+ */
+struct RefinementInterval {
+    //! Index of the lower value of the interval.
+    std::size_t index;
+
+    //! Score. (Larger values are refined first.)
+    double score;
+};
+
+/*!
+ * \brief Find intervals of parameter values to refine.
+ *
+ * Processing time per value of the parameter (time per element for sizes)
+ * is compared between neighboring values.
+ *
+ * \param[in] values Parameter values in ascending order.
+ * \param[in] mean_times Mean processing times for the values.
+ * \param[in] threshold Threshold of changes.
+ * \return Intervals in descending order of scores.
+ */
+[[nodiscard]] auto find_refinement_intervals(const std::vector<double>& values,
+    const std::vector<double>& mean_times, double threshold)
+    -> std::vector<RefinementInterval>;
+
+/*!
+ * \brief Calculate a value to insert into an interval.
+ *
+ * \param[in] lower Lower value.
+ * \param[in] upper Upper value.
+ * \return Value. (Geometric mean for positive values, arithmetic mean
+ * otherwise.)
+ */
+[[nodiscard]] auto calc_refinement_point(double lower, double upper)
+    -> double;
+
+}  // namespace stat_bench::param
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to generate numbers of threads from the
+ * topology of CPUs.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "stat_bench/param/parameter_name.h"
+#include "stat_bench/util/cpu_topology.h"
+
+namespace stat_bench::param {
+
+/*!
+ * \brief Get the parameter name for the expected placement of threads.
+ *
+ * \note Threads aren't pinned to CPUs, so values of this parameter are
+ * placements expected from numbers of threads, which aren't enforced.
+ *
+ * \return Parameter name.
+ */
+inline auto expected_placement_parameter_name() -> const ParameterName& {
+    static auto name = ParameterName("expected_placement");
+    return name;
+}
+
+/*!
+ * \brief Generate numbers of threads from the topology of CPUs.
+ *
+ * Generated numbers are 1, powers of two less than the number of physical
+ * cores, the number of physical cores in a socket, the number of all
+ * physical cores, and the number of all logical CPUs, in ascending order.
+ *
+ * \param[in] topology Topology of CPUs.
+ * \param[in] max_threads Maximum number of threads. Larger numbers are
+ * replaced with this number. (Zero for no limit.)
+ * \return Numbers of threads.
+ */
+[[nodiscard]] auto generate_auto_num_threads(
+    const util::CpuTopology& topology, std::size_t max_threads = 0)
+    -> std::vector<std::size_t>;
+
+/*!
+ * \brief Describe the placement of threads on CPUs expected from the number of
+ * threads.
+ *
+ * Threads are assumed to fill physical cores in a socket first, then physical
+ * cores in other sockets, and then hardware threads sharing physical cores.
+ * Operating systems can place threads differently, because threads aren't
+ * pinned to CPUs.
+ *
+ * \param[in] num_threads Number of threads.
+ * \param[in] topology Topology of CPUs.
+ * \return Description. ("cores" for physical cores in a socket,
+ * "cross_socket" for physical cores in multiple sockets, "smt" for
+ * hardware threads sharing physical cores, "cross_socket+smt" for both, and
+ * "oversubscribed" for more threads than logical CPUs.)
+ */
+[[nodiscard]] auto describe_expected_thread_placement(
+    std::size_t num_threads, const util::CpuTopology& topology) -> std::string;
+
+}  // namespace stat_bench::param
@@ -20,13 +20,23 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
+#include "stat_bench/param/auto_num_threads.h"
+#include "stat_bench/param/num_threads_parameter_name.h"
+#include "stat_bench/param/parameter_dict.h"
 #include "stat_bench/param/parameter_generator.h"
 #include "stat_bench/param/parameter_name.h"
+#include "stat_bench/param/parameter_sampling.h"
 #include "stat_bench/param/parameter_value_vector.h"
+#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/cpu_topology.h"
 
 namespace stat_bench::param {
 
@@ -69,20 +79,193 @@ public:
                    }) != params_.end();
     }
 
+    /*!
+     * \brief Get the parameters.
+     *
+     * \return Pairs of names and vectors of values.
+     */
+    [[nodiscard]] auto params() const noexcept -> const std::vector<
+        std::pair<ParameterName, std::shared_ptr<IParameterValueVector>>>& {
+        return params_;
+    }
+
+    /*!
+     * \brief Iterate parameters together instead of using the Cartesian
+     * product.
+     *
+     * The i-th values of the given parameters are used together, so the
+     * parameters must have the same number of values.
+     *
+     * \param[in] param_names Names of parameters.
+     */
+    void zip(std::vector<ParameterName> param_names) {
+        for (const auto& param_name : param_names) {
+            if (!has(param_name)) {
+                throw StatBenchException(fmt::format(
+                    FMT_STRING("Parameter {} not found."), param_name));
+            }
+        }
+        zipped_params_.push_back(std::move(param_names));
+    }
+
+    /*!
+     * \brief Add a constraint of parameters.
+     *
+     * Combinations of parameters not satisfying constraints are skipped
+     * before any setup of benchmarks.
+     *
+     * \param[in] constraint Constraint.
+     */
+    void add_constraint(ParameterConstraint constraint) {
+        constraints_.push_back(std::move(constraint));
+    }
+
+    /*!
+     * \brief Check whether parameters satisfy the constraints.
+     *
+     * \param[in] dict Parameters.
+     * \return Whether the parameters satisfy all the constraints.
+     */
+    [[nodiscard]] auto satisfies_constraints(const ParameterDict& dict) const
+        -> bool {
+        return std::all_of(constraints_.begin(), constraints_.end(),
+            [&dict](const ParameterConstraint& constraint) {
+                return constraint(dict);
+            });
+    }
+
+    /*!
+     * \brief Set the configuration of sampling of combinations of
+     * parameters.
+     *
+     * \param[in] sampling Configuration.
+     */
+    void set_sampling(const ParameterSamplingConfig& sampling) {
+        sampling_ = sampling;
+    }
+
+    /*!
+     * \brief Get the configuration of sampling of combinations of
+     * parameters.
+     *
+     * \return Configuration.
+     */
+    [[nodiscard]] auto sampling() const noexcept
+        -> const ParameterSamplingConfig& {
+        return sampling_;
+    }
+
+    /*!
+     * \brief Set numbers of threads generated from the topology of CPUs.
+     *
+     * This sets values of the parameter of the number of threads, and also
+     * sets the parameter of the expected placement of threads iterated
+     * together if annotate_placement is true. Values set before are replaced.
+     * (The placement isn't enforced, because threads aren't pinned to CPUs.)
+     *
+     * \param[in] num_threads Numbers of threads.
+     * \param[in] topology Topology of CPUs.
+     * \param[in] annotate_placement Whether to add the parameter of the
+     * expected placement of threads.
+     * \return Vector of the numbers of threads.
+     */
+    auto set_auto_threads(const std::vector<std::size_t>& num_threads,
+        const util::CpuTopology& topology, bool annotate_placement)
+        -> std::shared_ptr<ParameterValueVector<std::size_t>> {
+        auto threads = std::make_shared<ParameterValueVector<std::size_t>>();
+        auto placements =
+            std::make_shared<ParameterValueVector<std::string>>();
+        for (const std::size_t value : num_threads) {
+            if (value == 0) {
+                throw StatBenchException(
+                    "Number of threads must be positive.");
+            }
+            threads->add(value);
+            placements->add(
+                describe_expected_thread_placement(value, topology));
+        }
+        replace_or_add(num_threads_parameter_name(), threads);
+        if (annotate_placement &&
+            replace_or_add(expected_placement_parameter_name(), placements)) {
+            zip({num_threads_parameter_name(),
+                expected_placement_parameter_name()});
+        }
+        has_auto_threads_ = true;
+        annotates_thread_placement_ = annotate_placement;
+        return threads;
+    }
+
+    /*!
+     * \brief Check whether numbers of threads are generated from the
+     * topology of CPUs.
+     *
+     * \return Whether numbers of threads are generated.
+     */
+    [[nodiscard]] auto has_auto_threads() const noexcept -> bool {
+        return has_auto_threads_;
+    }
+
+    /*!
+     * \brief Check whether the expected placement of threads is added as a
+     * parameter.
+     *
+     * \return Whether the placement of threads is added.
+     */
+    [[nodiscard]] auto annotates_thread_placement() const noexcept -> bool {
+        return annotates_thread_placement_;
+    }
+
     /*!
      * \brief Create a generator of parameter dictionaries.
      *
      * \return Generator.
      */
     [[nodiscard]] auto create_generator() const {
-        return ParameterGenerator(params_);
+        return ParameterGenerator(
+            params_, zipped_params_, constraints_, sampling_);
     }
 
 private:
+    /*!
+     * \brief Replace values of a parameter, or add the parameter if not
+     * exists.
+     *
+     * \param[in] param_name Parameter name.
+     * \param[in] values Vector of parameter values.
+     * \retval true Added the parameter.
+     * \retval false Replaced values of the parameter.
+     */
+    auto replace_or_add(const ParameterName& param_name,
+        std::shared_ptr<IParameterValueVector> values) -> bool {
+        for (auto& [name, vec] : params_) {
+            if (name == param_name) {
+                vec = std::move(values);
+                return false;
+            }
+        }
+        params_.emplace_back(param_name, std::move(values));
+        return true;
+    }
+
     //! Parameters.
     std::vector<
         std::pair<ParameterName, std::shared_ptr<IParameterValueVector>>>
         params_{};
+
+    //! Groups of names of parameters iterated together.
+    std::vector<std::vector<ParameterName>> zipped_params_{};
+
+    //! Constraints.
+    std::vector<ParameterConstraint> constraints_{};
+
+    //! Configuration of sampling of combinations of parameters.
+    ParameterSamplingConfig sampling_{};
+
+    //! Whether numbers of threads are generated from the topology of CPUs.
+    bool has_auto_threads_{false};
+
+    //! Whether the placement of threads is added as a parameter.
+    bool annotates_thread_placement_{false};
 };
 
 }  // namespace stat_bench::param
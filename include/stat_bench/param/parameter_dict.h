@@ -128,6 +128,16 @@ public:
     [[nodiscard]] auto clone_without(const ParameterName& param_name) const
         -> ParameterDict;
 
+    /*!
+     * \brief Create a new dictionary with a parameter replaced.
+     *
+     * \param[in] param_name Parameter name to replace.
+     * \param[in] value New value.
+     * \return New dictionary.
+     */
+    [[nodiscard]] auto clone_with(const ParameterName& param_name,
+        const ParameterValue& value) const -> ParameterDict;
+
     /*!
      * \brief Calculate hash value.
      *
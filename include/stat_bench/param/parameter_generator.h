@@ -19,6 +19,8 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -26,10 +28,19 @@
 
 #include "stat_bench/param/parameter_dict.h"
 #include "stat_bench/param/parameter_name.h"
+#include "stat_bench/param/parameter_sampling.h"
 #include "stat_bench/param/parameter_value_vector.h"
 
 namespace stat_bench::param {
 
+/*!
+ * \brief Type of constraints of parameters.
+ *
+ * A constraint returns true for combinations of parameters to measure, and
+ * false for combinations to skip.
+ */
+using ParameterConstraint = std::function<bool(const ParameterDict&)>;
+
 /*!
  * \brief Class of generators of parameter dictionaries.
  */
@@ -39,13 +50,33 @@ public:
      * \brief Constructor.
      *
      * \param[in] params Parameters. (Pairs of names and vectors of values.)
+     * \param[in] zipped_params Groups of names of parameters iterated
+     * together instead of using the Cartesian product.
+     * \param[in] constraints Constraints of parameters.
+     * \param[in] sampling Configuration of sampling of combinations of
+     * parameters.
+     */
+    explicit ParameterGenerator(
+        const std::vector<std::pair<ParameterName,
+            std::shared_ptr<IParameterValueVector>>>& params,
+        const std::vector<std::vector<ParameterName>>& zipped_params = {},
+        std::vector<ParameterConstraint> constraints = {},
+        const ParameterSamplingConfig& sampling = {});
+
+    /*!
+     * \brief Check whether no combination of parameters satisfies the
+     * constraints.
+     *
+     * \retval true No parameters to generate.
+     * \retval false Some parameters to generate.
      */
-    explicit ParameterGenerator(const std::vector<std::pair<ParameterName,
-            std::shared_ptr<IParameterValueVector>>>& params);
+    [[nodiscard]] auto empty() const noexcept -> bool;
 
     /*!
      * \brief Iterate once.
      *
+     * Combinations of parameters not satisfying the constraints are skipped.
+     *
      * \return Whether the next parameters exists.
      */
     [[nodiscard]] auto iterate() -> bool;
@@ -58,6 +89,27 @@ public:
     [[nodiscard]] auto generate() const -> ParameterDict;
 
 private:
+    /*!
+     * \brief Iterate once without checking constraints.
+     *
+     * \return Whether the next parameters exists.
+     */
+    [[nodiscard]] auto iterate_once() -> bool;
+
+    /*!
+     * \brief Check whether the current parameters satisfy the constraints.
+     *
+     * \return Whether the current parameters satisfy the constraints.
+     */
+    [[nodiscard]] auto satisfies_constraints() const -> bool;
+
+    /*!
+     * \brief Set the current parameters.
+     *
+     * \param[in] indices Indices of values in each group of parameters.
+     */
+    void set_indices(const std::vector<std::size_t>& indices);
+
     /*!
      * \brief Struct of data per parameter.
      */
@@ -80,6 +132,24 @@ private:
 
     //! Parameters.
     std::vector<ParamData> params_{};
+
+    //! Groups of indices of parameters iterated together.
+    std::vector<std::vector<std::size_t>> groups_{};
+
+    //! Constraints.
+    std::vector<ParameterConstraint> constraints_{};
+
+    //! Whether no parameters to generate.
+    bool empty_{false};
+
+    //! Whether to use sampled combinations instead of the full iteration.
+    bool is_sampled_{false};
+
+    //! Sampled combinations of indices of values in each group.
+    std::vector<std::vector<std::size_t>> sampled_indices_{};
+
+    //! Index of the current sampled combination.
+    std::size_t current_sample_{0};
 };
 
 }  // namespace stat_bench::param
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to sample parameters.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace stat_bench::param {
+
+/*!
+ * \brief Enumeration of methods to sample combinations of parameters.
+ */
+enum class ParameterSamplingMethod : std::uint8_t {
+    full,                 //!< All combinations.
+    random,               //!< Random subset of combinations.
+    latin_hypercube,      //!< Latin hypercube sampling.
+    fractional_factorial  //!< Two-level fractional factorial design.
+};
+
+//! Default seed of random numbers used in sampling of parameters.
+static constexpr std::uint32_t default_parameter_sampling_seed = 0;
+
+/*!
+ * \brief Struct of configurations of sampling of parameters.
+ */
+struct ParameterSamplingConfig {
+    //! Method.
+    ParameterSamplingMethod method{ParameterSamplingMethod::full};
+
+    /*!
+     * \brief Maximum number of combinations of parameters.
+     *
+     * Zero specifies no limit.
+     */
+    std::size_t max_conditions{0};
+
+    //! Seed of random numbers.
+    std::uint32_t seed{default_parameter_sampling_seed};
+};
+
+/*!
+ * \brief Parse a method to sample combinations of parameters.
+ *
+ * \param[in] str String. (One of "full", "random", "latin_hypercube",
+ * "fractional_factorial".)
+ * \return Method.
+ */
+[[nodiscard]] auto parse_parameter_sampling_method(const std::string& str)
+    -> ParameterSamplingMethod;
+
+/*!
+ * \brief Sample combinations of indices of parameter values.
+ *
+ * \param[in] sizes Number of values of each parameter.
+ * \param[in] config Configuration.
+ * \param[in] is_valid Function to check whether a combination is valid.
+ * \return Sampled combinations of indices in the order of the full iteration.
+ */
+[[nodiscard]] auto sample_parameter_indices(
+    const std::vector<std::size_t>& sizes,
+    const ParameterSamplingConfig& config,
+    const std::function<bool(const std::vector<std::size_t>&)>& is_valid)
+    -> std::vector<std::vector<std::size_t>>;
+
+}  // namespace stat_bench::param
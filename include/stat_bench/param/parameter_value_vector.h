@@ -19,14 +19,37 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <optional>
+#include <type_traits>
 #include <utility>  // IWYU pragma: keep
 #include <vector>
 
+#include "stat_bench/param/adaptive_refinement.h"
 #include "stat_bench/param/parameter_value.h"
+#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/cache_sizes.h"
 
 namespace stat_bench::param {
 
+namespace impl {
+
+//! Relative tolerance of the last values in ranges of parameter values.
+static constexpr double range_tolerance = 1e-9;
+
+/*!
+ * \brief Cache sizes used when sizes of CPU caches cannot be detected.
+ *
+ * These are 32 KiB, 1 MiB, and 32 MiB.
+ */
+static constexpr util::CacheSizes fallback_cache_sizes{
+    static_cast<std::size_t>(32) << 10U, static_cast<std::size_t>(1) << 20U,
+    static_cast<std::size_t>(32) << 20U};
+
+}  // namespace impl
+
 /*!
  * \brief Interface of vectors of parameter values.
  */
@@ -56,6 +79,34 @@ public:
      */
     [[nodiscard]] virtual auto size() const -> std::size_t = 0;
 
+    /*!
+     * \brief Get the configuration of adaptive refinement.
+     *
+     * \note Adaptive refinement is disabled by default.
+     *
+     * \return Configuration. (Null if adaptive refinement is disabled.)
+     */
+    [[nodiscard]] virtual auto refinement() const
+        -> const AdaptiveRefinementConfig* {
+        return nullptr;
+    }
+
+    /*!
+     * \brief Create a value of the type of this vector from a double value.
+     *
+     * \note This is used in adaptive refinement and supported only for
+     * numeric types. This throws an exception by default.
+     *
+     * \param[in] value Value.
+     * \return Created value. (Rounded for integer types.)
+     */
+    [[nodiscard]] virtual auto create_value(double value) const
+        -> ParameterValue {
+        (void)value;
+        throw StatBenchException(
+            "Values can be created only for numeric parameters.");
+    }
+
     IParameterValueVector(const IParameterValueVector&) = delete;
     IParameterValueVector(IParameterValueVector&&) = delete;
     auto operator=(const IParameterValueVector&)
@@ -74,14 +125,84 @@ protected:
     IParameterValueVector() = default;
 };
 
+namespace impl {
+
+//! Whether a type of parameter values is numeric.
+template <typename T>
+inline constexpr bool is_numeric_parameter_v =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+/*!
+ * \brief Base class of vectors of parameter values.
+ *
+ * This uses the default implementation of adaptive refinement in
+ * IParameterValueVector for non-numeric types.
+ *
+ * \tparam T Type of values.
+ */
+template <typename T, typename = void>
+class ParameterValueVectorBase : public IParameterValueVector {};
+
+/*!
+ * \brief Base class of vectors of numeric parameter values.
+ *
+ * \tparam T Type of values.
+ */
+template <typename T>
+class ParameterValueVectorBase<T,
+    std::enable_if_t<is_numeric_parameter_v<T>>>
+    : public IParameterValueVector {
+public:
+    //! \copydoc stat_bench::param::IParameterValueVector::refinement
+    [[nodiscard]] auto refinement() const
+        -> const AdaptiveRefinementConfig* override {
+        if (refinement_) {
+            return &*refinement_;
+        }
+        return nullptr;
+    }
+
+    //! \copydoc stat_bench::param::IParameterValueVector::create_value
+    [[nodiscard]] auto create_value(double value) const
+        -> ParameterValue override {
+        if constexpr (std::is_integral_v<T>) {
+            return std::move(
+                ParameterValue().emplace<T>(static_cast<T>(std::round(value))));
+        } else {
+            return std::move(
+                ParameterValue().emplace<T>(static_cast<T>(value)));
+        }
+    }
+
+protected:
+    /*!
+     * \brief Set the configuration of adaptive refinement.
+     *
+     * \param[in] config Configuration.
+     */
+    void set_refinement(const AdaptiveRefinementConfig& config) {
+        refinement_ = config;
+    }
+
+private:
+    //! Configuration of adaptive refinement.
+    std::optional<AdaptiveRefinementConfig> refinement_{};
+};
+
+}  // namespace impl
+
 /*!
  * \brief Class of vectors of parameter values.
  *
  * \tparam T Type of values.
  */
 template <typename T>
-class ParameterValueVector final : public IParameterValueVector {
+class ParameterValueVector final
+    : public impl::ParameterValueVectorBase<T> {
 public:
+    //! Type of iterators.
+    using ConstIterator = IParameterValueVector::ConstIterator;
+
     /*!
      * \brief Constructor.
      */
@@ -108,6 +229,152 @@ public:
         return values_.end();
     }
 
+    /*!
+     * \brief Add values in a linear range.
+     *
+     * \param[in] first First value.
+     * \param[in] last Last value. (Included if reached by steps.)
+     * \param[in] step Step. (Must be positive.)
+     * \return This.
+     */
+    auto add_range(const T& first, const T& last, const T& step)
+        -> ParameterValueVector* {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+            "Ranges require numeric parameters.");
+        if (!(step > static_cast<T>(0))) {
+            throw StatBenchException("Step of a range must be positive.");
+        }
+        if (last < first) {
+            throw StatBenchException(
+                "Last value of a range must not be less than the first one.");
+        }
+        const auto num_steps = static_cast<std::size_t>(
+            std::floor(static_cast<double>(last - first) /
+                    static_cast<double>(step) +
+                impl::range_tolerance));
+        for (std::size_t i = 0; i <= num_steps; ++i) {
+            add(static_cast<T>(first + static_cast<T>(i) * step));
+        }
+        return this;
+    }
+
+    /*!
+     * \brief Add values in a geometric progression.
+     *
+     * Values are rounded for integer types, and duplicated values after
+     * rounding are skipped.
+     *
+     * \param[in] first First value. (Must be positive.)
+     * \param[in] last Last value. (Included if reached.)
+     * \param[in] ratio Ratio of consecutive values. (Must be greater than
+     * one.)
+     * \return This.
+     */
+    auto add_geometric(const T& first, const T& last, double ratio)
+        -> ParameterValueVector* {
+        if (!(ratio > 1.0)) {
+            throw StatBenchException(
+                "Ratio of a geometric progression must be greater than one.");
+        }
+        return add_geometric_impl(first, last, std::log2(ratio));
+    }
+
+    /*!
+     * \brief Add powers of two with intermediate values.
+     *
+     * For example, first = 1, last = 8, and steps_per_octave = 2 gives
+     * 1, 1.41, 2, 2.83, 4, 5.66, 8 (rounded to 1, 2, 3, 4, 6, 8 for integer
+     * types).
+     *
+     * \param[in] first First value. (Must be positive.)
+     * \param[in] last Last value. (Included if reached.)
+     * \param[in] steps_per_octave Number of values per doubling.
+     * \return This.
+     */
+    auto add_powers_of_two(const T& first, const T& last,
+        std::size_t steps_per_octave = 1) -> ParameterValueVector* {
+        if (steps_per_octave == 0) {
+            throw StatBenchException(
+                "Number of steps per octave must be positive.");
+        }
+        return add_geometric_impl(
+            first, last, 1.0 / static_cast<double>(steps_per_octave));
+    }
+
+    /*!
+     * \brief Add values around sizes of CPU caches of the current host.
+     *
+     * For each of L1 data, L2, and L3 caches, values of the cache size
+     * multiplied by each factor and divided by element_size are added in
+     * ascending order. When sizes of caches cannot be detected, typical sizes
+     * (32 KiB, 1 MiB, and 32 MiB) are used instead.
+     *
+     * \param[in] element_size Size of an element in bytes. (Use 1 for sizes
+     * in bytes.)
+     * \param[in] factors Factors of cache sizes. (Default is working sets
+     * just below and above each cache.)
+     * \return This.
+     */
+    auto add_cache_sizes(std::size_t element_size = 1,
+        const std::vector<double>& factors = {
+            0.75, 1.5})  // NOLINT(readability-magic-numbers)
+        -> ParameterValueVector* {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+            "Ranges require numeric parameters.");
+        if (element_size == 0) {
+            throw StatBenchException("Size of elements must be positive.");
+        }
+        auto cache_sizes = util::detect_cache_sizes();
+        if (cache_sizes.l1d == 0 && cache_sizes.l2 == 0 &&
+            cache_sizes.l3 == 0) {
+            cache_sizes = impl::fallback_cache_sizes;
+        }
+        std::vector<T> values;
+        for (const std::size_t cache_size :
+            {cache_sizes.l1d, cache_sizes.l2, cache_sizes.l3}) {
+            if (cache_size == 0) {
+                continue;
+            }
+            for (const double factor : factors) {
+                const double value = static_cast<double>(cache_size) *
+                    factor / static_cast<double>(element_size);
+                if constexpr (std::is_integral_v<T>) {
+                    values.push_back(static_cast<T>(std::round(value)));
+                } else {
+                    values.push_back(static_cast<T>(value));
+                }
+            }
+        }
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        for (const auto& value : values) {
+            if (value > static_cast<T>(0)) {
+                add(value);
+            }
+        }
+        return this;
+    }
+
+    /*!
+     * \brief Enable adaptive refinement of this parameter.
+     *
+     * After measurements with the added values, values are inserted where
+     * the processing time per value of this parameter jumps or changes its
+     * slope, until the given number of values are added.
+     *
+     * \param[in] max_points Maximum number of values added in each case.
+     * \param[in] threshold Threshold of relative changes.
+     * \return This.
+     */
+    auto refine_adaptively(std::size_t max_points,
+        double threshold = default_refinement_threshold)
+        -> ParameterValueVector* {
+        static_assert(impl::is_numeric_parameter_v<T>,
+            "Adaptive refinement requires numeric parameters.");
+        this->set_refinement(AdaptiveRefinementConfig{max_points, threshold});
+        return this;
+    }
+
     //! \copydoc stat_bench::param::IParameterValueVector::size
     [[nodiscard]] auto size() const -> std::size_t override {
         return values_.size();
@@ -125,6 +392,55 @@ public:
     ~ParameterValueVector() override = default;
 
 private:
+    /*!
+     * \brief Add values in a geometric progression.
+     *
+     * \param[in] first First value.
+     * \param[in] last Last value.
+     * \param[in] log2_ratio Logarithm of the ratio of consecutive values
+     * with base 2.
+     * \return This.
+     */
+    auto add_geometric_impl(const T& first, const T& last, double log2_ratio)
+        -> ParameterValueVector* {
+        static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+            "Ranges require numeric parameters.");
+        if (!(first > static_cast<T>(0))) {
+            throw StatBenchException(
+                "First value of a geometric progression must be positive.");
+        }
+        if (last < first) {
+            throw StatBenchException(
+                "Last value of a range must not be less than the first one.");
+        }
+        const double first_value = static_cast<double>(first);
+        const double last_value =
+            static_cast<double>(last) * (1.0 + impl::range_tolerance);
+        bool has_previous = false;
+        T previous{};
+        for (std::size_t i = 0;; ++i) {
+            // Calculated from the first value to avoid accumulation of errors.
+            const double value = first_value *
+                std::exp2(static_cast<double>(i) * log2_ratio);
+            if (value > last_value) {
+                break;
+            }
+            T converted{};
+            if constexpr (std::is_integral_v<T>) {
+                converted = static_cast<T>(std::round(value));
+            } else {
+                converted = static_cast<T>(value);
+            }
+            if (has_previous && converted == previous) {
+                continue;
+            }
+            add(converted);
+            previous = converted;
+            has_previous = true;
+        }
+        return this;
+    }
+
     //! Values.
     std::vector<ParameterValue> values_{};
 };
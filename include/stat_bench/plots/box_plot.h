@@ -19,8 +19,11 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <string>
 
+#include "stat_bench/plots/decimate_samples.h"
 #include "stat_bench/plots/i_plot.h"
 #include "stat_bench/util/utf8_string.h"
 
@@ -33,8 +36,12 @@ class BoxPlot final : public IPlot {
 public:
     /*!
      * \brief Constructor.
+     *
+     * \param[in] max_points_per_trace Maximum number of points per trace.
+     * (0 for no limit.)
      */
-    BoxPlot() = default;
+    explicit BoxPlot(
+        std::size_t max_points_per_trace = default_max_points_per_trace);
 
     BoxPlot(const BoxPlot&) = delete;
     BoxPlot(BoxPlot&&) = delete;
@@ -53,10 +60,14 @@ public:
     //! \copydoc stat_bench::plots::IPlot::write
     void write(const measurer::MeasurementType& measurement_type,
         const BenchmarkGroupName& group_name,
-        const std::vector<measurer::Measurement>& measurements,
+        const std::vector<std::shared_ptr<const measurer::Measurement>>&
+            measurements,
         const std::string& file_path) override;
 
 private:
+    //! Maximum number of points per trace.
+    std::size_t max_points_per_trace_;
+
     //! Name for output files.
     util::Utf8String name_for_file_{"box"};
 };
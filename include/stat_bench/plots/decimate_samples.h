@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to decimate samples for plots.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace stat_bench::plots {
+
+//! Default maximum number of points per trace in plots.
+static constexpr std::size_t default_max_points_per_trace = 10000;
+
+/*!
+ * \brief Select samples for line plots of samples preserving minimum and
+ * maximum values.
+ *
+ * Samples are divided into buckets of consecutive samples, and the minimum
+ * and the maximum samples in each bucket are selected.
+ *
+ * \param[in] samples Samples in the order of measurements.
+ * \param[in] max_points Maximum number of points. (0 for no limit.)
+ * \return Indices of the selected samples in ascending order.
+ */
+[[nodiscard]] auto decimate_min_max(const std::vector<double>& samples,
+    std::size_t max_points) -> std::vector<std::size_t>;
+
+/*!
+ * \brief Select indices of sorted samples at evenly spaced quantiles.
+ *
+ * The first and the last samples are always selected.
+ *
+ * \param[in] num_samples Number of samples.
+ * \param[in] max_points Maximum number of points. (0 for no limit.)
+ * \return Indices of the selected samples in ascending order.
+ */
+[[nodiscard]] auto select_quantile_indices(
+    std::size_t num_samples, std::size_t max_points)
+    -> std::vector<std::size_t>;
+
+/*!
+ * \brief Reduce samples for plots of distributions (box plots and violin
+ * plots).
+ *
+ * Samples are selected at evenly spaced quantiles so that quartiles and the
+ * density are approximately preserved. The minimum, the maximum, and the ends
+ * of whiskers (the most extreme samples within 1.5 IQR from quartiles) are
+ * always included.
+ *
+ * \param[in] sorted_samples Sorted samples.
+ * \param[in] max_points Maximum number of points. (0 for no limit.)
+ * \return Selected samples in ascending order.
+ */
+[[nodiscard]] auto reduce_for_distribution(
+    const std::vector<double>& sorted_samples, std::size_t max_points)
+    -> std::vector<double>;
+
+}  // namespace stat_bench::plots
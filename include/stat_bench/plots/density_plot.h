@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of DensityPlot class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "stat_bench/plots/i_plot.h"
+#include "stat_bench/util/utf8_string.h"
+
+namespace stat_bench::plots {
+
+//! Default number of points per trace in plots of probability density.
+static constexpr std::size_t default_density_points = 256;
+
+/*!
+ * \brief Class of line plots of probability density of processing time
+ * estimated using Gaussian kernels.
+ *
+ * Density is estimated in C++ with the bandwidth by Silverman's rule of
+ * thumb, and only the resulting curves are written to files, so the size of
+ * files doesn't depend on the number of samples.
+ */
+class DensityPlot final : public IPlot {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] num_points Number of points per trace.
+     * \param[in] log_scale Whether to estimate density in the log scale.
+     * \param[in] num_threads Number of threads to process measurements.
+     */
+    explicit DensityPlot(std::size_t num_points = default_density_points,
+        bool log_scale = true, std::size_t num_threads = 1);
+
+    DensityPlot(const DensityPlot&) = delete;
+    DensityPlot(DensityPlot&&) = delete;
+    auto operator=(const DensityPlot&) -> DensityPlot& = delete;
+    auto operator=(DensityPlot&&) -> DensityPlot& = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~DensityPlot() override = default;
+
+    //! \copydoc stat_bench::plots::IPlot::name_for_file
+    [[nodiscard]] auto name_for_file() const
+        -> const util::Utf8String& override;
+
+    //! \copydoc stat_bench::plots::IPlot::write
+    void write(const measurer::MeasurementType& measurement_type,
+        const BenchmarkGroupName& group_name,
+        const std::vector<std::shared_ptr<const measurer::Measurement>>&
+            measurements,
+        const std::string& file_path) override;
+
+private:
+    //! Number of points per trace.
+    std::size_t num_points_;
+
+    //! Whether to estimate density in the log scale.
+    bool log_scale_;
+
+    //! Number of threads to process measurements.
+    std::size_t num_threads_;
+
+    //! Name for output files.
+    util::Utf8String name_for_file_{"density"};
+};
+
+}  // namespace stat_bench::plots
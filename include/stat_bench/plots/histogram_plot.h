@@ -0,0 +1,89 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of HistogramPlot class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "stat_bench/plots/i_plot.h"
+#include "stat_bench/util/utf8_string.h"
+
+namespace stat_bench::plots {
+
+//! Default number of bins in histograms.
+static constexpr std::size_t default_histogram_bins = 100;
+
+/*!
+ * \brief Class of histograms of processing time.
+ *
+ * Histograms are calculated in C++ and only the resulting step curves are
+ * written to files, so the size of files doesn't depend on the number of
+ * samples.
+ */
+class HistogramPlot final : public IPlot {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] num_bins Number of bins.
+     * \param[in] log_bins Whether to use log-spaced bins.
+     * \param[in] num_threads Number of threads to process measurements.
+     */
+    explicit HistogramPlot(std::size_t num_bins = default_histogram_bins,
+        bool log_bins = true, std::size_t num_threads = 1);
+
+    HistogramPlot(const HistogramPlot&) = delete;
+    HistogramPlot(HistogramPlot&&) = delete;
+    auto operator=(const HistogramPlot&) -> HistogramPlot& = delete;
+    auto operator=(HistogramPlot&&) -> HistogramPlot& = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~HistogramPlot() override = default;
+
+    //! \copydoc stat_bench::plots::IPlot::name_for_file
+    [[nodiscard]] auto name_for_file() const
+        -> const util::Utf8String& override;
+
+    //! \copydoc stat_bench::plots::IPlot::write
+    void write(const measurer::MeasurementType& measurement_type,
+        const BenchmarkGroupName& group_name,
+        const std::vector<std::shared_ptr<const measurer::Measurement>>&
+            measurements,
+        const std::string& file_path) override;
+
+private:
+    //! Number of bins.
+    std::size_t num_bins_;
+
+    //! Whether to use log-spaced bins.
+    bool log_bins_;
+
+    //! Number of threads to process measurements.
+    std::size_t num_threads_;
+
+    //! Name for output files.
+    util::Utf8String name_for_file_{"histogram"};
+};
+
+}  // namespace stat_bench::plots
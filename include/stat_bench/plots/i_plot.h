@@ -19,6 +19,7 @@
  */
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -49,10 +50,14 @@ public:
      * \param[in] group_name Group name.
      * \param[in] measurements Measurements.
      * \param[in] file_path File path of the output.
+     *
+     * \note This function may be called concurrently from worker threads
+     * for different measurement types.
      */
     virtual void write(const measurer::MeasurementType& measurement_type,
         const BenchmarkGroupName& group_name,
-        const std::vector<measurer::Measurement>& measurements,
+        const std::vector<std::shared_ptr<const measurer::Measurement>>&
+            measurements,
         const std::string& file_path) = 0;
 
     /*!
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of IterationRegressionPlot class.
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "stat_bench/plots/i_plot.h"
+#include "stat_bench/util/utf8_string.h"
+
+namespace stat_bench::plots {
+
+/*!
+ * \brief Class of plots of durations of samples with respect to numbers of
+ * iterations.
+ *
+ * Lines fitted by ordinary least squares and Theil-Sen estimator are drawn
+ * together. This is useful only for measurements with linearly increasing
+ * numbers of iterations, and no file is written for other measurements.
+ */
+class IterationRegressionPlot final : public IPlot {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    IterationRegressionPlot() = default;
+
+    IterationRegressionPlot(const IterationRegressionPlot&) = delete;
+    IterationRegressionPlot(IterationRegressionPlot&&) = delete;
+    auto operator=(const IterationRegressionPlot&)
+        -> IterationRegressionPlot& = delete;
+    auto operator=(IterationRegressionPlot&&)
+        -> IterationRegressionPlot& = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~IterationRegressionPlot() override = default;
+
+    //! \copydoc stat_bench::plots::IPlot::name_for_file
+    [[nodiscard]] auto name_for_file() const
+        -> const util::Utf8String& override;
+
+    //! \copydoc stat_bench::plots::IPlot::write
+    void write(const measurer::MeasurementType& measurement_type,
+        const BenchmarkGroupName& group_name,
+        const std::vector<std::shared_ptr<const measurer::Measurement>>&
+            measurements,
+        const std::string& file_path) override;
+
+private:
+    //! Name for output files.
+    util::Utf8String name_for_file_{"iteration_regression"};
+};
+
+}  // namespace stat_bench::plots
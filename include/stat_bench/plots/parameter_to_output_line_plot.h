@@ -19,6 +19,7 @@
  */
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "stat_bench/custom_output_name.h"
@@ -63,7 +64,8 @@ public:
     //! \copydoc stat_bench::plots::IPlot::write
     void write(const measurer::MeasurementType& measurement_type,
         const BenchmarkGroupName& group_name,
-        const std::vector<measurer::Measurement>& measurements,
+        const std::vector<std::shared_ptr<const measurer::Measurement>>&
+            measurements,
         const std::string& file_path) override;
 
 private:
@@ -19,6 +19,7 @@
  */
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "stat_bench/param/parameter_name.h"
@@ -38,9 +39,11 @@ public:
      *
      * \param[in] parameter_name Parameter name.
      * \param[in] options Options for the plot.
+     * \param[in] show_complexity_fit Whether to show curves of models of
+     * asymptotic complexity fitted in each case.
      */
-    ParameterToTimeLinePlot(
-        param::ParameterName parameter_name, PlotOptions options);
+    ParameterToTimeLinePlot(param::ParameterName parameter_name,
+        PlotOptions options, bool show_complexity_fit = false);
 
     ParameterToTimeLinePlot(const ParameterToTimeLinePlot&) = delete;
     ParameterToTimeLinePlot(ParameterToTimeLinePlot&&) = delete;
@@ -61,7 +64,8 @@ public:
     //! \copydoc stat_bench::plots::IPlot::write
     void write(const measurer::MeasurementType& measurement_type,
         const BenchmarkGroupName& group_name,
-        const std::vector<measurer::Measurement>& measurements,
+        const std::vector<std::shared_ptr<const measurer::Measurement>>&
+            measurements,
         const std::string& file_path) override;
 
 private:
@@ -70,11 +74,13 @@ private:
      *
      * \param[in] parameter_name Parameter name.
      * \param[in] options Options for the plot.
+     * \param[in] show_complexity_fit Whether to show curves of models of
+     * asymptotic complexity.
      * \return Name.
      */
     [[nodiscard]] static auto create_name_for_file(
-        const param::ParameterName& parameter_name, const PlotOptions& options)
-        -> util::Utf8String;
+        const param::ParameterName& parameter_name, const PlotOptions& options,
+        bool show_complexity_fit) -> util::Utf8String;
 
     //! Parameter name.
     param::ParameterName parameter_name_;
@@ -82,6 +88,9 @@ private:
     //! Options for the plot.
     PlotOptions options_;
 
+    //! Whether to show curves of models of asymptotic complexity.
+    bool show_complexity_fit_;
+
     //! Name for output files.
     util::Utf8String name_for_file_;
 };
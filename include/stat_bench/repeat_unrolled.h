@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of repeat_unrolled function.
+ */
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "stat_bench/bench_impl/threadable_invoker.h"
+
+namespace stat_bench {
+namespace impl {
+
+/*!
+ * \brief Invoke a function for consecutive indices.
+ *
+ * \tparam Func Type of the function.
+ * \tparam Offsets Offsets of indices.
+ * \param[in] func Function.
+ * \param[in] first_index First index.
+ */
+template <typename Func, std::size_t... Offsets>
+inline void invoke_for_indices(const Func& func, std::size_t first_index,
+    std::index_sequence<Offsets...> /*offsets*/) {
+    (bench_impl::invoke_and_ignore_return_value(func, first_index + Offsets),
+        ...);
+}
+
+}  // namespace impl
+
+/*!
+ * \brief Repeat a function with manual unrolling.
+ *
+ * The function is called with indices from zero to iterations - 1, and
+ * calls are unrolled by the given factor. Return values of the function are
+ * used to prevent optimization as in STAT_BENCH_MEASURE.
+ *
+ * \tparam Unroll Number of calls unrolled in a loop.
+ * \tparam Func Type of the function.
+ * \param[in] iterations Number of iterations.
+ * \param[in] func Function called with the index of the iteration.
+ */
+template <std::size_t Unroll = 1, typename Func>
+inline void repeat_unrolled(std::size_t iterations, const Func& func) {
+    static_assert(Unroll >= 1, "Unroll factor must be at least one.");
+    const std::size_t unrolled_iterations = iterations - iterations % Unroll;
+    std::size_t index = 0;
+    for (; index < unrolled_iterations; index += Unroll) {
+        impl::invoke_for_indices(
+            func, index, std::make_index_sequence<Unroll>());
+    }
+    for (; index < iterations; ++index) {
+        bench_impl::invoke_and_ignore_return_value(func, index);
+    }
+}
+
+}  // namespace stat_bench
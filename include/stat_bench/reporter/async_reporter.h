@@ -0,0 +1,215 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of AsyncReporter class.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "stat_bench/reporter/i_reporter.h"
+#include "stat_bench/util/spsc_queue.h"
+
+namespace stat_bench::reporter {
+
+/*!
+ * \brief Class of reporters to call other reporters in a separate thread.
+ *
+ * Events are passed to a thread of reporters via a lock-free queue
+ * in the order of calls, so that the thread of measurements is not disturbed
+ * by the I/O and computation in reporters.
+ * An exception thrown in a reporter is rethrown in the next call of a
+ * function of this class, and subsequent events are discarded.
+ * experiment_finished function waits for all events to be processed.
+ */
+class AsyncReporter final : public IReporter {
+public:
+    //! Default maximum number of events in the queue.
+    static constexpr std::size_t default_queue_capacity = 1024;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] reporters Reporters to call in the thread of reporters.
+     * \param[in] cpu_index Index of the CPU core to pin the thread of
+     * reporters. (No pinning if not specified.)
+     * \param[in] queue_capacity Maximum number of events in the queue.
+     */
+    explicit AsyncReporter(std::vector<std::shared_ptr<IReporter>> reporters,
+        std::optional<std::size_t> cpu_index = std::nullopt,
+        std::size_t queue_capacity = default_queue_capacity);
+
+    AsyncReporter(const AsyncReporter&) = delete;
+    AsyncReporter(AsyncReporter&&) = delete;
+    auto operator=(const AsyncReporter&) -> AsyncReporter& = delete;
+    auto operator=(AsyncReporter&&) -> AsyncReporter& = delete;
+
+    /*!
+     * \brief Destructor.
+     *
+     * This waits for remaining events to be processed.
+     */
+    ~AsyncReporter() override;
+
+    /*!
+     * \brief Add a reporter.
+     *
+     * \param[in] reporter Reporter.
+     *
+     * \warning This function must be called before any event is reported.
+     */
+    void add(std::shared_ptr<IReporter> reporter);
+
+    /*!
+     * \brief Wait for all events reported until now to be processed.
+     *
+     * \note Exceptions thrown in reporters are rethrown in this function.
+     */
+    void flush();
+
+    //! \copydoc stat_bench::reporter::IReporter::experiment_starts
+    void experiment_starts(const clock::SystemTimePoint& time_stamp) override;
+
+    //! \copydoc stat_bench::reporter::IReporter::experiment_finished
+    void experiment_finished(const clock::SystemTimePoint& time_stamp) override;
+
+    //! \copydoc stat_bench::reporter::IReporter::group_starts
+    void group_starts(const BenchmarkGroupName& name,
+        const bench_impl::BenchmarkGroupConfig& config) override;
+
+    //! \copydoc stat_bench::reporter::IReporter::group_finished
+    void group_finished(const BenchmarkGroupName& name) override;
+
+    //! \copydoc stat_bench::reporter::IReporter::measurement_type_starts
+    void measurement_type_starts(
+        const measurer::MeasurementType& type) override;
+
+    //! \copydoc stat_bench::reporter::IReporter::measurement_type_finished
+    void measurement_type_finished(
+        const measurer::MeasurementType& type) override;
+
+    //! \copydoc stat_bench::reporter::IReporter::case_starts
+    void case_starts(const BenchmarkFullName& case_info) override;
+
+    //! \copydoc stat_bench::reporter::IReporter::case_finished
+    void case_finished(const BenchmarkFullName& case_info) override;
+
+    //! \copydoc stat_bench::reporter::IReporter::measurement_succeeded
+    void measurement_succeeded(
+        const std::shared_ptr<const measurer::Measurement>& measurement)
+        override;
+
+    //! \copydoc stat_bench::reporter::IReporter::measurement_failed
+    void measurement_failed(const BenchmarkFullName& case_info,
+        const BenchmarkCondition& cond,
+        const std::exception_ptr& error) override;
+
+private:
+    //! Type of events.
+    using Event = std::function<void()>;
+
+    /*!
+     * \brief Push an event to the queue.
+     *
+     * \param[in] event Event.
+     */
+    void push(Event event);
+
+    /*!
+     * \brief Push an event to call reporters.
+     *
+     * \tparam Function Type of the function.
+     * \param[in] function Function to call for each reporter.
+     */
+    template <typename Function>
+    void push_to_reporters(Function function) {
+        push([this, function = std::move(function)] {
+            if (has_error_.load(std::memory_order_acquire)) {
+                // Events after errors are discarded.
+                return;
+            }
+            try {
+                for (const auto& reporter : reporters_) {
+                    function(*reporter);
+                }
+            } catch (...) {
+                error_ = std::current_exception();
+                has_error_.store(true, std::memory_order_release);
+            }
+        });
+    }
+
+    /*!
+     * \brief Rethrow an exception thrown in reporters if exists.
+     */
+    void rethrow_if_failed();
+
+    /*!
+     * \brief Process events in the thread of reporters.
+     *
+     * \param[in] cpu_index Index of the CPU core to pin the thread.
+     */
+    void process_events(std::optional<std::size_t> cpu_index);
+
+    /*!
+     * \brief Wait for an event in the thread of reporters.
+     *
+     * \param[out] event Event.
+     * \retval true An event is available.
+     * \retval false The thread should be stopped.
+     */
+    [[nodiscard]] auto wait_for_event(Event& event) -> bool;
+
+    //! Reporters.
+    std::vector<std::shared_ptr<IReporter>> reporters_;
+
+    //! Queue of events.
+    util::SpscQueue<Event> queue_;
+
+    //! Mutex for the thread of reporters to sleep.
+    std::mutex mutex_{};
+
+    //! Condition variable for the thread of reporters to sleep.
+    std::condition_variable condition_variable_{};
+
+    //! Whether the thread of reporters is sleeping.
+    std::atomic<bool> is_waiting_{false};
+
+    //! Whether to stop the thread of reporters.
+    std::atomic<bool> is_stopping_{false};
+
+    //! Whether an exception was thrown in reporters.
+    std::atomic<bool> has_error_{false};
+
+    //! Exception thrown in reporters.
+    std::exception_ptr error_{};
+
+    //! Thread of reporters.
+    std::thread thread_{};
+};
+
+}  // namespace stat_bench::reporter
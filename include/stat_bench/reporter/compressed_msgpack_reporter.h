@@ -22,11 +22,14 @@
 #include <string>
 
 #include "stat_bench/reporter/data_file_reporter_base.h"
+#include "stat_bench/util/parallel_gzip_writer.h"
 
 namespace stat_bench::reporter {
 
 /*!
  * \brief Class to write compressed MsgPack files.
+ *
+ * Files are compressed in gzip format using multiple threads.
  */
 class CompressedMsgPackReporter final : public DataFileReporterBase {
 public:
@@ -34,12 +37,20 @@ public:
      * \brief Constructor.
      *
      * \param[in] file_path File path.
+     * \param[in] compression_level Compression level. (1: fastest, 9:
+     * smallest.)
      */
-    explicit CompressedMsgPackReporter(std::string file_path);
+    explicit CompressedMsgPackReporter(std::string file_path,
+        int compression_level =
+            util::ParallelGzipWriter::default_compression_level);
 
     //! \copydoc stat_bench::reporter::DataFileReporterBase::write_data_file
     void write_data_file(const std::string& file_path,
         const data_file_spec::RootData& data) override;
+
+private:
+    //! Compression level.
+    int compression_level_;
 };
 
 }  // namespace stat_bench::reporter
@@ -22,7 +22,11 @@
 // IWYU pragma: no_include <cwchar>
 
 #include <cstdio>
+#include <memory>
+#include <vector>
 
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/param/parameter_name.h"
 #include "stat_bench/reporter/i_reporter.h"
 
 namespace stat_bench::reporter {
@@ -66,7 +70,8 @@ public:
 
     //! \copydoc stat_bench::reporter::IReporter::measurement_succeeded
     void measurement_succeeded(
-        const measurer::Measurement& measurement) override;
+        const std::shared_ptr<const measurer::Measurement>& measurement)
+        override;
 
     //! \copydoc stat_bench::reporter::IReporter::measurement_failed
     void measurement_failed(const BenchmarkFullName& case_info,
@@ -76,6 +81,12 @@ public:
 private:
     //! File pointer of the console.
     std::FILE* file_;
+
+    //! Parameters used to fit models of asymptotic complexity in the group.
+    std::vector<param::ParameterName> complexity_parameters_{};
+
+    //! Measurements of the current measurement type used in analyses.
+    std::vector<std::shared_ptr<const measurer::Measurement>> measurements_{};
 };
 
 }  // namespace stat_bench::reporter
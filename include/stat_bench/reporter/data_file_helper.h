@@ -15,7 +15,7 @@
  */
 /*!
  * \file
- * \brief Declaration of functions to help output of data files.
+ * \brief Declaration of functions to help input and output of data files.
  */
 #pragma once
 
@@ -26,10 +26,15 @@
 
 #include "stat_bench/clock/duration.h"
 #include "stat_bench/custom_output_name.h"
+#include "stat_bench/measurer/fit_complexity_by_case.h"
+#include "stat_bench/measurer/fit_iteration_regression.h"
 #include "stat_bench/measurer/measurement.h"
 #include "stat_bench/param/parameter_dict.h"
+#include "stat_bench/param/parameter_name.h"
 #include "stat_bench/reporter/data_file_spec.h"
 #include "stat_bench/stat/custom_stat_output.h"
+#include "stat_bench/stat/drift_diagnostics.h"
+#include "stat_bench/stat/linear_regression.h"
 #include "stat_bench/stat/statistics.h"
 #include "stat_bench/util/utf8_string.h"
 
@@ -52,16 +57,26 @@ namespace stat_bench::reporter::data_file_spec {
  */
 [[nodiscard]] auto convert(const stat::Statistics& stat) -> StatData;
 
+/*!
+ * \brief Convert to data for data files.
+ *
+ * \param[in] drift Diagnostics of drift.
+ * \return Converted data.
+ */
+[[nodiscard]] auto convert(const stat::DriftDiagnostics& drift) -> DriftData;
+
 /*!
  * \brief Convert to data for data files.
  *
  * \param[in] durations Durations.
  * \param[in] durations_stat Statistics of durations.
+ * \param[in] drift Diagnostics of drift.
  * \return Converted data.
  */
 [[nodiscard]] auto convert(
     const std::vector<std::vector<clock::Duration>>& durations,
-    const stat::Statistics& durations_stat) -> DurationData;
+    const stat::Statistics& durations_stat,
+    const stat::DriftDiagnostics& drift) -> DurationData;
 
 /*!
  * \brief Convert to data for data files.
@@ -105,4 +120,51 @@ namespace stat_bench::reporter::data_file_spec {
 [[nodiscard]] auto convert(const measurer::Measurement& measurement)
     -> MeasurementData;
 
+/*!
+ * \brief Convert to data for data files.
+ *
+ * \param[in] fit Result of fitting of complexity in a case.
+ * \param[in] parameter_name Name of the parameter used in fitting.
+ * \return Converted data.
+ */
+[[nodiscard]] auto convert(const measurer::CaseComplexityFit& fit,
+    const param::ParameterName& parameter_name) -> ComplexityFitData;
+
+/*!
+ * \brief Convert to data for data files.
+ *
+ * \param[in] result Result of linear regression.
+ * \return Converted data.
+ */
+[[nodiscard]] auto convert(const stat::LinearRegressionResult& result)
+    -> LinearRegressionData;
+
+/*!
+ * \brief Convert to data for data files.
+ *
+ * \param[in] measurement Measurement.
+ * \param[in] regression Result of linear regression of durations on numbers
+ * of iterations in the measurement.
+ * \return Converted data.
+ */
+[[nodiscard]] auto convert(const measurer::Measurement& measurement,
+    const measurer::IterationRegression& regression)
+    -> IterationRegressionData;
+
+/*!
+ * \brief Restore measurements from data in data files.
+ *
+ * Data files don't have types of parameters, so each parameter gets the
+ * narrowest type which can represent all of its values in the given data
+ * (boolean, unsigned integer, signed integer, floating-point number, or
+ * string). Data files don't have the order of parameters either, so the
+ * number of threads is placed first and the other parameters are sorted by
+ * their names.
+ *
+ * \param[in] data Data in data files.
+ * \return Measurements.
+ */
+[[nodiscard]] auto restore(const std::vector<MeasurementData>& data)
+    -> std::vector<measurer::Measurement>;
+
 }  // namespace stat_bench::reporter::data_file_spec
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of read_data_file function.
+ */
+#pragma once
+
+#include <string>
+
+#include "stat_bench/reporter/data_file_spec.h"
+
+namespace stat_bench::reporter {
+
+/*!
+ * \brief Read a data file written by reporters.
+ *
+ * JSON files and MsgPack files (compressed or not) are supported.
+ * The format is detected from the content of the file.
+ *
+ * \param[in] file_path File path.
+ * \return Data in the file.
+ */
+[[nodiscard]] auto read_data_file(const std::string& file_path)
+    -> data_file_spec::RootData;
+
+}  // namespace stat_bench::reporter
@@ -19,8 +19,13 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <vector>
 
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/param/parameter_name.h"
 #include "stat_bench/reporter/data_file_spec.h"
 #include "stat_bench/reporter/i_reporter.h"
 
@@ -73,7 +78,8 @@ public:
     void case_finished(const BenchmarkFullName& case_info) final;
 
     //! \copydoc stat_bench::reporter::IReporter::measurement_succeeded
-    void measurement_succeeded(const measurer::Measurement& measurement) final;
+    void measurement_succeeded(
+        const std::shared_ptr<const measurer::Measurement>& measurement) final;
 
     //! \copydoc stat_bench::reporter::IReporter::measurement_failed
     void measurement_failed(const BenchmarkFullName& case_info,
@@ -85,6 +91,20 @@ private:
 
     //! Data.
     data_file_spec::RootData data_{};
+
+    //! Parameters used to fit models of asymptotic complexity in the group.
+    std::vector<param::ParameterName> complexity_parameters_{};
+
+    /*!
+     * \brief Measurements.
+     *
+     * \note Measurements are converted to data when the experiment finishes,
+     * so data files don't hold copies of durations during the experiment.
+     */
+    std::vector<std::shared_ptr<const measurer::Measurement>> measurements_{};
+
+    //! Index of the first measurement of the current measurement type.
+    std::size_t first_measurement_of_type_{0};
 };
 
 }  // namespace stat_bench::reporter
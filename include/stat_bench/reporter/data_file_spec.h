@@ -54,6 +54,26 @@ struct StatData {
     float standard_error{};
 };
 
+/*!
+ * \brief Struct of diagnostics of drift across samples.
+ */
+struct DriftData {
+    //! Lag-1 autocorrelation of samples.
+    float lag1_autocorrelation{};
+
+    //! Statistic z of Mann-Kendall trend test.
+    float mann_kendall_z{};
+
+    //! p-value of Mann-Kendall trend test.
+    float mann_kendall_p_value{};
+
+    //! Effective sample size.
+    float effective_sample_size{};
+
+    //! Whether a drift was detected.
+    bool drifting{};
+};
+
 /*!
  * \brief Struct of durations.
  */
@@ -63,6 +83,9 @@ struct DurationData {
 
     //! Values.
     std::vector<std::vector<float>> values{};
+
+    //! Diagnostics of drift.
+    DriftData drift{};
 };
 
 /*!
@@ -112,6 +135,9 @@ struct MeasurementData {
     //! Number of samples.
     std::size_t samples{};
 
+    //! Number of samples for warming up.
+    std::size_t warming_up_samples{};
+
     //! Durations.
     DurationData durations{};
 
@@ -122,6 +148,96 @@ struct MeasurementData {
     std::vector<CustomOutputData> custom_outputs{};
 };
 
+/*!
+ * \brief Struct of results of fitting of models of asymptotic complexity.
+ */
+struct ComplexityFitData {
+    //! Name of group.
+    util::Utf8String group_name{};
+
+    //! Name of case.
+    util::Utf8String case_name{};
+
+    //! Name of measurer.
+    util::Utf8String measurement_type{};
+
+    //! Parameters other than the parameter used in fitting.
+    std::unordered_map<util::Utf8String, util::Utf8String> params{};
+
+    //! Name of the parameter used in fitting.
+    util::Utf8String parameter_name{};
+
+    //! Model. (For example, "O(n log n)".)
+    util::Utf8String model{};
+
+    //! Coefficient.
+    float coefficient{};
+
+    //! Exponent.
+    float exponent{};
+
+    //! Coefficient of determination.
+    float r_squared{};
+};
+
+/*!
+ * \brief Struct of results of linear regression.
+ */
+struct LinearRegressionData {
+    //! Slope.
+    float slope{};
+
+    //! Intercept.
+    float intercept{};
+
+    //! Lower bound of the 95% confidence interval of the slope.
+    float slope_lower{};
+
+    //! Upper bound of the 95% confidence interval of the slope.
+    float slope_upper{};
+
+    //! Coefficient of determination.
+    float r_squared{};
+};
+
+/*!
+ * \brief Struct of results of linear regression of durations on numbers of
+ * iterations.
+ */
+struct IterationRegressionData {
+    //! Name of group.
+    util::Utf8String group_name{};
+
+    //! Name of case.
+    util::Utf8String case_name{};
+
+    //! Name of measurer.
+    util::Utf8String measurement_type{};
+
+    //! Parameters.
+    std::unordered_map<util::Utf8String, util::Utf8String> params{};
+
+    //! Result of ordinary least squares. (Slope is in sec / iteration.)
+    LinearRegressionData ordinary_least_squares{};
+
+    //! Result of Theil-Sen estimator. (Slope is in sec / iteration.)
+    LinearRegressionData theil_sen{};
+};
+
+/*!
+ * \brief Struct of sizes of CPU caches.
+ */
+struct CacheSizesData {
+    //! Size of L1 data cache in bytes. (Zero if unknown.)
+    std::size_t l1d{};
+
+    //! Size of L2 cache in bytes. (Zero if unknown.)
+    std::size_t l2{};
+
+    //! Size of L3 cache in bytes. (Zero if unknown.)
+    std::size_t l3{};
+};
+
 /*!
  * \brief Struct of root objects in data files.
  */
@@ -132,8 +248,17 @@ struct RootData {
     //! Timestamp on end.
     util::Utf8String finished_at{};
 
+    //! Sizes of CPU caches.
+    CacheSizesData cache_sizes{};
+
     //! Measurements.
     std::vector<MeasurementData> measurements{};
+
+    //! Results of fitting of models of asymptotic complexity.
+    std::vector<ComplexityFitData> complexity_fits{};
+
+    //! Results of linear regression of durations on numbers of iterations.
+    std::vector<IterationRegressionData> iteration_regressions{};
 };
 
 }  // namespace stat_bench::reporter::data_file_spec
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <exception>
+#include <memory>
 
 #include "stat_bench/bench_impl/benchmark_group_config.h"
 #include "stat_bench/benchmark_condition.h"
@@ -104,7 +105,7 @@ public:
      * \param[in] measurement Measurement.
      */
     virtual void measurement_succeeded(
-        const measurer::Measurement& measurement) = 0;
+        const std::shared_ptr<const measurer::Measurement>& measurement) = 0;
 
     /*!
      * \brief Failed a measurement.
@@ -105,18 +105,39 @@ namespace stat_bench::reporter::data_file_spec {
 NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(StatData, mean, max, min, median, variance,
     standard_deviation, standard_error)
 
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(DurationData, stat, values)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(DriftData, lag1_autocorrelation,
+    mann_kendall_z, mann_kendall_p_value, effective_sample_size, drifting)
+
+// Data files of older versions don't have drift.
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(
+    DurationData, stat, values, drift)
 
 NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(CustomStatOutputData, name, stat, values)
 
 NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(CustomOutputData, name, value)
 
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(MeasurementData, group_name, case_name,
-    params, measurement_type, iterations, samples, durations,
-    custom_stat_outputs, custom_outputs)
+// Data files of older versions don't have warming_up_samples.
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(MeasurementData, group_name,
+    case_name, params, measurement_type, iterations, samples,
+    warming_up_samples, durations, custom_stat_outputs, custom_outputs)
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(ComplexityFitData, group_name, case_name,
+    measurement_type, params, parameter_name, model, coefficient, exponent,
+    r_squared)
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(LinearRegressionData, slope, intercept,
+    slope_lower, slope_upper, r_squared)
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(IterationRegressionData, group_name,
+    case_name, measurement_type, params, ordinary_least_squares, theil_sen)
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(CacheSizesData, l1d, l2, l3)
 
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(
-    RootData, started_at, finished_at, measurements)
+// Data files of older versions don't have cache_sizes, complexity_fits, and
+// iteration_regressions.
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(RootData, started_at,
+    finished_at, cache_sizes, measurements, complexity_fits,
+    iteration_regressions)
 
 #endif
 
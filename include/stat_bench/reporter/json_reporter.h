@@ -25,6 +25,17 @@
 
 namespace stat_bench::reporter {
 
+/*!
+ * \brief Enumeration of formats of JSON files.
+ */
+enum class JsonFormat {
+    //! Compact format without whitespaces.
+    compact,
+
+    //! Pretty format with indentation.
+    pretty
+};
+
 /*!
  * \brief Class to write JSON files.
  */
@@ -34,12 +45,18 @@ public:
      * \brief Constructor.
      *
      * \param[in] file_path File path.
+     * \param[in] format Format of JSON files.
      */
-    explicit JsonReporter(std::string file_path);
+    explicit JsonReporter(
+        std::string file_path, JsonFormat format = JsonFormat::pretty);
 
     //! \copydoc stat_bench::reporter::DataFileReporterBase::write_data_file
     void write_data_file(const std::string& file_path,
         const data_file_spec::RootData& data) override;
+
+private:
+    //! Format of JSON files.
+    JsonFormat format_;
 };
 
 }  // namespace stat_bench::reporter
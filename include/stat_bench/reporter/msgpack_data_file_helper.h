@@ -53,8 +53,11 @@ struct serialization_traits<stat_bench::util::Utf8String> {
 
 MSGPACK_LIGHT_STRUCT_MAP(stat_bench::reporter::data_file_spec::StatData, mean,
     max, min, median, variance, standard_deviation, standard_error);
+MSGPACK_LIGHT_STRUCT_MAP(stat_bench::reporter::data_file_spec::DriftData,
+    lag1_autocorrelation, mann_kendall_z, mann_kendall_p_value,
+    effective_sample_size, drifting);
 MSGPACK_LIGHT_STRUCT_MAP(
-    stat_bench::reporter::data_file_spec::DurationData, stat, values);
+    stat_bench::reporter::data_file_spec::DurationData, stat, values, drift);
 MSGPACK_LIGHT_STRUCT_MAP(
     stat_bench::reporter::data_file_spec::CustomStatOutputData, name, stat,
     values);
@@ -62,8 +65,21 @@ MSGPACK_LIGHT_STRUCT_MAP(
     stat_bench::reporter::data_file_spec::CustomOutputData, name, value);
 MSGPACK_LIGHT_STRUCT_MAP(stat_bench::reporter::data_file_spec::MeasurementData,
     group_name, case_name, params, measurement_type, iterations, samples,
-    durations, custom_stat_outputs, custom_outputs);
+    warming_up_samples, durations, custom_stat_outputs, custom_outputs);
+MSGPACK_LIGHT_STRUCT_MAP(
+    stat_bench::reporter::data_file_spec::ComplexityFitData, group_name,
+    case_name, measurement_type, params, parameter_name, model, coefficient,
+    exponent, r_squared);
+MSGPACK_LIGHT_STRUCT_MAP(
+    stat_bench::reporter::data_file_spec::LinearRegressionData, slope,
+    intercept, slope_lower, slope_upper, r_squared);
+MSGPACK_LIGHT_STRUCT_MAP(
+    stat_bench::reporter::data_file_spec::IterationRegressionData, group_name,
+    case_name, measurement_type, params, ordinary_least_squares, theil_sen);
+MSGPACK_LIGHT_STRUCT_MAP(
+    stat_bench::reporter::data_file_spec::CacheSizesData, l1d, l2, l3);
 MSGPACK_LIGHT_STRUCT_MAP(stat_bench::reporter::data_file_spec::RootData,
-    started_at, finished_at, measurements);
+    started_at, finished_at, cache_sizes, measurements, complexity_fits,
+    iteration_regressions);
 
 #endif
@@ -19,6 +19,7 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -26,23 +27,56 @@
 #include "stat_bench/benchmark_group_name.h"
 #include "stat_bench/measurer/measurement.h"
 #include "stat_bench/measurer/measurement_type.h"
+#include "stat_bench/plots/decimate_samples.h"
 #include "stat_bench/plots/i_plot.h"
 #include "stat_bench/reporter/i_reporter.h"
 #include "stat_bench/util/utf8_string.h"
+#include "stat_bench/util/worker_pool.h"
 
 namespace stat_bench::reporter {
 
 /*!
  * \brief Class to generate plots of measurement results.
+ *
+ * Plots are rendered in worker threads when the number of threads is
+ * positive, so that rendering of plots runs concurrently with later
+ * measurements. experiment_finished function waits for all plots to be
+ * written.
  */
 class PlotReporter final : public IReporter {
 public:
+    //! Default number of threads to render plots.
+    static constexpr std::size_t default_num_threads = 1;
+
     /*!
      * \brief Constructor.
      *
      * \param[in] prefix File prefix.
+     * \param[in] max_points_per_trace Maximum number of points per trace in
+     * plots of samples. (0 for no limit.)
+     * \param[in] num_threads Number of threads to render plots. (0 to render
+     * plots in the thread calling this reporter.)
+     * \param[in] cpu_indices Indices of CPU cores to run threads rendering
+     * plots. (No restriction if empty.)
+     * \param[in] density_plot_threshold Number of samples in a measurement
+     * above which a plot of probability density replaces the violin plot.
+     * (0 for no replacement.)
+     */
+    explicit PlotReporter(std::string prefix,
+        std::size_t max_points_per_trace = plots::default_max_points_per_trace,
+        std::size_t num_threads = default_num_threads,
+        std::vector<std::size_t> cpu_indices = {},
+        std::size_t density_plot_threshold = 0);
+
+    PlotReporter(const PlotReporter&) = delete;
+    PlotReporter(PlotReporter&&) = delete;
+    auto operator=(const PlotReporter&) -> PlotReporter& = delete;
+    auto operator=(PlotReporter&&) -> PlotReporter& = delete;
+
+    /*!
+     * \brief Destructor.
      */
-    explicit PlotReporter(std::string prefix);
+    ~PlotReporter() override;
 
     //! \copydoc stat_bench::reporter::IReporter::experiment_starts
     void experiment_starts(const clock::SystemTimePoint& time_stamp) override;
@@ -71,7 +105,8 @@ public:
 
     //! \copydoc stat_bench::reporter::IReporter::measurement_succeeded
     void measurement_succeeded(
-        const measurer::Measurement& measurement) override;
+        const std::shared_ptr<const measurer::Measurement>& measurement)
+        override;
 
     //! \copydoc stat_bench::reporter::IReporter::measurement_failed
     void measurement_failed(const BenchmarkFullName& case_info,
@@ -92,13 +127,26 @@ private:
     util::Utf8String measurement_type_for_file_paths_;
 
     //! Measurements.
-    std::vector<measurer::Measurement> measurements_{};
+    std::vector<std::shared_ptr<const measurer::Measurement>> measurements_{};
 
     //! Builtin plots.
     std::vector<std::shared_ptr<plots::IPlot>> builtin_plots_{};
 
+    //! Builtin violin plot.
+    std::shared_ptr<plots::IPlot> violin_plot_{};
+
+    //! Plot of probability density replacing the violin plot. (Null for no
+    //! replacement.)
+    std::shared_ptr<plots::IPlot> density_plot_{};
+
+    //! Number of samples above which density_plot_ replaces violin_plot_.
+    std::size_t density_plot_threshold_;
+
     //! Plots in groups.
     std::vector<std::shared_ptr<plots::IPlot>> group_plots_{};
+
+    //! Worker threads to render plots. (Null to render in the caller.)
+    std::unique_ptr<util::WorkerPool> worker_pool_{};
 };
 
 }  // namespace stat_bench::reporter
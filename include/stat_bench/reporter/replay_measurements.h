@@ -0,0 +1,51 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of replay_measurements function.
+ */
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "stat_bench/bench_impl/benchmark_group_config.h"
+#include "stat_bench/benchmark_group_name.h"
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/reporter/i_reporter.h"
+
+namespace stat_bench::reporter {
+
+/*!
+ * \brief Type of functions to configure groups of benchmarks.
+ */
+using GroupConfigurator = std::function<void(
+    const BenchmarkGroupName&, bench_impl::BenchmarkGroupConfig&)>;
+
+/*!
+ * \brief Report measurements again as in an experiment.
+ *
+ * Measurements are reported by groups and measurement types in the order of
+ * their first appearance in the given measurements.
+ *
+ * \param[in] measurements Measurements (for example, restored from data files).
+ * \param[in] reporter Reporter.
+ * \param[in] configure_group Function to configure each group.
+ */
+void replay_measurements(std::vector<measurer::Measurement> measurements,
+    IReporter& reporter, const GroupConfigurator& configure_group);
+
+}  // namespace stat_bench::reporter
@@ -20,9 +20,13 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#include "stat_bench/param/parameter_sampling.h"
+#include "stat_bench/util/parallel_gzip_writer.h"
+
 namespace stat_bench::runner {
 
 namespace impl {
@@ -42,6 +46,16 @@ static constexpr std::size_t default_min_warming_up_iterations = 1;
 //! Default minimum duration for warming up. [sec]
 static constexpr double default_min_warming_up_duration_sec = 0.03;
 
+//! Default compression level of compressed MsgPack data files.
+static constexpr int default_compression_level =
+    util::ParallelGzipWriter::default_compression_level;
+
+//! Default maximum number of points per trace in plots.
+static constexpr std::size_t default_plot_max_points = 10000;
+
+//! Default number of threads to render plots.
+static constexpr std::size_t default_plot_threads = 1;
+
 }  // namespace impl
 
 /*!
@@ -75,6 +89,35 @@ struct Config {
      */
     std::string plot_prefix{};
 
+    /*!
+     * \brief Maximum number of points per trace in plots of samples.
+     *
+     * Zero specifies no limit.
+     */
+    std::size_t plot_max_points{impl::default_plot_max_points};
+
+    /*!
+     * \brief Number of threads to render plots.
+     *
+     * Zero specifies rendering in the thread of reporters.
+     */
+    std::size_t plot_threads{impl::default_plot_threads};
+
+    /*!
+     * \brief Indices of CPU cores to run threads rendering plots.
+     *
+     * Empty vector specifies no restriction.
+     */
+    std::vector<std::size_t> plot_cpus{};
+
+    /*!
+     * \brief Number of samples in a case above which a plot of probability
+     * density replaces the violin plot.
+     *
+     * Zero specifies no replacement.
+     */
+    std::size_t plot_density_threshold{0};
+
     /*!
      * \brief File path of JSON data file.
      *
@@ -82,6 +125,9 @@ struct Config {
      */
     std::string json_file_path{};
 
+    //! Whether to write JSON data file in compact format.
+    bool json_compact{false};
+
     /*!
      * \brief File path of MsgPack data file.
      *
@@ -96,6 +142,58 @@ struct Config {
      */
     std::string compressed_msgpack_file_path{};
 
+    //! Compression level of compressed MsgPack data file.
+    int compression_level{impl::default_compression_level};
+
+    /*!
+     * \brief Whether to call reporters in the thread of measurements.
+     *
+     * Reporters are called in a separate thread by default.
+     */
+    bool sync_reporters{false};
+
+    /*!
+     * \brief Index of the CPU core to pin the thread of reporters.
+     *
+     * Negative value specifies no pinning.
+     */
+    int reporter_cpu{-1};
+
+    /*!
+     * \brief Method to sample combinations of parameters.
+     *
+     * Empty string specifies the method set in each fixture.
+     */
+    std::string param_sampling{};
+
+    /*!
+     * \brief Maximum number of combinations of parameters per case.
+     *
+     * Zero specifies the value set in each fixture. Non-zero values require
+     * param_sampling.
+     */
+    std::size_t max_conditions{0};
+
+    //! Seed of random numbers used in sampling of parameters. (Values other
+    //! than the default require param_sampling.)
+    std::uint32_t param_sampling_seed{param::default_parameter_sampling_seed};
+
+    /*!
+     * \brief Numbers of threads used instead of values generated from the
+     * topology of CPUs.
+     *
+     * Empty vector specifies the generated values.
+     */
+    std::vector<std::size_t> threads{};
+
+    /*!
+     * \brief Maximum number of threads in values generated from the topology
+     * of CPUs.
+     *
+     * Zero specifies no limit.
+     */
+    std::size_t max_threads{0};
+
     //! Glob patterns of benchmark names to include.
     std::vector<std::string> include_glob{};
 
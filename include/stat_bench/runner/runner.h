@@ -19,7 +19,9 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -27,7 +29,13 @@
 #include "stat_bench/bench_impl/i_benchmark_case.h"
 #include "stat_bench/benchmark_condition.h"
 #include "stat_bench/measurement_config.h"
+#include "stat_bench/measurer/measurement.h"
 #include "stat_bench/measurer/measurer.h"
+#include "stat_bench/param/parameter_config.h"
+#include "stat_bench/param/parameter_name.h"
+#include "stat_bench/param/parameter_sampling.h"
+#include "stat_bench/param/parameter_value_vector.h"
+#include "stat_bench/reporter/async_reporter.h"
 #include "stat_bench/reporter/i_reporter.h"
 #include "stat_bench/runner/config.h"
 
@@ -73,6 +81,10 @@ public:
      * \param[in] reporter Reporter.
      */
     void add(std::shared_ptr<reporter::IReporter> reporter) {
+        if (async_reporter_) {
+            async_reporter_->add(std::move(reporter));
+            return;
+        }
         reporters_.push_back(std::move(reporter));
     }
 
@@ -91,17 +103,39 @@ private:
     void run_case(const std::shared_ptr<bench_impl::IBenchmarkCase>& bench_case,
         const MeasurementConfig& measurement_config) const;
 
+    /*!
+     * \brief Measure a case with additional values of a parameter inserted
+     * by adaptive refinement.
+     *
+     * \param[in] bench_case Case.
+     * \param[in] measurement_config Measurement configuration.
+     * \param[in] params Configuration of parameters.
+     * \param[in] param_name Name of the parameter to refine.
+     * \param[in] values Values of the parameter to refine.
+     * \param[in,out] measurements Measurements of the case.
+     */
+    void refine_case(
+        const std::shared_ptr<bench_impl::IBenchmarkCase>& bench_case,
+        const MeasurementConfig& measurement_config,
+        const param::ParameterConfig& params,
+        const param::ParameterName& param_name,
+        const param::IParameterValueVector& values,
+        std::vector<std::shared_ptr<const measurer::Measurement>>&
+            measurements) const;
+
     /*!
      * \brief Run a case.
      *
      * \param[in] bench_case Case.
      * \param[in] condition Condition.
      * \param[in] measurement_config Measurement configuration.
+     * \return Measurement. (Null if the measurement failed.)
      */
-    void run_case_with_condition(
+    auto run_case_with_condition(
         const std::shared_ptr<bench_impl::IBenchmarkCase>& bench_case,
         const BenchmarkCondition& condition,
-        const MeasurementConfig& measurement_config) const;
+        const MeasurementConfig& measurement_config) const
+        -> std::shared_ptr<const measurer::Measurement>;
 
     //! Measurer.
     measurer::Measurer measurer_;
@@ -109,8 +143,26 @@ private:
     //! Reporters.
     std::vector<std::shared_ptr<reporter::IReporter>> reporters_{};
 
+    //! Reporter to call reporters in a separate thread.
+    std::shared_ptr<reporter::AsyncReporter> async_reporter_{};
+
     //! Registry.
     bench_impl::BenchmarkCaseRegistry& registry_;
+
+    /*!
+     * \brief Configuration of sampling of parameters overriding fixtures.
+     *
+     * Null specifies to use the configuration in each fixture.
+     */
+    std::optional<param::ParameterSamplingConfig> param_sampling_{};
+
+    /*!
+     * \brief Numbers of threads overriding values generated from the
+     * topology of CPUs in fixtures.
+     *
+     * Empty vector specifies to use the values in each fixture.
+     */
+    std::vector<std::size_t> auto_threads_{};
 };
 
 }  // namespace stat_bench::runner
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of functions to fit models of asymptotic complexity.
+ */
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace stat_bench::stat {
+
+/*!
+ * \brief Enumeration of models of asymptotic complexity.
+ */
+enum class ComplexityModel : std::uint8_t {
+    constant,      //!< O(1).
+    logarithmic,   //!< O(log n).
+    linear,        //!< O(n).
+    linearithmic,  //!< O(n log n).
+    quadratic,     //!< O(n^2).
+    power          //!< O(n^k) with a fitted exponent k.
+};
+
+/*!
+ * \brief Get the string expression of a model of asymptotic complexity.
+ *
+ * \param[in] model Model.
+ * \return String expression. (For example, "O(n log n)".)
+ */
+[[nodiscard]] auto to_string(ComplexityModel model) -> std::string;
+
+/*!
+ * \brief Struct of results of fitting of models of asymptotic complexity.
+ *
+ * Fitted models are coefficient * f(n), where f(n) is log(n), n, n log(n),
+ * n^2, or n^exponent. Logarithms are natural logarithms.
+ */
+struct ComplexityFitResult {
+    //! Model.
+    ComplexityModel model{ComplexityModel::constant};
+
+    //! Coefficient.
+    double coefficient{0.0};
+
+    //! Exponent of n. (Fitted only for ComplexityModel::power.)
+    double exponent{0.0};
+
+    //! Coefficient of determination (R^2) weighted in the same way as fitting.
+    double r_squared{0.0};
+};
+
+/*!
+ * \brief Format a fitted model of asymptotic complexity.
+ *
+ * \param[in] result Result of fitting.
+ * \return String expression. (Same as to_string(ComplexityModel) except for
+ * ComplexityModel::power, which is formatted with the fitted exponent like
+ * "O(n^1.52)".)
+ */
+[[nodiscard]] auto format_complexity(const ComplexityFitResult& result)
+    -> std::string;
+
+/*!
+ * \brief Evaluate a fitted model.
+ *
+ * \param[in] result Result of fitting.
+ * \param[in] n Value of the parameter.
+ * \return Value of the model.
+ */
+[[nodiscard]] auto evaluate_complexity_model(
+    const ComplexityFitResult& result, double n) -> double;
+
+/*!
+ * \brief Fit a model of asymptotic complexity using weighted least squares.
+ *
+ * Weights are the inverse of squared standard errors of times. When some
+ * standard errors are not positive, relative errors are used instead.
+ * Fixed models are fitted in the linear scale, and ComplexityModel::power
+ * is fitted in the log scale.
+ *
+ * \param[in] model Model.
+ * \param[in] sizes Values of the parameter. (Must be positive.)
+ * \param[in] times Mean times.
+ * \param[in] errors Standard errors of times.
+ * \return Result.
+ */
+[[nodiscard]] auto fit_complexity_model(ComplexityModel model,
+    const std::vector<double>& sizes, const std::vector<double>& times,
+    const std::vector<double>& errors) -> ComplexityFitResult;
+
+/*!
+ * \brief Fit models of asymptotic complexity and select the best one.
+ *
+ * The model with the smallest Akaike information criterion calculated from
+ * the weighted residuals is selected, so ComplexityModel::power is
+ * selected only when its additional parameter improves the fit enough.
+ *
+ * \param[in] sizes Values of the parameter.
+ * \param[in] times Mean times.
+ * \param[in] errors Standard errors of times.
+ * \return Result of the best model. (Null if the number of points with
+ * positive values of the parameter is less than three.)
+ */
+[[nodiscard]] auto fit_complexity(const std::vector<double>& sizes,
+    const std::vector<double>& times, const std::vector<double>& errors)
+    -> std::optional<ComplexityFitResult>;
+
+}  // namespace stat_bench::stat
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of CustomStatAccumulator class.
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace stat_bench::stat {
+
+/*!
+ * \brief Class of handles to add values of a custom output with statistics
+ * in a thread.
+ *
+ * Objects of this class are created by
+ * stat_bench::stat::CustomStatOutput::accumulator function once per thread,
+ * and add values to memory used only by the thread without checks of
+ * indices.
+ */
+class CustomStatAccumulator {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] values Values of samples of the thread (including samples
+     * for warming up).
+     */
+    explicit CustomStatAccumulator(double* values) noexcept : values_(values) {}
+
+    /*!
+     * \brief Add a value.
+     *
+     * \warning The index of the sample is not checked.
+     *
+     * \param[in] sample_index Index of the sample.
+     * \param[in] val Value of the current iteration.
+     */
+    void add(std::size_t sample_index, double val) const noexcept {
+        values_[sample_index] += val;  // NOLINT
+    }
+
+private:
+    //! Values of samples of the thread.
+    double* values_;
+};
+
+}  // namespace stat_bench::stat
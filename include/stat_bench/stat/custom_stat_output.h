@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -29,8 +30,10 @@
 #include "stat_bench/clock/monotone_time_point.h"
 #include "stat_bench/custom_output_name.h"
 #include "stat_bench/stat/calc_stat.h"
+#include "stat_bench/stat/custom_stat_accumulator.h"
 #include "stat_bench/stat/statistics.h"
 #include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/aligned_buffer.h"
 
 namespace stat_bench::stat {
 
@@ -75,11 +78,24 @@ public:
         for (std::size_t i = 0; i < threads_; ++i) {
             data_.emplace_back(used_samples, 0.0);
         }
+
+        // Rows of threads start at cache lines and are separated by an
+        // additional cache line to avoid false sharing, including one caused
+        // by prefetching of adjacent lines.
+        constexpr std::size_t values_per_line =
+            util::cache_line_size / sizeof(double);
+        const std::size_t lines_per_row =
+            (samples_ + values_per_line - 1U) / values_per_line;
+        thread_stride_ = (lines_per_row + 1U) * values_per_line;
     }
 
     /*!
      * \brief Add a value.
      *
+     * \note This function checks indices. Use accumulator function to get
+     * a faster handle for each thread when values are added in threads or in
+     * short measured functions.
+     *
      * \param[in] thread_index Index of the thread.
      * \param[in] sample_index Index of the sample.
      * \param[in] val Value of the current iteration.
@@ -91,6 +107,33 @@ public:
         data_.at(thread_index).at(sample_index - warming_up_samples_) += val;
     }
 
+    /*!
+     * \brief Get the handle to add values in a thread.
+     *
+     * \note Get the handle once in each thread before measurement, and use
+     * it in measured functions instead of add function. Memory for handles of
+     * all threads is allocated in the first call of this function, so outputs
+     * using only add function don't allocate it.
+     *
+     * \param[in] thread_index Index of the thread.
+     * \return Handle.
+     */
+    [[nodiscard]] auto accumulator(std::size_t thread_index) const
+        -> CustomStatAccumulator {
+        if (thread_index >= threads_) {
+            throw StatBenchException("Invalid index of a thread.");
+        }
+        // Memory for accumulators is allocated only when they're used.
+        std::call_once(thread_values_allocated_, [this] {
+            util::BufferOptions options;
+            options.prefault = true;  // Fill with zeros.
+            thread_values_ = util::AlignedBuffer(
+                threads_ * thread_stride_ * sizeof(double), options);
+        });
+        return CustomStatAccumulator(thread_values_.as_array<double>() +
+            thread_index * thread_stride_);  // NOLINT
+    }
+
     /*!
      * \brief Preprocess data.
      *
@@ -98,11 +141,11 @@ public:
      */
     void preprocess(
         const std::vector<std::vector<clock::Duration>>& durations) {
+        merge_thread_values();
         const std::size_t used_samples = samples_ - warming_up_samples_;
         for (std::size_t i = 0; i < threads_; ++i) {
             for (std::size_t j = 0; j < used_samples; ++j) {
                 double& val = data_.at(i).at(j);
-
                 static const double minimum_duration =
                     clock::MonotoneTimePoint::resolution().seconds();
                 switch (analysis_type_) {
@@ -118,6 +161,27 @@ public:
         }
     }
 
+    /*!
+     * \brief Divide values in samples.
+     *
+     * \note This is used when samples have different numbers of iterations,
+     * and must be called before preprocess function.
+     *
+     * \param[in] divisors Divisor of each sample (except for warming up).
+     */
+    void divide_samples(const std::vector<double>& divisors) {
+        const std::size_t used_samples = samples_ - warming_up_samples_;
+        if (divisors.size() != used_samples) {
+            throw StatBenchException("Invalid number of divisors.");
+        }
+        merge_thread_values();
+        for (auto& thread_data : data_) {
+            for (std::size_t j = 0; j < used_samples; ++j) {
+                thread_data[j] /= divisors[j];
+            }
+        }
+    }
+
     /*!
      * \brief Calculate statistics.
      *
@@ -145,6 +209,26 @@ public:
     }
 
 private:
+    /*!
+     * \brief Move values added using accumulators to data.
+     */
+    void merge_thread_values() {
+        if (thread_values_.data() == nullptr) {
+            return;
+        }
+        const std::size_t used_samples = samples_ - warming_up_samples_;
+        for (std::size_t i = 0; i < threads_; ++i) {
+            double* thread_values = thread_values_.as_array<double>() +
+                i * thread_stride_;  // NOLINT
+            for (std::size_t j = 0; j < used_samples; ++j) {
+                data_.at(i).at(j) +=
+                    thread_values[warming_up_samples_ + j];  // NOLINT
+            }
+            std::fill(thread_values, thread_values + samples_,  // NOLINT
+                0.0);
+        }
+    }
+
     //! Name.
     CustomOutputName name_;
 
@@ -165,6 +249,15 @@ private:
 
     //! Type of analysis.
     CustomOutputAnalysisType analysis_type_;
+
+    //! Number of values between rows of threads in thread_values_.
+    std::size_t thread_stride_{0};
+
+    //! Values added using accumulators in rows of threads.
+    mutable util::AlignedBuffer thread_values_{};
+
+    //! Flag of allocation of thread_values_.
+    mutable std::once_flag thread_values_allocated_{};
 };
 
 }  // namespace stat_bench::stat
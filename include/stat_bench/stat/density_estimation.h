@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of functions to estimate probability density.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace stat_bench::stat {
+
+/*!
+ * \brief Struct of curves of probability density.
+ *
+ * When densities are calculated in the log scale, densities are per unit of
+ * the common logarithm of values so that the area under the curve in the log
+ * scale is one.
+ */
+struct DensityCurve {
+    //! Points at which densities are calculated.
+    std::vector<double> points{};
+
+    //! Densities.
+    std::vector<double> densities{};
+};
+
+/*!
+ * \brief Struct of histograms.
+ *
+ * Densities are normalized in the same way as DensityCurve.
+ */
+struct Histogram {
+    //! Edges of bins. (Number of bins + 1 elements.)
+    std::vector<double> edges{};
+
+    //! Densities in bins.
+    std::vector<double> densities{};
+};
+
+/*!
+ * \brief Calculate the bandwidth of Gaussian kernel density estimation using
+ * Silverman's rule of thumb.
+ *
+ * \param[in] sorted_values Sorted values.
+ * \return Bandwidth. (Zero if values don't have spread.)
+ */
+[[nodiscard]] auto calc_silverman_bandwidth(
+    const std::vector<double>& sorted_values) -> double;
+
+/*!
+ * \brief Estimate probability density using Gaussian kernels.
+ *
+ * Values are linearly binned to evenly spaced grid points before
+ * convolution with kernels, so the computational cost is almost independent
+ * of the number of values.
+ *
+ * \param[in] sorted_values Sorted values.
+ * \param[in] num_points Number of points at which densities are calculated.
+ * \param[in] log_scale Whether to estimate densities in the log scale.
+ * (Non-positive values are ignored in the log scale.)
+ * \return Curve of probability density. (Empty if no value is usable.)
+ */
+[[nodiscard]] auto estimate_density(const std::vector<double>& sorted_values,
+    std::size_t num_points, bool log_scale) -> DensityCurve;
+
+/*!
+ * \brief Calculate a histogram.
+ *
+ * \param[in] sorted_values Sorted values.
+ * \param[in] num_bins Number of bins.
+ * \param[in] log_scale Whether to use log-spaced bins.
+ * (Non-positive values are ignored in the log scale.)
+ * \return Histogram. (Empty if no value is usable.)
+ */
+[[nodiscard]] auto calc_histogram(const std::vector<double>& sorted_values,
+    std::size_t num_bins, bool log_scale) -> Histogram;
+
+}  // namespace stat_bench::stat
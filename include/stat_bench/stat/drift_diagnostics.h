@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of functions to diagnose drifts of samples.
+ */
+#pragma once
+
+#include <vector>
+
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/stat/statistics.h"
+
+namespace stat_bench::stat {
+
+//! Default significance level of trend tests to flag drifts.
+static constexpr double default_drift_significance_level = 0.01;
+
+/*!
+ * \brief Struct of diagnostics of drifts and autocorrelation of samples.
+ */
+struct DriftDiagnostics {
+    //! Lag-1 autocorrelation of samples.
+    double lag1_autocorrelation{0.0};
+
+    //! Standardized statistic of Mann-Kendall trend test. (Positive for
+    //! increasing trends.)
+    double mann_kendall_z{0.0};
+
+    //! Two-sided p-value of Mann-Kendall trend test.
+    double mann_kendall_p_value{1.0};
+
+    //! Effective sample size.
+    double effective_sample_size{0.0};
+
+    //! Whether a significant trend is detected.
+    bool drifting{false};
+};
+
+/*!
+ * \brief Diagnose drifts and autocorrelation of durations in the order of
+ * samples.
+ *
+ * Durations are summed over threads in each sample, and Mann-Kendall trend
+ * test and lag-1 autocorrelation r are calculated for the series. The
+ * effective sample size is calculated as N (1 - r) / (1 + r) for positive r
+ * using AR(1) model, where N is the number of all durations in threads, and
+ * is N for non-positive r.
+ *
+ * \param[in] durations Durations in threads.
+ * \param[in] significance_level Significance level of the trend test.
+ * \return Diagnostics.
+ */
+[[nodiscard]] auto diagnose_drift(
+    const std::vector<std::vector<clock::Duration>>& durations,
+    double significance_level = default_drift_significance_level)
+    -> DriftDiagnostics;
+
+/*!
+ * \brief Adjust the standard error in statistics using the effective sample
+ * size.
+ *
+ * \param[in] stat Statistics calculated assuming independent samples.
+ * \param[in] diagnostics Diagnostics of the same samples.
+ * \return Statistics with the adjusted standard error.
+ */
+[[nodiscard]] auto adjust_standard_error(
+    const Statistics& stat, const DriftDiagnostics& diagnostics) -> Statistics;
+
+}  // namespace stat_bench::stat
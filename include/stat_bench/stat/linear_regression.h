@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions of linear regression.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace stat_bench::stat {
+
+/*!
+ * \brief Struct of results of linear regression y = slope * x + intercept.
+ */
+struct LinearRegressionResult {
+    //! Slope.
+    double slope{0.0};
+
+    //! Intercept.
+    double intercept{0.0};
+
+    //! Lower bound of the 95% confidence interval of the slope.
+    double slope_lower{0.0};
+
+    //! Upper bound of the 95% confidence interval of the slope.
+    double slope_upper{0.0};
+
+    //! Coefficient of determination (R^2).
+    double r_squared{0.0};
+};
+
+/*!
+ * \brief Fit a line using ordinary least squares.
+ *
+ * The confidence interval of the slope is calculated using Student's
+ * t-distribution.
+ *
+ * \param[in] x Values of the explanatory variable.
+ * \param[in] y Values of the response variable.
+ * \return Result.
+ */
+[[nodiscard]] auto fit_ordinary_least_squares(const std::vector<double>& x,
+    const std::vector<double>& y) -> LinearRegressionResult;
+
+/*!
+ * \brief Maximum number of pairs of points used in Theil-Sen estimator.
+ *
+ * When more pairs exist, this number of pairs is sampled randomly with a fixed
+ * seed to bound memory and time.
+ */
+constexpr std::size_t max_theil_sen_pairs = static_cast<std::size_t>(1)
+    << 20U;  // NOLINT
+
+/*!
+ * \brief Fit a line using Theil-Sen estimator.
+ *
+ * The slope is the median of slopes between all pairs of points, and the
+ * intercept is the median of y - slope * x, so the result is robust to
+ * outliers. The confidence interval of the slope is calculated using Sen's
+ * method from the distribution of Kendall's tau.
+ *
+ * When the number of pairs exceeds max_theil_sen_pairs, slopes of randomly
+ * sampled pairs are used instead, and the ranks of bounds of the confidence
+ * interval are scaled to the number of sampled pairs.
+ *
+ * \param[in] x Values of the explanatory variable.
+ * \param[in] y Values of the response variable.
+ * \return Result.
+ */
+[[nodiscard]] auto fit_theil_sen(const std::vector<double>& x,
+    const std::vector<double>& y) -> LinearRegressionResult;
+
+}  // namespace stat_bench::stat
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to fit models of scalability with respect to
+ * the number of threads.
+ */
+#pragma once
+
+#include <vector>
+
+namespace stat_bench::stat {
+
+/*!
+ * \brief Struct of results of fitting of models of scalability.
+ *
+ * Fitted models are the Universal Scalability Law (USL),
+ * S(N) = N / (1 + sigma * (N - 1) + kappa * N * (N - 1)),
+ * and Amdahl's law, which is the USL with kappa = 0, where S(N) is the
+ * speedup with N threads.
+ */
+struct ScalabilityFitResult {
+    //! Contention coefficient. (sigma, serial fraction in Amdahl's law.)
+    double contention{0.0};
+
+    //! Coherency coefficient. (kappa, zero in Amdahl's law.)
+    double coherency{0.0};
+
+    //! Coefficient of determination (R^2) of speedups.
+    double r_squared{0.0};
+};
+
+/*!
+ * \brief Evaluate the speedup in a fitted model.
+ *
+ * \param[in] result Result of fitting.
+ * \param[in] num_threads Number of threads.
+ * \return Speedup.
+ */
+[[nodiscard]] auto evaluate_scalability_model(
+    const ScalabilityFitResult& result, double num_threads) -> double;
+
+/*!
+ * \brief Calculate the number of threads with the maximum speedup in a fitted
+ * model.
+ *
+ * \param[in] result Result of fitting.
+ * \return Number of threads. (Infinity if the speedup increases
+ * monotonically.)
+ */
+[[nodiscard]] auto calc_peak_num_threads(const ScalabilityFitResult& result)
+    -> double;
+
+/*!
+ * \brief Fit Amdahl's law to speedups.
+ *
+ * \param[in] nums_threads Numbers of threads.
+ * \param[in] speedups Speedups relative to one thread.
+ * \return Result.
+ */
+[[nodiscard]] auto fit_amdahl(const std::vector<double>& nums_threads,
+    const std::vector<double>& speedups) -> ScalabilityFitResult;
+
+/*!
+ * \brief Fit the Universal Scalability Law to speedups.
+ *
+ * Coefficients are fitted using least squares of the linearized form
+ * N / S(N) - 1 = sigma * (N - 1) + kappa * N * (N - 1), and are
+ * constrained to be non-negative.
+ *
+ * \param[in] nums_threads Numbers of threads.
+ * \param[in] speedups Speedups relative to one thread.
+ * \return Result.
+ */
+[[nodiscard]] auto fit_usl(const std::vector<double>& nums_threads,
+    const std::vector<double>& speedups) -> ScalabilityFitResult;
+
+}  // namespace stat_bench::stat
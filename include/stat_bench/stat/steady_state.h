@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of functions to detect steady states.
+ */
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace stat_bench::stat {
+
+//! Default size of batches in MSER.
+static constexpr std::size_t default_mser_batch_size = 5;
+
+/*!
+ * \brief Detect the end of the initial transient in a time series using
+ * Marginal Standard Error Rule (MSER).
+ *
+ * Values are averaged in batches, and the number of truncated batches d is
+ * selected to minimize the sum of squared deviations of the remaining m - d
+ * batches divided by (m - d)^2. The series is judged to reach a steady state
+ * only when the selected point is in the first half of the batches, because
+ * a point in the latter half means that the series is still changing.
+ *
+ * \param[in] values Values in the order of time.
+ * \param[in] batch_size Number of values in each batch.
+ * \return Number of values to truncate if a steady state is detected,
+ * otherwise std::nullopt.
+ */
+[[nodiscard]] auto detect_steady_state(const std::vector<double>& values,
+    std::size_t batch_size = default_mser_batch_size)
+    -> std::optional<std::size_t>;
+
+}  // namespace stat_bench::stat
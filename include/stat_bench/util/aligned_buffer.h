@@ -0,0 +1,162 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of AlignedBuffer class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+namespace stat_bench::util {
+
+//! Size of cache lines assumed in buffers.
+static constexpr std::size_t cache_line_size = 64;
+
+//! Size of huge pages assumed in buffers.
+static constexpr std::size_t huge_page_size =
+    static_cast<std::size_t>(2) * 1024 * 1024;
+
+/*!
+ * \brief Enumeration of modes of huge pages in buffers.
+ */
+enum class HugePageMode {
+    //! Use ordinary pages.
+    none,
+
+    //! Advise the kernel to use transparent huge pages (madvise).
+    transparent,
+
+    //! Require pages from the pool of huge pages (MAP_HUGETLB).
+    explicit_pages
+};
+
+/*!
+ * \brief Struct of options of buffers.
+ */
+struct BufferOptions {
+    //! Alignment of the buffer. (Must be a power of two.)
+    std::size_t alignment{cache_line_size};
+
+    //! Offset of the beginning of the buffer from the alignment.
+    std::size_t offset{0};
+
+    //! Mode of huge pages. (Supported only on Linux.)
+    HugePageMode huge_pages{HugePageMode::none};
+
+    //! NUMA node to bind the buffer to. (Supported only on Linux.)
+    std::optional<std::size_t> numa_node{};
+
+    //! Whether to touch all pages of the buffer at allocation.
+    bool prefault{false};
+};
+
+/*!
+ * \brief Class of buffers with controlled alignment and backing pages.
+ *
+ * The beginning of the buffer is placed at the given offset from an address
+ * aligned to the given alignment, so that effects of alignment can be
+ * measured by changing the offset.
+ *
+ * \note Contents of the buffer are zero if pages are touched at allocation,
+ * and unspecified otherwise.
+ */
+class AlignedBuffer {
+public:
+    /*!
+     * \brief Constructor of an empty buffer.
+     */
+    AlignedBuffer() noexcept = default;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] size Size of the buffer in bytes.
+     * \param[in] options Options.
+     */
+    explicit AlignedBuffer(
+        std::size_t size, const BufferOptions& options = BufferOptions());
+
+    AlignedBuffer(const AlignedBuffer&) = delete;
+    auto operator=(const AlignedBuffer&) = delete;
+
+    /*!
+     * \brief Move constructor.
+     *
+     * \param[in,out] obj Object to move from.
+     */
+    AlignedBuffer(AlignedBuffer&& obj) noexcept;
+
+    /*!
+     * \brief Move assignment operator.
+     *
+     * \param[in,out] obj Object to move from.
+     * \return This.
+     */
+    auto operator=(AlignedBuffer&& obj) noexcept -> AlignedBuffer&;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~AlignedBuffer() noexcept;
+
+    /*!
+     * \brief Get the pointer to the beginning of the buffer.
+     *
+     * \return Pointer.
+     */
+    [[nodiscard]] auto data() const noexcept -> void* { return data_; }
+
+    /*!
+     * \brief Get the size of the buffer.
+     *
+     * \return Size in bytes.
+     */
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
+
+    /*!
+     * \brief Get the pointer to the beginning of the buffer as an array.
+     *
+     * \tparam T Type of elements.
+     * \return Pointer.
+     */
+    template <typename T>
+    [[nodiscard]] auto as_array() const noexcept -> T* {
+        return static_cast<T*>(data_);
+    }
+
+private:
+    //! Release the memory.
+    void release() noexcept;
+
+    //! Beginning of the allocated memory.
+    void* allocated_{nullptr};
+
+    //! Size of the allocated memory.
+    std::size_t allocated_size_{0};
+
+    //! Whether the memory was mapped by mmap.
+    bool is_mapped_{false};
+
+    //! Beginning of the buffer.
+    void* data_{nullptr};
+
+    //! Size of the buffer.
+    std::size_t size_{0};
+};
+
+}  // namespace stat_bench::util
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of BufferedFileWriter class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace stat_bench::util {
+
+/*!
+ * \brief Class to write files through a buffer with a file descriptor.
+ *
+ * This class writes data to a file descriptor directly without the formatting
+ * machinery of C++ streams.
+ */
+class BufferedFileWriter {
+public:
+    //! Default size of the buffer.
+    static constexpr std::size_t default_buffer_size =
+        static_cast<std::size_t>(1024 * 1024);
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] file_path File path.
+     * \param[in] buffer_size Size of the buffer.
+     */
+    explicit BufferedFileWriter(
+        std::string file_path, std::size_t buffer_size = default_buffer_size);
+
+    BufferedFileWriter(const BufferedFileWriter&) = delete;
+    BufferedFileWriter(BufferedFileWriter&&) = delete;
+    auto operator=(const BufferedFileWriter&) = delete;
+    auto operator=(BufferedFileWriter&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     *
+     * \note Errors in this destructor are ignored. Call close function to
+     * check errors.
+     */
+    ~BufferedFileWriter() noexcept;
+
+    /*!
+     * \brief Write data.
+     *
+     * \param[in] data Data.
+     * \param[in] size Size of the data.
+     */
+    void write(const char* data, std::size_t size) {
+        if (size <= buffer_.size() - used_size_) {
+            std::memcpy(buffer_.data() + used_size_, data, size);
+            used_size_ += size;
+            return;
+        }
+        write_slow(data, size);
+    }
+
+    /*!
+     * \brief Write a string.
+     *
+     * \param[in] data String.
+     */
+    void write(std::string_view data) { write(data.data(), data.size()); }
+
+    /*!
+     * \brief Write a character.
+     *
+     * \param[in] c Character.
+     */
+    void put(char c) {
+        if (used_size_ == buffer_.size()) {
+            flush();
+        }
+        buffer_[used_size_] = c;
+        ++used_size_;
+    }
+
+    /*!
+     * \brief Write the buffered data to the file.
+     */
+    void flush();
+
+    /*!
+     * \brief Flush the buffered data and close the file.
+     */
+    void close();
+
+private:
+    /*!
+     * \brief Write data which doesn't fit in the remaining buffer.
+     *
+     * \param[in] data Data.
+     * \param[in] size Size of the data.
+     */
+    void write_slow(const char* data, std::size_t size);
+
+    /*!
+     * \brief Write data to the file without buffering.
+     *
+     * \param[in] data Data.
+     * \param[in] size Size of the data.
+     */
+    void write_to_file(const char* data, std::size_t size);
+
+    //! File path.
+    std::string file_path_;
+
+    //! File descriptor.
+    int file_descriptor_;
+
+    //! Buffer.
+    std::vector<char> buffer_;
+
+    //! Size of the used region in the buffer.
+    std::size_t used_size_{0};
+};
+
+}  // namespace stat_bench::util
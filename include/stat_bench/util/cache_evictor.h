@@ -0,0 +1,117 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of CacheEvictor class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "stat_bench/util/aligned_buffer.h"
+
+namespace stat_bench::util {
+
+/*!
+ * \brief Enumeration of methods to evict CPU caches.
+ */
+enum class CacheEvictionMethod {
+    //! Read through a buffer larger than the last level cache.
+    stream,
+
+    //! Flush cache lines of registered buffers (clflush).
+    flush
+};
+
+/*!
+ * \brief Get the default size of the buffer to evict CPU caches.
+ *
+ * \return Twice the size of the last level cache detected, or 64 MiB if not
+ * detected.
+ */
+[[nodiscard]] auto default_cache_eviction_size() -> std::size_t;
+
+/*!
+ * \brief Class to evict CPU caches.
+ *
+ * Caches are evicted by flushing cache lines of registered buffers if any
+ * buffer is registered and the CPU supports flushing (x86), and otherwise
+ * by reading through a buffer larger than the last level cache.
+ *
+ * \note evict function can be called in multiple threads at once.
+ */
+class CacheEvictor {
+public:
+    //! Type of regions of memory (pairs of the beginning and the size).
+    using MemoryRegion = std::pair<const void*, std::size_t>;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] flushed_regions Regions of memory to flush.
+     * \param[in] eviction_size Size of the buffer to read through when
+     * flushing is not used.
+     */
+    explicit CacheEvictor(std::vector<MemoryRegion> flushed_regions = {},
+        std::size_t eviction_size = default_cache_eviction_size());
+
+    /*!
+     * \brief Get the method to evict caches.
+     *
+     * \return Method.
+     */
+    [[nodiscard]] auto method() const noexcept -> CacheEvictionMethod {
+        return method_;
+    }
+
+    /*!
+     * \brief Evict caches.
+     */
+    void evict() const noexcept;
+
+private:
+    //! Method to evict caches.
+    CacheEvictionMethod method_;
+
+    //! Regions of memory to flush.
+    std::vector<MemoryRegion> flushed_regions_;
+
+    //! Buffer to read through.
+    AlignedBuffer eviction_buffer_{};
+};
+
+/*!
+ * \brief Check whether CPU caches can be evicted by flushing cache lines.
+ *
+ * \retval true Cache lines can be flushed (x86).
+ * \retval false Cache lines cannot be flushed.
+ */
+[[nodiscard]] auto can_flush_cache_lines() noexcept -> bool;
+
+/*!
+ * \brief Get the CacheEvictor object shared to evict caches by reading
+ * through a buffer of the default size.
+ *
+ * \note The buffer is allocated at the first call and kept until the end of
+ * the process, so measurements don't allocate it in each execution.
+ *
+ * \return CacheEvictor object.
+ */
+[[nodiscard]] auto shared_streaming_cache_evictor() -> const CacheEvictor&;
+
+}  // namespace stat_bench::util
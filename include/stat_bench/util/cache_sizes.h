@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to detect sizes of CPU caches.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace stat_bench::util {
+
+/*!
+ * \brief Struct of sizes of CPU caches.
+ *
+ * Sizes are in bytes, and zero specifies unknown sizes.
+ */
+struct CacheSizes {
+    //! Size of L1 data cache.
+    std::size_t l1d{0};
+
+    //! Size of L2 cache.
+    std::size_t l2{0};
+
+    //! Size of L3 cache.
+    std::size_t l3{0};
+};
+
+/*!
+ * \brief Parse a size of a cache in the format of Linux sysfs (e.g. "48K").
+ *
+ * \param[in] str String.
+ * \return Size in bytes. (Zero for invalid strings.)
+ */
+[[nodiscard]] auto parse_cache_size(std::string_view str) -> std::size_t;
+
+/*!
+ * \brief Read sizes of CPU caches from a directory in Linux sysfs.
+ *
+ * \param[in] directory Directory (e.g. "/sys/devices/system/cpu/cpu0/cache").
+ * \return Sizes of caches. (Zeros for caches not found.)
+ */
+[[nodiscard]] auto read_cache_sizes_from_sysfs(const std::string& directory)
+    -> CacheSizes;
+
+/*!
+ * \brief Detect sizes of CPU caches of the current host.
+ *
+ * \note Detection is performed once, and the result is reused.
+ *
+ * \return Sizes of caches. (Zeros for caches not detected.)
+ */
+[[nodiscard]] auto detect_cache_sizes() -> const CacheSizes&;
+
+}  // namespace stat_bench::util
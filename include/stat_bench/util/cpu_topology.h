@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to detect the topology of CPUs.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace stat_bench::util {
+
+/*!
+ * \brief Struct of the topology of CPUs.
+ */
+struct CpuTopology {
+    //! Number of logical CPUs (hardware threads).
+    std::size_t logical_cpus{1};
+
+    //! Number of physical cores.
+    std::size_t physical_cores{1};
+
+    //! Number of sockets (packages).
+    std::size_t sockets{1};
+
+    /*!
+     * \brief Get the number of physical cores in a socket.
+     *
+     * \return Number of physical cores in a socket.
+     */
+    [[nodiscard]] auto cores_per_socket() const noexcept -> std::size_t {
+        if (sockets <= 1) {
+            return physical_cores;
+        }
+        return (physical_cores + sockets - 1) / sockets;
+    }
+};
+
+/*!
+ * \brief Read the topology of CPUs from a directory in Linux sysfs.
+ *
+ * \param[in] directory Directory (e.g. "/sys/devices/system/cpu").
+ * \return Topology of CPUs. (Zeros if no CPU was found.)
+ */
+[[nodiscard]] auto read_cpu_topology_from_sysfs(const std::string& directory)
+    -> CpuTopology;
+
+/*!
+ * \brief Detect the topology of CPUs of the current host.
+ *
+ * When the topology cannot be detected, all logical CPUs are assumed to be
+ * physical cores in a socket.
+ *
+ * \note Detection is performed once, and the result is reused.
+ *
+ * \return Topology of CPUs.
+ */
+[[nodiscard]] auto detect_cpu_topology() -> const CpuTopology&;
+
+}  // namespace stat_bench::util
@@ -0,0 +1,158 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of ParallelGzipWriter class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "stat_bench/util/buffered_file_writer.h"
+#include "stat_bench/util/worker_pool.h"
+
+namespace stat_bench::util {
+
+/*!
+ * \brief Struct of blocks compressed in ParallelGzipWriter class.
+ */
+struct CompressedGzipBlock {
+    //! Compressed data.
+    std::vector<unsigned char> data{};
+
+    //! CRC-32 of the uncompressed data.
+    std::uint32_t crc{};
+
+    //! Size of the uncompressed data.
+    std::size_t uncompressed_size{};
+};
+
+/*!
+ * \brief Class to write gzip files compressing blocks of data in parallel.
+ *
+ * Data is split into blocks and each block is compressed in a fixed set of
+ * worker threads as a part of a single deflate stream, so the output is a
+ * usual gzip file which can be read by any gzip decoder.
+ */
+class ParallelGzipWriter {
+public:
+    //! Minimum compression level. (Fastest.)
+    static constexpr int min_compression_level = 1;
+
+    //! Maximum compression level. (Smallest output.)
+    static constexpr int max_compression_level = 9;
+
+    //! Default compression level.
+    static constexpr int default_compression_level = 6;
+
+    //! Default size of blocks.
+    static constexpr std::size_t default_block_size =
+        static_cast<std::size_t>(1024 * 1024);
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] file_path File path.
+     * \param[in] compression_level Compression level.
+     * \param[in] num_threads Number of threads to compress data. (Zero
+     * specifies the number of hardware threads.)
+     * \param[in] block_size Size of blocks.
+     */
+    explicit ParallelGzipWriter(std::string file_path,
+        int compression_level = default_compression_level,
+        std::size_t num_threads = 0,
+        std::size_t block_size = default_block_size);
+
+    ParallelGzipWriter(const ParallelGzipWriter&) = delete;
+    ParallelGzipWriter(ParallelGzipWriter&&) = delete;
+    auto operator=(const ParallelGzipWriter&) = delete;
+    auto operator=(ParallelGzipWriter&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     *
+     * \note Errors in this destructor are ignored. Call close function to
+     * check errors.
+     */
+    ~ParallelGzipWriter() noexcept;
+
+    /*!
+     * \brief Write data.
+     *
+     * \param[in] data Data.
+     * \param[in] size Size of the data.
+     */
+    void write(const unsigned char* data, std::size_t size);
+
+    /*!
+     * \brief Compress the remaining data and close the file.
+     */
+    void close();
+
+private:
+    /*!
+     * \brief Start compression of the current block.
+     *
+     * \param[in] is_last Whether the block is the last one.
+     */
+    void submit_block(bool is_last);
+
+    /*!
+     * \brief Wait for compression of the oldest block and write it to the
+     * file.
+     */
+    void write_oldest_block();
+
+    //! Compression level.
+    int compression_level_;
+
+    //! Maximum number of blocks compressed at once.
+    std::size_t max_pending_blocks_;
+
+    //! Size of blocks.
+    std::size_t block_size_;
+
+    //! Writer of the file. (Opened after validation of other arguments.)
+    BufferedFileWriter file_;
+
+    //! Worker threads to compress blocks.
+    WorkerPool workers_;
+
+    //! Current block.
+    std::vector<unsigned char> current_block_{};
+
+    //! Dictionary for the current block. (End of the previous block.)
+    std::vector<unsigned char> dictionary_{};
+
+    //! Blocks in compression.
+    std::deque<std::future<CompressedGzipBlock>> pending_blocks_{};
+
+    //! CRC-32 of the whole data written to the file.
+    std::uint32_t crc_;
+
+    //! Size of the whole data written to the file.
+    std::uint64_t uncompressed_size_{0};
+
+    //! Whether this file has been closed.
+    bool is_closed_{false};
+};
+
+}  // namespace stat_bench::util
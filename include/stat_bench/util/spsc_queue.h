@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of SpscQueue class.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::util {
+
+/*!
+ * \brief Class of lock-free bounded queues for a single producer thread and a
+ * single consumer thread.
+ *
+ * \tparam T Type of elements.
+ */
+template <typename T>
+class SpscQueue {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] capacity Maximum number of elements in this queue.
+     */
+    explicit SpscQueue(std::size_t capacity) : buffer_(capacity + 1U) {
+        if (capacity == 0U) {
+            throw StatBenchException("Capacity of queues must be positive.");
+        }
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue(SpscQueue&&) = delete;
+    auto operator=(const SpscQueue&) -> SpscQueue& = delete;
+    auto operator=(SpscQueue&&) -> SpscQueue& = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~SpscQueue() = default;
+
+    /*!
+     * \brief Push an element. (Called from the producer thread only.)
+     *
+     * \param[in] value Value.
+     * \retval true Successfully pushed.
+     * \retval false This queue is full.
+     */
+    [[nodiscard]] auto try_push(T&& value) -> bool {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        const std::size_t next_tail = next_index(tail);
+        if (next_tail == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        buffer_[tail] = std::move(value);
+        tail_.store(next_tail, std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * \brief Pop an element. (Called from the consumer thread only.)
+     *
+     * \param[out] value Value.
+     * \retval true Successfully popped.
+     * \retval false This queue is empty.
+     */
+    [[nodiscard]] auto try_pop(T& value) -> bool {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = std::move(buffer_[head]);
+        buffer_[head] = T();
+        head_.store(next_index(head), std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * \brief Check whether this queue is empty.
+     *
+     * \return Whether this queue is empty.
+     */
+    [[nodiscard]] auto empty() const -> bool {
+        return head_.load(std::memory_order_acquire) ==
+            tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    /*!
+     * \brief Get the next index in the buffer.
+     *
+     * \param[in] index Index.
+     * \return Next index.
+     */
+    [[nodiscard]] auto next_index(std::size_t index) const noexcept
+        -> std::size_t {
+        ++index;
+        if (index == buffer_.size()) {
+            index = 0;
+        }
+        return index;
+    }
+
+    //! Size of cache lines assumed to avoid false sharing.
+    static constexpr std::size_t cache_line_size = 64;
+
+    //! Buffer.
+    std::vector<T> buffer_;
+
+    //! Index of the first element. (Written by the consumer.)
+    alignas(cache_line_size) std::atomic<std::size_t> head_{0};
+
+    //! Index next to the last element. (Written by the producer.)
+    alignas(cache_line_size) std::atomic<std::size_t> tail_{0};
+};
+
+}  // namespace stat_bench::util
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of functions to set affinity of threads.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace stat_bench::util {
+
+/*!
+ * \brief Pin the current thread to a CPU core.
+ *
+ * \param[in] cpu_index Index of the CPU core.
+ * \retval true Successfully pinned.
+ * \retval false Failed to pin the thread, or not supported on this platform.
+ */
+[[nodiscard]] auto pin_current_thread_to_cpu(std::size_t cpu_index) -> bool;
+
+/*!
+ * \brief Restrict the current thread to a set of CPU cores.
+ *
+ * \param[in] cpu_indices Indices of the CPU cores.
+ * \retval true Successfully restricted.
+ * \retval false Failed to restrict the thread, or not supported on this
+ * platform.
+ */
+[[nodiscard]] auto restrict_current_thread_to_cpus(
+    const std::vector<std::size_t>& cpu_indices) -> bool;
+
+}  // namespace stat_bench::util
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of WorkerPool class.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace stat_bench::util {
+
+/*!
+ * \brief Class of pools of worker threads with a bounded queue of tasks.
+ *
+ * submit function blocks while the queue is full, so that the memory used
+ * by pending tasks is bounded.
+ * The first exception thrown in tasks is rethrown in the next call of submit
+ * or wait function, and subsequent tasks are discarded.
+ */
+class WorkerPool {
+public:
+    //! Type of tasks.
+    using Task = std::function<void()>;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] num_threads Number of worker threads. (Must be positive.)
+     * \param[in] max_pending_tasks Maximum number of tasks waiting in the
+     * queue. (Must be positive.)
+     * \param[in] cpu_indices Indices of CPU cores to run worker threads.
+     * (No restriction if empty.)
+     */
+    WorkerPool(std::size_t num_threads, std::size_t max_pending_tasks,
+        std::vector<std::size_t> cpu_indices = {});
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&) = delete;
+    auto operator=(const WorkerPool&) -> WorkerPool& = delete;
+    auto operator=(WorkerPool&&) -> WorkerPool& = delete;
+
+    /*!
+     * \brief Destructor.
+     *
+     * This waits for remaining tasks to be processed, and ignores exceptions
+     * in tasks.
+     */
+    ~WorkerPool();
+
+    /*!
+     * \brief Submit a task.
+     *
+     * \param[in] task Task.
+     */
+    void submit(Task task);
+
+    /*!
+     * \brief Wait for all submitted tasks to finish.
+     */
+    void wait();
+
+private:
+    /*!
+     * \brief Process tasks in a worker thread.
+     */
+    void process_tasks();
+
+    /*!
+     * \brief Stop worker threads after remaining tasks are processed.
+     */
+    void stop();
+
+    /*!
+     * \brief Rethrow an exception thrown in tasks if exists.
+     *
+     * \note This function must be called with the lock of the mutex.
+     */
+    void rethrow_if_failed();
+
+    //! Maximum number of tasks waiting in the queue.
+    std::size_t max_pending_tasks_;
+
+    //! Indices of CPU cores to run worker threads.
+    std::vector<std::size_t> cpu_indices_;
+
+    //! Mutex.
+    std::mutex mutex_{};
+
+    //! Condition variable to notify worker threads of new tasks.
+    std::condition_variable task_submitted_{};
+
+    //! Condition variable to notify progress of tasks.
+    std::condition_variable task_finished_{};
+
+    //! Queue of tasks.
+    std::deque<Task> tasks_{};
+
+    //! Number of tasks being processed.
+    std::size_t num_running_tasks_{0};
+
+    //! Whether to stop worker threads.
+    bool is_stopping_{false};
+
+    //! Exception thrown in tasks.
+    std::exception_ptr error_{};
+
+    //! Worker threads.
+    std::vector<std::thread> threads_{};
+};
+
+}  // namespace stat_bench::util
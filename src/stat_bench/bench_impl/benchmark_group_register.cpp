@@ -19,21 +19,28 @@
  */
 #include "stat_bench/bench_impl/benchmark_group_register.h"
 
+#include <cstddef>
 #include <cstdlib>
 #include <exception>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "stat_bench/bench_impl/benchmark_case_registry.h"
 #include "stat_bench/bench_impl/benchmark_group_config.h"
 #include "stat_bench/benchmark_group_name.h"
 #include "stat_bench/custom_output_name.h"
+#include "stat_bench/measurer/generate_default_measurement_configs.h"
 #include "stat_bench/param/parameter_name.h"
+#include "stat_bench/plots/density_plot.h"
+#include "stat_bench/plots/histogram_plot.h"
+#include "stat_bench/plots/iteration_regression_plot.h"
 #include "stat_bench/plots/parameter_to_output_line_plot.h"
 #include "stat_bench/plots/parameter_to_time_box_plot.h"
 #include "stat_bench/plots/parameter_to_time_line_plot.h"
 #include "stat_bench/plots/parameter_to_time_violin_plot.h"
+#include "stat_bench/plots/thread_scaling_plot.h"
 #include "stat_bench/plots/time_to_output_by_parameter_line_plot.h"
 #include "stat_bench/util/string_view.h"
 
@@ -145,6 +152,78 @@ auto BenchmarkGroupRegister::add_time_to_output_by_parameter_line_plot(
     }
 }
 
+auto BenchmarkGroupRegister::add_complexity_fit(
+    util::StringView parameter_name, PlotOptions options) noexcept
+    -> BenchmarkGroupRegister& {
+    try {
+        auto name = param::ParameterName(
+            std::string(parameter_name.data(), parameter_name.size()));
+        group_->config().add_complexity_parameter(name);
+        group_->config().add_plot(
+            std::make_shared<plots::ParameterToTimeLinePlot>(
+                std::move(name), options, true));
+        return *this;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to append a complexity fit to a benchmark group: "
+                  << e.what() << std::endl;  // NOLINT(performance-avoid-endl)
+        std::exit(1);                        // NOLINT(concurrency-mt-unsafe)
+    }
+}
+
+auto BenchmarkGroupRegister::add_thread_scaling_plot() noexcept
+    -> BenchmarkGroupRegister& {
+    try {
+        group_->config().add_plot(
+            std::make_shared<plots::ThreadScalingPlot>());
+        return *this;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to append a plot to a benchmark group: "
+                  << e.what() << std::endl;  // NOLINT(performance-avoid-endl)
+        std::exit(1);                        // NOLINT(concurrency-mt-unsafe)
+    }
+}
+
+auto BenchmarkGroupRegister::add_iteration_regression_plot() noexcept
+    -> BenchmarkGroupRegister& {
+    try {
+        group_->config().add_plot(
+            std::make_shared<plots::IterationRegressionPlot>());
+        return *this;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to append a plot to a benchmark group: "
+                  << e.what() << std::endl;  // NOLINT(performance-avoid-endl)
+        std::exit(1);                        // NOLINT(concurrency-mt-unsafe)
+    }
+}
+
+auto BenchmarkGroupRegister::add_histogram_plot(std::size_t num_bins,
+    bool log_bins, std::size_t num_threads) noexcept
+    -> BenchmarkGroupRegister& {
+    try {
+        group_->config().add_plot(std::make_shared<plots::HistogramPlot>(
+            num_bins, log_bins, num_threads));
+        return *this;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to append a plot to a benchmark group: "
+                  << e.what() << std::endl;  // NOLINT(performance-avoid-endl)
+        std::exit(1);                        // NOLINT(concurrency-mt-unsafe)
+    }
+}
+
+auto BenchmarkGroupRegister::add_density_plot(std::size_t num_points,
+    bool log_scale, std::size_t num_threads) noexcept
+    -> BenchmarkGroupRegister& {
+    try {
+        group_->config().add_plot(std::make_shared<plots::DensityPlot>(
+            num_points, log_scale, num_threads));
+        return *this;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to append a plot to a benchmark group: "
+                  << e.what() << std::endl;  // NOLINT(performance-avoid-endl)
+        std::exit(1);                        // NOLINT(concurrency-mt-unsafe)
+    }
+}
+
 auto BenchmarkGroupRegister::add_measurement_config(
     const MeasurementConfig& config) noexcept -> BenchmarkGroupRegister& {
     try {
@@ -158,6 +237,18 @@ auto BenchmarkGroupRegister::add_measurement_config(
     }
 }
 
+auto BenchmarkGroupRegister::add_cold_cache_measurement() noexcept
+    -> BenchmarkGroupRegister& {
+    return add_measurement_config(
+        measurer::generate_cold_cache_measurement_config());
+}
+
+auto BenchmarkGroupRegister::add_regression_measurement() noexcept
+    -> BenchmarkGroupRegister& {
+    return add_measurement_config(
+        measurer::generate_regression_measurement_config());
+}
+
 auto BenchmarkGroupRegister::clear_measurement_configs() noexcept
     -> BenchmarkGroupRegister& {
     // This won't throw an exception.
@@ -43,11 +43,27 @@ auto MeasurementConfig::warming_up_samples(std::size_t value)
     return *this;
 }
 
+auto MeasurementConfig::max_steady_state_warming_up_samples(std::size_t value)
+    -> MeasurementConfig& {
+    max_steady_state_warming_up_samples_ = value;
+    return *this;
+}
+
 auto MeasurementConfig::iterations(std::size_t value) -> MeasurementConfig& {
     iterations_ = value;
     return *this;
 }
 
+auto MeasurementConfig::cold_cache(bool value) -> MeasurementConfig& {
+    cold_cache_ = value;
+    return *this;
+}
+
+auto MeasurementConfig::linear_iterations(bool value) -> MeasurementConfig& {
+    linear_iterations_ = value;
+    return *this;
+}
+
 auto MeasurementConfig::type() const noexcept
     -> const measurer::MeasurementType& {
     return type_;
@@ -62,9 +78,22 @@ auto MeasurementConfig::warming_up_samples() const noexcept
     return warming_up_samples_;
 }
 
+auto MeasurementConfig::max_steady_state_warming_up_samples() const noexcept
+    -> std::optional<std::size_t> {
+    return max_steady_state_warming_up_samples_;
+}
+
 auto MeasurementConfig::iterations() const noexcept
     -> std::optional<std::size_t> {
     return iterations_;
 }
 
+auto MeasurementConfig::cold_cache() const noexcept -> bool {
+    return cold_cache_;
+}
+
+auto MeasurementConfig::linear_iterations() const noexcept -> bool {
+    return linear_iterations_;
+}
+
 }  // namespace stat_bench
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of analyze_thread_scaling function.
+ */
+#include "stat_bench/measurer/analyze_thread_scaling.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "stat_bench/param/auto_num_threads.h"
+#include "stat_bench/param/num_threads_parameter_name.h"
+#include "stat_bench/util/ordered_map.h"
+
+namespace stat_bench::measurer {
+
+auto analyze_thread_scaling(
+    const std::vector<std::shared_ptr<const Measurement>>& measurements)
+    -> std::vector<CaseThreadScaling> {
+    util::OrderedMap<BenchmarkCaseName,
+        util::OrderedMap<param::ParameterDict,
+            std::vector<std::shared_ptr<const Measurement>>>>
+        lines;
+    for (const auto& measurement : measurements) {
+        const auto& params = measurement->cond().params();
+        if (!params.has(param::num_threads_parameter_name())) {
+            continue;
+        }
+        auto other_params =
+            params.clone_without(param::num_threads_parameter_name());
+        if (other_params.has(param::expected_placement_parameter_name())) {
+            other_params = other_params.clone_without(
+                param::expected_placement_parameter_name());
+        }
+        lines[measurement->case_info().case_name()][other_params].push_back(
+            measurement);
+    }
+
+    std::vector<CaseThreadScaling> results;
+    for (auto& [case_name, case_lines] : lines) {
+        for (auto& [other_params, line] : case_lines) {
+            std::stable_sort(line.begin(), line.end(),
+                [](const auto& lhs, const auto& rhs) {
+                    return lhs->cond().threads() < rhs->cond().threads();
+                });
+            if (line.size() < 2 || line.front()->cond().threads() != 1) {
+                continue;
+            }
+
+            std::vector<ThreadScalingPoint> points;
+            points.reserve(line.size());
+            for (const auto& measurement : line) {
+                const double mean_time = measurement->durations_stat().mean();
+                if (!(mean_time > 0.0)) {
+                    break;
+                }
+                const auto num_threads = measurement->cond().threads();
+                const double throughput =
+                    static_cast<double>(num_threads) / mean_time;
+                const double speedup = points.empty()
+                    ? 1.0
+                    : throughput / points.front().throughput;
+                points.push_back(ThreadScalingPoint{num_threads, throughput,
+                    speedup, speedup / static_cast<double>(num_threads)});
+            }
+            if (points.size() != line.size()) {
+                continue;
+            }
+
+            std::vector<double> nums_threads;
+            std::vector<double> speedups;
+            nums_threads.reserve(points.size());
+            speedups.reserve(points.size());
+            for (const auto& point : points) {
+                nums_threads.push_back(static_cast<double>(point.num_threads));
+                speedups.push_back(point.speedup);
+            }
+            results.push_back(CaseThreadScaling{case_name, other_params,
+                std::move(points), stat::fit_amdahl(nums_threads, speedups),
+                stat::fit_usl(nums_threads, speedups)});
+        }
+    }
+    return results;
+}
+
+}  // namespace stat_bench::measurer
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of determine_steady_state_warming_up_samples function.
+ */
+#include "stat_bench/measurer/determine_steady_state_warming_up_samples.h"
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/measurer/measure_once.h"
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/stat/steady_state.h"
+
+namespace stat_bench::measurer {
+
+auto determine_steady_state_warming_up_samples(
+    bench_impl::IBenchmarkCase* bench_case, const BenchmarkCondition& cond,
+    const MeasurementType& measurement_type, std::size_t iterations,
+    std::size_t samples, std::size_t max_warming_up_samples, bool cold_cache,
+    bool linear_iterations) -> std::size_t {
+    constexpr std::size_t min_trial_samples =
+        4U * stat::default_mser_batch_size;
+    const std::size_t max_trial_samples = max_warming_up_samples + samples;
+    std::size_t trial_samples =
+        std::min(std::max(samples, min_trial_samples), max_trial_samples);
+    while (true) {
+        const auto data = measure_once(bench_case, cond, measurement_type,
+            iterations, trial_samples, 0, cold_cache, linear_iterations);
+
+        std::vector<double> durations(trial_samples, 0.0);
+        for (const auto& thread_durations : data.durations()) {
+            for (std::size_t i = 0; i < trial_samples; ++i) {
+                durations[i] += thread_durations.at(i).seconds();
+            }
+        }
+
+        const std::optional<std::size_t> truncated =
+            stat::detect_steady_state(durations);
+        if (truncated.has_value()) {
+            return std::min(truncated.value(), max_warming_up_samples);
+        }
+        if (trial_samples >= max_trial_samples) {
+            return max_warming_up_samples;
+        }
+        trial_samples = std::min(2U * trial_samples, max_trial_samples);
+    }
+}
+
+}  // namespace stat_bench::measurer
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of fit_complexity_by_case function.
+ */
+#include "stat_bench/measurer/fit_complexity_by_case.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/ordered_map.h"
+
+namespace stat_bench::measurer {
+
+auto fit_complexity_by_case(
+    const std::vector<std::shared_ptr<const Measurement>>& measurements,
+    const param::ParameterName& parameter_name)
+    -> std::vector<CaseComplexityFit> {
+    // Measurements are grouped by cases and parameters other than the given
+    // one.
+    util::OrderedMap<BenchmarkCaseName,
+        util::OrderedMap<param::ParameterDict,
+            std::vector<std::pair<double, std::shared_ptr<const Measurement>>>>>
+        lines;
+    for (const auto& measurement : measurements) {
+        const auto& params = measurement->cond().params();
+        if (!params.has(parameter_name)) {
+            continue;
+        }
+        double value = 0.0;
+        try {
+            value = params.get_as_double(parameter_name);
+        } catch (const StatBenchException&) {
+            // Non-numeric parameters can't be used.
+            continue;
+        }
+        lines[measurement->case_info().case_name()]
+             [params.clone_without(parameter_name)]
+                 .emplace_back(value, measurement);
+    }
+
+    std::vector<CaseComplexityFit> results;
+    for (auto& [case_name, case_lines] : lines) {
+        for (auto& [other_params, line] : case_lines) {
+            std::stable_sort(line.begin(), line.end(),
+                [](const auto& lhs, const auto& rhs) {
+                    return lhs.first < rhs.first;
+                });
+            std::vector<double> sizes;
+            std::vector<double> times;
+            std::vector<double> errors;
+            std::vector<std::shared_ptr<const Measurement>> line_measurements;
+            sizes.reserve(line.size());
+            times.reserve(line.size());
+            errors.reserve(line.size());
+            line_measurements.reserve(line.size());
+            for (const auto& [value, measurement] : line) {
+                sizes.push_back(value);
+                times.push_back(measurement->durations_stat().mean());
+                errors.push_back(
+                    measurement->durations_stat().standard_error());
+                line_measurements.push_back(measurement);
+            }
+            const auto result = stat::fit_complexity(sizes, times, errors);
+            if (!result) {
+                continue;
+            }
+            results.push_back(CaseComplexityFit{case_name, other_params,
+                std::move(line_measurements), *result});
+        }
+    }
+    return results;
+}
+
+}  // namespace stat_bench::measurer
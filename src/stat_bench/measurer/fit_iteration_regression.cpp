@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of fit_iteration_regression function.
+ */
+#include "stat_bench/measurer/fit_iteration_regression.h"
+
+#include <cstddef>
+#include <vector>
+
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/stat/linear_regression.h"
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::measurer {
+
+auto fit_iteration_regression(
+    const std::vector<std::vector<clock::Duration>>& durations,
+    std::size_t base_iterations) -> IterationRegression {
+    if (durations.empty()) {
+        throw StatBenchException("No duration for linear regression.");
+    }
+    const std::size_t samples = durations.front().size();
+
+    IterationRegression result;
+    result.iterations.reserve(samples);
+    result.durations.reserve(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+        double sum = 0.0;
+        for (const auto& thread_durations : durations) {
+            sum += thread_durations.at(i).seconds();
+        }
+        result.iterations.push_back(
+            static_cast<double>((i + 1U) * base_iterations));
+        result.durations.push_back(sum / static_cast<double>(durations.size()));
+    }
+
+    result.ordinary_least_squares =
+        stat::fit_ordinary_least_squares(result.iterations, result.durations);
+    result.theil_sen = stat::fit_theil_sen(result.iterations, result.durations);
+    return result;
+}
+
+void normalize_linear_iteration_durations(
+    std::vector<std::vector<clock::Duration>>& durations) {
+    for (auto& thread_durations : durations) {
+        for (std::size_t i = 0; i < thread_durations.size(); ++i) {
+            thread_durations[i] = clock::Duration(
+                thread_durations[i].seconds() / static_cast<double>(i + 1U));
+        }
+    }
+}
+
+}  // namespace stat_bench::measurer
@@ -15,7 +15,8 @@
  */
 /*!
  * \file
- * \brief Implementation of generate_default_measurement_configs function.
+ * \brief Implementation of functions to generate built-in measurement
+ * configurations.
  */
 #include "stat_bench/measurer/generate_default_measurement_configs.h"
 
@@ -35,4 +36,17 @@ auto generate_default_measurement_configs()
     return configs;
 }
 
+auto generate_cold_cache_measurement_config() -> MeasurementConfig {
+    return MeasurementConfig()
+        .type("Cold Processing Time")
+        .iterations(1)
+        .cold_cache(true);
+}
+
+auto generate_regression_measurement_config() -> MeasurementConfig {
+    return MeasurementConfig()
+        .type("Regression Processing Time")
+        .linear_iterations(true);
+}
+
 }  // namespace stat_bench::measurer
@@ -20,6 +20,7 @@
 #include "stat_bench/measurer/measure_once.h"
 
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 #include <vector>
@@ -31,23 +32,43 @@
 #include "stat_bench/clock/duration.h"
 #include "stat_bench/custom_output_name.h"
 #include "stat_bench/invocation_context.h"
+#include "stat_bench/measurer/fit_iteration_regression.h"
 #include "stat_bench/measurer/measurement.h"
 
 namespace stat_bench::measurer {
 
 auto measure_once(bench_impl::IBenchmarkCase* bench_case,
     const BenchmarkCondition& cond, const MeasurementType& measurement_type,
-    std::size_t iterations, std::size_t samples, std::size_t warming_up_samples)
-    -> Measurement {
+    std::size_t iterations, std::size_t samples, std::size_t warming_up_samples,
+    bool cold_cache, bool linear_iterations) -> Measurement {
     auto& context = bench_impl::InvocationContextRegistry::instance().create(
         cond, iterations, samples + warming_up_samples, warming_up_samples);
+    context.set_cold_cache(cold_cache);
+    context.set_linear_iterations(linear_iterations);
     bench_case->execute();
     if (context.durations().empty()) {
         throw std::runtime_error("No measurement was done.");
     }
+
+    auto durations = context.durations();
+    std::optional<IterationRegression> iteration_regression;
+    if (linear_iterations) {
+        iteration_regression = fit_iteration_regression(durations, iterations);
+        normalize_linear_iteration_durations(durations);
+        std::vector<double> divisors;
+        divisors.reserve(samples);
+        for (std::size_t i = 0; i < samples; ++i) {
+            divisors.push_back(static_cast<double>(i + 1U));
+        }
+        for (const auto& output : context.custom_stat_outputs()) {
+            output->divide_samples(divisors);
+        }
+    }
+
     auto measurement = Measurement{bench_case->info(), cond, measurement_type,
-        iterations, samples, context.durations(), context.custom_stat_outputs(),
-        context.custom_outputs()};
+        iterations, samples, std::move(durations),
+        context.custom_stat_outputs(), context.custom_outputs(),
+        warming_up_samples, std::move(iteration_regression)};
 
     stat_bench::bench_impl::InvocationContextRegistry::instance().clear();
 
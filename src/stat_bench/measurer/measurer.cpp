@@ -19,9 +19,11 @@
  */
 #include "stat_bench/measurer/measurer.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "stat_bench/measurer/determine_iterations.h"
+#include "stat_bench/measurer/determine_steady_state_warming_up_samples.h"
 #include "stat_bench/measurer/determine_warming_up_samples.h"
 #include "stat_bench/measurer/measure_once.h"
 
@@ -46,11 +48,22 @@ auto Measurer::measure(bench_impl::IBenchmarkCase* bench_case,
     } else {
         iterations = determine_iterations(
             bench_case, condition, config.type(), min_sample_duration_sec_);
+        if (config.linear_iterations()) {
+            // Samples have iterations * 2 * (i + 1) / (samples + 1)
+            // iterations so that the total number of iterations is the same.
+            iterations = std::max<std::size_t>(
+                2U * iterations / (samples + 1U), 1U);
+        }
     }
 
     std::size_t warming_up_samples;
     if (config.warming_up_samples().has_value()) {
         warming_up_samples = config.warming_up_samples().value();
+    } else if (config.max_steady_state_warming_up_samples().has_value()) {
+        warming_up_samples = determine_steady_state_warming_up_samples(
+            bench_case, condition, config.type(), iterations, samples,
+            config.max_steady_state_warming_up_samples().value(),
+            config.cold_cache(), config.linear_iterations());
     } else {
         warming_up_samples = determine_warming_up_samples(bench_case, condition,
             config.type(), iterations, min_warming_up_iterations_,
@@ -58,7 +71,8 @@ auto Measurer::measure(bench_impl::IBenchmarkCase* bench_case,
     }
 
     return measure_once(bench_case, condition, config.type(), iterations,
-        samples, warming_up_samples);
+        samples, warming_up_samples, config.cold_cache(),
+        config.linear_iterations());
 }
 
 }  // namespace stat_bench::measurer
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions for adaptive refinement of parameters.
+ */
+#include "stat_bench/param/adaptive_refinement.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::param {
+
+auto find_refinement_intervals(const std::vector<double>& values,
+    const std::vector<double>& mean_times, double threshold)
+    -> std::vector<RefinementInterval> {
+    if (values.size() != mean_times.size()) {
+        throw StatBenchException(
+            "Different number of parameter values and processing times.");
+    }
+    const std::size_t num_values = values.size();
+    if (num_values < 2) {
+        return {};
+    }
+
+    // Logarithm of processing time per value, or processing time itself for
+    // non-positive parameter values.
+    const bool use_log_values = std::all_of(
+        values.begin(), values.end(), [](double value) { return value > 0.0; });
+    std::vector<double> log_rates;
+    log_rates.reserve(num_values);
+    for (std::size_t i = 0; i < num_values; ++i) {
+        if (!(mean_times[i] > 0.0)) {
+            return {};
+        }
+        double rate = mean_times[i];
+        if (use_log_values) {
+            rate /= values[i];
+        }
+        log_rates.push_back(std::log(rate));
+    }
+
+    std::vector<double> scores(num_values - 1, 0.0);
+    const double jump_threshold = std::log1p(threshold);
+    for (std::size_t i = 0; i + 1 < num_values; ++i) {
+        const double jump = std::abs(log_rates[i + 1] - log_rates[i]);
+        if (jump > jump_threshold) {
+            scores[i] = jump;
+        }
+    }
+
+    if (use_log_values) {
+        const auto slope = [&values, &log_rates](std::size_t i) {
+            const double width = std::log(values[i + 1] / values[i]);
+            if (!(width > 0.0)) {
+                return 0.0;
+            }
+            return (log_rates[i + 1] - log_rates[i]) / width;
+        };
+        // A change of the slope at a value is shared by the intervals on
+        // both sides, so that jumps (changes at both ends of an interval)
+        // get larger scores than their neighbors.
+        constexpr double half = 0.5;
+        for (std::size_t i = 1; i + 1 < num_values; ++i) {
+            const double change = std::abs(slope(i) - slope(i - 1));
+            if (change > threshold) {
+                scores[i - 1] += half * change;
+                scores[i] += half * change;
+            }
+        }
+    }
+
+    std::vector<RefinementInterval> intervals;
+    for (std::size_t i = 0; i + 1 < num_values; ++i) {
+        if (scores[i] > 0.0) {
+            intervals.push_back(RefinementInterval{i, scores[i]});
+        }
+    }
+    std::stable_sort(intervals.begin(), intervals.end(),
+        [](const RefinementInterval& lhs, const RefinementInterval& rhs) {
+            return lhs.score > rhs.score;
+        });
+    return intervals;
+}
+
+auto calc_refinement_point(double lower, double upper) -> double {
+    if (lower > 0.0 && upper > 0.0) {
+        return std::sqrt(lower * upper);
+    }
+    return 0.5 * (lower + upper);  // NOLINT(readability-magic-numbers)
+}
+
+}  // namespace stat_bench::param
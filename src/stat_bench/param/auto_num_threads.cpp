@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to generate numbers of threads from the
+ * topology of CPUs.
+ */
+#include "stat_bench/param/auto_num_threads.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace stat_bench::param {
+
+auto generate_auto_num_threads(const util::CpuTopology& topology,
+    std::size_t max_threads) -> std::vector<std::size_t> {
+    std::vector<std::size_t> num_threads;
+    num_threads.push_back(1);
+    for (std::size_t value = 2; value < topology.physical_cores; value *= 2) {
+        num_threads.push_back(value);
+    }
+    num_threads.push_back(topology.cores_per_socket());
+    num_threads.push_back(topology.physical_cores);
+    num_threads.push_back(topology.logical_cpus);
+
+    if (max_threads > 0) {
+        for (auto& value : num_threads) {
+            value = std::min(value, max_threads);
+        }
+    }
+
+    std::sort(num_threads.begin(), num_threads.end());
+    num_threads.erase(std::unique(num_threads.begin(), num_threads.end()),
+        num_threads.end());
+    return num_threads;
+}
+
+auto describe_expected_thread_placement(std::size_t num_threads,
+    const util::CpuTopology& topology) -> std::string {
+    if (num_threads > topology.logical_cpus) {
+        return "oversubscribed";
+    }
+    const bool cross_socket = topology.sockets > 1 &&
+        num_threads > topology.cores_per_socket();
+    const bool smt = num_threads > topology.physical_cores;
+    if (cross_socket && smt) {
+        return "cross_socket+smt";
+    }
+    if (cross_socket) {
+        return "cross_socket";
+    }
+    if (smt) {
+        return "smt";
+    }
+    return "cores";
+}
+
+}  // namespace stat_bench::param
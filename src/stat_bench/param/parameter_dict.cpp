@@ -101,6 +101,24 @@ auto ParameterDict::clone_without(const ParameterName& param_name) const
     return ParameterDict{std::move(new_data)};
 }
 
+auto ParameterDict::clone_with(const ParameterName& param_name,
+    const ParameterValue& value) const -> ParameterDict {
+    if (!has(param_name)) {
+        throw StatBenchException(
+            fmt::format("Parameter {} not found.", param_name));
+    }
+    util::OrderedMap<ParameterName, ParameterValue> new_data;
+    new_data.reserve(data_.size());
+    for (const auto& pair : data_) {
+        if (pair.first == param_name) {
+            new_data.try_emplace(pair.first, value);
+        } else {
+            new_data.try_emplace(pair.first, pair.second);
+        }
+    }
+    return ParameterDict{std::move(new_data)};
+}
+
 auto ParameterDict::calculate_hash() const -> std::size_t {
     std::size_t hash = 0;
     std::hash<ParameterName> name_hash{};
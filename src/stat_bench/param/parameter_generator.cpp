@@ -19,14 +19,48 @@
  */
 #include "stat_bench/param/parameter_generator.h"
 
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <fmt/format.h>
+
 #include "stat_bench/param/parameter_name.h"
 #include "stat_bench/param/parameter_value.h"
+#include "stat_bench/stat_bench_exception.h"
 #include "stat_bench/util/ordered_map.h"
 
 namespace stat_bench::param {
 
-ParameterGenerator::ParameterGenerator(const std::vector<
-    std::pair<ParameterName, std::shared_ptr<IParameterValueVector>>>& params) {
+ParameterGenerator::ParameterGenerator(
+    const std::vector<std::pair<ParameterName,
+        std::shared_ptr<IParameterValueVector>>>& params,
+    const std::vector<std::vector<ParameterName>>& zipped_params,
+    std::vector<ParameterConstraint> constraints,
+    const ParameterSamplingConfig& sampling)
+    : constraints_(std::move(constraints)) {
+    for (const auto& group : zipped_params) {
+        std::size_t size = 0;
+        bool is_first = true;
+        for (const auto& name : group) {
+            const auto iter = std::find_if(params.begin(), params.end(),
+                [&name](const auto& param) { return param.first == name; });
+            if (iter == params.end()) {
+                throw StatBenchException(fmt::format(
+                    FMT_STRING("Zipped parameter {} not found."), name));
+            }
+            if (is_first) {
+                size = iter->second->size();
+                is_first = false;
+            } else if (iter->second->size() != size) {
+                throw StatBenchException(fmt::format(
+                    FMT_STRING("Zipped parameter {} has {} values, but {} "
+                               "values are required."),
+                    name, iter->second->size(), size));
+            }
+        }
+    }
+
     params_.reserve(params.size());
     for (const auto& param : params) {
         if (param.second->size() == 0) {
@@ -35,15 +69,84 @@ ParameterGenerator::ParameterGenerator(const std::vector<
         params_.push_back(ParamData{param.first, param.second,
             param.second->begin(), param.second->begin(), param.second->end()});
     }
+
+    constexpr auto no_group = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> zipped_group_indices(params_.size(), no_group);
+    for (std::size_t group_index = 0; group_index < zipped_params.size();
+         ++group_index) {
+        for (const auto& name : zipped_params[group_index]) {
+            for (std::size_t i = 0; i < params_.size(); ++i) {
+                if (params_[i].name != name) {
+                    continue;
+                }
+                if (zipped_group_indices[i] != no_group) {
+                    throw StatBenchException(fmt::format(
+                        FMT_STRING("Parameter {} is zipped more than once."),
+                        name));
+                }
+                zipped_group_indices[i] = group_index;
+            }
+        }
+    }
+
+    // Groups are ordered by the first parameter in each group.
+    std::vector<bool> added_zipped_groups(zipped_params.size(), false);
+    for (std::size_t i = 0; i < params_.size(); ++i) {
+        const std::size_t group_index = zipped_group_indices[i];
+        if (group_index == no_group) {
+            groups_.push_back(std::vector<std::size_t>{i});
+            continue;
+        }
+        if (added_zipped_groups[group_index]) {
+            continue;
+        }
+        added_zipped_groups[group_index] = true;
+        auto& group = groups_.emplace_back();
+        for (std::size_t j = i; j < params_.size(); ++j) {
+            if (zipped_group_indices[j] == group_index) {
+                group.push_back(j);
+            }
+        }
+    }
+
+    if (sampling.method == ParameterSamplingMethod::full &&
+        sampling.max_conditions == 0) {
+        empty_ = !satisfies_constraints() && !iterate();
+        return;
+    }
+
+    is_sampled_ = true;
+    std::vector<std::size_t> sizes;
+    sizes.reserve(groups_.size());
+    for (const auto& group : groups_) {
+        sizes.push_back(params_[group.front()].values->size());
+    }
+    sampled_indices_ = sample_parameter_indices(
+        sizes, sampling, [this](const std::vector<std::size_t>& indices) {
+            set_indices(indices);
+            return satisfies_constraints();
+        });
+    empty_ = sampled_indices_.empty();
+    if (!empty_) {
+        set_indices(sampled_indices_.front());
+    }
 }
 
+auto ParameterGenerator::empty() const noexcept -> bool { return empty_; }
+
 auto ParameterGenerator::iterate() -> bool {
-    for (auto iter = params_.rbegin(); iter != params_.rend(); ++iter) {
-        ++(iter->next);
-        if (iter->next != iter->end) {
+    if (is_sampled_) {
+        if (current_sample_ + 1 >= sampled_indices_.size()) {
+            return false;
+        }
+        ++current_sample_;
+        set_indices(sampled_indices_[current_sample_]);
+        return true;
+    }
+    while (iterate_once()) {
+        if (satisfies_constraints()) {
             return true;
         }
-        iter->next = iter->begin;
     }
     return false;
 }
@@ -57,4 +160,44 @@ auto ParameterGenerator::generate() const -> ParameterDict {
     return ParameterDict(data);
 }
 
+auto ParameterGenerator::iterate_once() -> bool {
+    for (auto iter = groups_.rbegin(); iter != groups_.rend(); ++iter) {
+        for (const std::size_t index : *iter) {
+            ++(params_[index].next);
+        }
+        const auto& first = params_[iter->front()];
+        if (first.next != first.end) {
+            return true;
+        }
+        for (const std::size_t index : *iter) {
+            params_[index].next = params_[index].begin;
+        }
+    }
+    return false;
+}
+
+auto ParameterGenerator::satisfies_constraints() const -> bool {
+    if (constraints_.empty()) {
+        return true;
+    }
+    const auto dict = generate();
+    for (const auto& constraint : constraints_) {
+        if (!constraint(dict)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ParameterGenerator::set_indices(const std::vector<std::size_t>& indices) {
+    for (std::size_t i = 0; i < groups_.size(); ++i) {
+        for (const std::size_t index : groups_[i]) {
+            auto& param = params_[index];
+            param.next = param.begin +
+                static_cast<IParameterValueVector::ConstIterator::
+                        difference_type>(indices[i]);
+        }
+    }
+}
+
 }  // namespace stat_bench::param
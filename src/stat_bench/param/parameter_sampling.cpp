@@ -0,0 +1,431 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to sample parameters.
+ */
+#include "stat_bench/param/parameter_sampling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::param {
+
+namespace {
+
+//! Type of combinations of indices.
+using IndexTuple = std::vector<std::size_t>;
+
+//! Type of functions to check combinations.
+using IndexTupleValidator = std::function<bool(const IndexTuple&)>;
+
+/*!
+ * \brief Maximum number of combinations to enumerate in random sampling.
+ *
+ * Larger spaces are sampled by drawing combinations one by one.
+ */
+constexpr std::size_t max_enumerated_combinations = 1U << 20U;
+
+//! Maximum number of trials per combination in random sampling.
+constexpr std::size_t max_trials_per_condition = 100;
+
+//! Type of random number generators.
+using RandomEngine = std::mt19937;
+
+/*!
+ * \brief Draw a uniformly distributed integer less than a bound.
+ *
+ * Distributions in the standard library depend on its implementation, so
+ * Lemire's nearly divisionless method is used instead to sample the same
+ * combinations with the same seed on all platforms.
+ *
+ * \param[in] engine Random number generator.
+ * \param[in] bound Bound. (Must be positive and fit in 32 bits.)
+ * \return Integer in [0, bound).
+ */
+[[nodiscard]] auto draw_index(RandomEngine& engine, std::size_t bound)
+    -> std::size_t {
+    if (bound == 0 || bound > std::numeric_limits<std::uint32_t>::max()) {
+        throw StatBenchException("Invalid bound of random indices.");
+    }
+    const auto range = static_cast<std::uint32_t>(bound);
+    std::uint64_t product =
+        static_cast<std::uint64_t>(static_cast<std::uint32_t>(engine())) *
+        range;
+    auto low = static_cast<std::uint32_t>(product);
+    if (low < range) {
+        // Values below (2^32 - range) % range are rejected to remove bias.
+        const std::uint32_t threshold =
+            static_cast<std::uint32_t>(-range) % range;
+        while (low < threshold) {
+            product = static_cast<std::uint64_t>(
+                          static_cast<std::uint32_t>(engine())) *
+                range;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<std::size_t>(product >> 32U);  // NOLINT
+}
+
+/*!
+ * \brief Draw a uniformly distributed real number in [0, 1).
+ *
+ * \param[in] engine Random number generator.
+ * \return Number.
+ */
+[[nodiscard]] auto draw_unit(RandomEngine& engine) -> double {
+    constexpr double scale = 1.0 / 4294967296.0;  // 2^(-32)
+    return static_cast<double>(static_cast<std::uint32_t>(engine())) * scale;
+}
+
+/*!
+ * \brief Shuffle values using Fisher-Yates shuffle.
+ *
+ * \param[in,out] values Values.
+ * \param[in] engine Random number generator.
+ */
+void shuffle_indices(std::vector<std::size_t>& values, RandomEngine& engine) {
+    for (std::size_t i = values.size(); i > 1; --i) {
+        std::swap(values[i - 1], values[draw_index(engine, i)]);
+    }
+}
+
+/*!
+ * \brief Count the number of all combinations.
+ *
+ * \param[in] sizes Number of values of each parameter.
+ * \return Number of combinations. (Saturated to the maximum value of
+ * std::size_t.)
+ */
+[[nodiscard]] auto count_combinations(const std::vector<std::size_t>& sizes)
+    -> std::size_t {
+    std::size_t count = 1;
+    for (const std::size_t size : sizes) {
+        if (size != 0 &&
+            count > std::numeric_limits<std::size_t>::max() / size) {
+            return std::numeric_limits<std::size_t>::max();
+        }
+        count *= size;
+    }
+    return count;
+}
+
+/*!
+ * \brief Convert an index of a combination to indices of parameter values.
+ *
+ * \param[in] index Index of the combination in the order of the full
+ * iteration.
+ * \param[in] sizes Number of values of each parameter.
+ * \return Indices of parameter values.
+ */
+[[nodiscard]] auto decode_index(std::size_t index,
+    const std::vector<std::size_t>& sizes) -> IndexTuple {
+    IndexTuple indices(sizes.size(), 0);
+    for (std::size_t i = sizes.size(); i > 0; --i) {
+        indices[i - 1] = index % sizes[i - 1];
+        index /= sizes[i - 1];
+    }
+    return indices;
+}
+
+/*!
+ * \brief Count bits set to one.
+ *
+ * \param[in] value Value.
+ * \return Number of bits.
+ */
+[[nodiscard]] auto count_bits(std::uint64_t value) -> std::size_t {
+    std::size_t count = 0;
+    while (value != 0U) {
+        value &= value - 1U;
+        ++count;
+    }
+    return count;
+}
+
+/*!
+ * \brief Sample all combinations in the order of the full iteration.
+ *
+ * \param[in] sizes Number of values of each parameter.
+ * \param[in] max_conditions Maximum number of combinations. (Zero for no
+ * limit.)
+ * \param[in] is_valid Function to check whether a combination is valid.
+ * \return Combinations.
+ */
+[[nodiscard]] auto sample_all(const std::vector<std::size_t>& sizes,
+    std::size_t max_conditions, const IndexTupleValidator& is_valid)
+    -> std::vector<IndexTuple> {
+    const std::size_t total = count_combinations(sizes);
+    if (total == std::numeric_limits<std::size_t>::max() &&
+        max_conditions == 0) {
+        throw StatBenchException("Too many combinations of parameters.");
+    }
+    std::vector<IndexTuple> result;
+    for (std::size_t i = 0; i < total; ++i) {
+        if (max_conditions != 0 && result.size() >= max_conditions) {
+            break;
+        }
+        auto indices = decode_index(i, sizes);
+        if (is_valid(indices)) {
+            result.push_back(std::move(indices));
+        }
+    }
+    return result;
+}
+
+/*!
+ * \brief Sample a random subset of combinations.
+ *
+ * \param[in] sizes Number of values of each parameter.
+ * \param[in] max_conditions Maximum number of combinations.
+ * \param[in] engine Random number generator.
+ * \param[in] is_valid Function to check whether a combination is valid.
+ * \return Combinations.
+ */
+[[nodiscard]] auto sample_random(const std::vector<std::size_t>& sizes,
+    std::size_t max_conditions, RandomEngine& engine,
+    const IndexTupleValidator& is_valid) -> std::vector<IndexTuple> {
+    const std::size_t total = count_combinations(sizes);
+    if (total <= max_enumerated_combinations) {
+        std::vector<std::size_t> order(total);
+        std::iota(order.begin(), order.end(), static_cast<std::size_t>(0));
+        shuffle_indices(order, engine);
+
+        std::vector<std::size_t> selected;
+        for (const std::size_t index : order) {
+            if (selected.size() >= max_conditions) {
+                break;
+            }
+            if (is_valid(decode_index(index, sizes))) {
+                selected.push_back(index);
+            }
+        }
+        std::sort(selected.begin(), selected.end());
+
+        std::vector<IndexTuple> result;
+        result.reserve(selected.size());
+        for (const std::size_t index : selected) {
+            result.push_back(decode_index(index, sizes));
+        }
+        return result;
+    }
+
+    std::set<IndexTuple> tried;
+    std::set<IndexTuple> selected;
+    const std::size_t max_trials = max_conditions * max_trials_per_condition;
+    IndexTuple indices(sizes.size(), 0);
+    for (std::size_t trial = 0;
+         trial < max_trials && selected.size() < max_conditions; ++trial) {
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            indices[i] = draw_index(engine, sizes[i]);
+        }
+        if (!tried.insert(indices).second) {
+            continue;
+        }
+        if (is_valid(indices)) {
+            selected.insert(indices);
+        }
+    }
+    return std::vector<IndexTuple>(selected.begin(), selected.end());
+}
+
+/*!
+ * \brief Sample combinations using Latin hypercube sampling.
+ *
+ * \param[in] sizes Number of values of each parameter.
+ * \param[in] max_conditions Maximum number of combinations.
+ * \param[in] engine Random number generator.
+ * \param[in] is_valid Function to check whether a combination is valid.
+ * \return Combinations.
+ */
+[[nodiscard]] auto sample_latin_hypercube(
+    const std::vector<std::size_t>& sizes, std::size_t max_conditions,
+    RandomEngine& engine, const IndexTupleValidator& is_valid)
+    -> std::vector<IndexTuple> {
+    // Each parameter is divided into max_conditions strata over the indices
+    // of values, and each stratum is used exactly once.
+    std::vector<std::vector<std::size_t>> strata(sizes.size());
+    for (auto& permutation : strata) {
+        permutation.resize(max_conditions);
+        std::iota(permutation.begin(), permutation.end(),
+            static_cast<std::size_t>(0));
+        shuffle_indices(permutation, engine);
+    }
+
+    std::set<IndexTuple> selected;
+    IndexTuple indices(sizes.size(), 0);
+    for (std::size_t sample = 0; sample < max_conditions; ++sample) {
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            const double position =
+                (static_cast<double>(strata[i][sample]) + draw_unit(engine)) /
+                static_cast<double>(max_conditions);
+            indices[i] = std::min(sizes[i] - 1,
+                static_cast<std::size_t>(
+                    position * static_cast<double>(sizes[i])));
+        }
+        if (is_valid(indices)) {
+            selected.insert(indices);
+        }
+    }
+    return std::vector<IndexTuple>(selected.begin(), selected.end());
+}
+
+/*!
+ * \brief Sample combinations using a two-level fractional factorial design.
+ *
+ * \note The number of combinations can exceed max_conditions when it is too
+ * small to estimate all main effects.
+ *
+ * \param[in] sizes Number of values of each parameter.
+ * \param[in] max_conditions Maximum number of combinations. (Zero for no
+ * limit.)
+ * \param[in] is_valid Function to check whether a combination is valid.
+ * \return Combinations.
+ */
+[[nodiscard]] auto sample_fractional_factorial(
+    const std::vector<std::size_t>& sizes, std::size_t max_conditions,
+    const IndexTupleValidator& is_valid) -> std::vector<IndexTuple> {
+    // Parameters with two or more values are factors, and their first and
+    // last values are used as the two levels.
+    std::vector<std::size_t> factors;
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        if (sizes[i] >= 2) {
+            factors.push_back(i);
+        }
+    }
+    const std::size_t num_factors = factors.size();
+
+    // Number of basic factors whose all combinations are used.
+    std::size_t min_basic_factors = 0;
+    while ((static_cast<std::uint64_t>(1) << min_basic_factors) - 1U <
+        num_factors) {
+        ++min_basic_factors;
+    }
+    std::size_t budget_basic_factors = num_factors;
+    if (max_conditions != 0) {
+        budget_basic_factors = 0;
+        while (budget_basic_factors < num_factors &&
+            (static_cast<std::size_t>(1) << (budget_basic_factors + 1)) <=
+                max_conditions) {
+            ++budget_basic_factors;
+        }
+    }
+    const std::size_t num_basic_factors = std::min(
+        num_factors, std::max(min_basic_factors, budget_basic_factors));
+
+    // Remaining factors are aliased with interactions of basic factors,
+    // preferring interactions of higher orders.
+    std::vector<std::uint64_t> masks;
+    masks.reserve(num_factors);
+    for (std::size_t i = 0; i < num_basic_factors; ++i) {
+        masks.push_back(static_cast<std::uint64_t>(1) << i);
+    }
+    std::vector<std::uint64_t> interactions;
+    const std::uint64_t num_runs = static_cast<std::uint64_t>(1)
+        << num_basic_factors;
+    for (std::uint64_t mask = 0; mask < num_runs; ++mask) {
+        if (count_bits(mask) >= 2) {
+            interactions.push_back(mask);
+        }
+    }
+    std::stable_sort(interactions.begin(), interactions.end(),
+        [](std::uint64_t lhs, std::uint64_t rhs) {
+            return count_bits(lhs) > count_bits(rhs);
+        });
+    for (std::size_t i = num_basic_factors; i < num_factors; ++i) {
+        masks.push_back(interactions[i - num_basic_factors]);
+    }
+
+    std::set<IndexTuple> selected;
+    IndexTuple indices(sizes.size(), 0);
+    for (std::uint64_t run = 0; run < num_runs; ++run) {
+        for (std::size_t i = 0; i < num_factors; ++i) {
+            const bool is_high = (count_bits(run & masks[i]) % 2U) == 1U;
+            indices[factors[i]] = is_high ? sizes[factors[i]] - 1 : 0;
+        }
+        if (is_valid(indices)) {
+            selected.insert(indices);
+        }
+    }
+    return std::vector<IndexTuple>(selected.begin(), selected.end());
+}
+
+}  // namespace
+
+auto parse_parameter_sampling_method(const std::string& str)
+    -> ParameterSamplingMethod {
+    if (str == "full") {
+        return ParameterSamplingMethod::full;
+    }
+    if (str == "random") {
+        return ParameterSamplingMethod::random;
+    }
+    if (str == "latin_hypercube") {
+        return ParameterSamplingMethod::latin_hypercube;
+    }
+    if (str == "fractional_factorial") {
+        return ParameterSamplingMethod::fractional_factorial;
+    }
+    throw StatBenchException(fmt::format(
+        FMT_STRING("Invalid method to sample parameters: {}."), str));
+}
+
+auto sample_parameter_indices(const std::vector<std::size_t>& sizes,
+    const ParameterSamplingConfig& config,
+    const std::function<bool(const std::vector<std::size_t>&)>& is_valid)
+    -> std::vector<std::vector<std::size_t>> {
+    if (std::find(sizes.begin(), sizes.end(), static_cast<std::size_t>(0)) !=
+        sizes.end()) {
+        return {};
+    }
+
+    RandomEngine engine(config.seed);
+    switch (config.method) {
+    case ParameterSamplingMethod::full:
+        break;
+    case ParameterSamplingMethod::random:
+        if (config.max_conditions != 0 &&
+            count_combinations(sizes) > config.max_conditions) {
+            return sample_random(
+                sizes, config.max_conditions, engine, is_valid);
+        }
+        break;
+    case ParameterSamplingMethod::latin_hypercube:
+        if (config.max_conditions != 0 &&
+            count_combinations(sizes) > config.max_conditions) {
+            return sample_latin_hypercube(
+                sizes, config.max_conditions, engine, is_valid);
+        }
+        break;
+    case ParameterSamplingMethod::fractional_factorial:
+        return sample_fractional_factorial(
+            sizes, config.max_conditions, is_valid);
+    }
+    return sample_all(sizes, config.max_conditions, is_valid);
+}
+
+}  // namespace stat_bench::param
@@ -19,6 +19,10 @@
  */
 #include "stat_bench/plots/cdf_line_plot.h"
 
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 #include <fmt/format.h>
 #include <plotly_plotter/figure.h>
 #include <plotly_plotter/figure_builders/line.h>
@@ -32,20 +36,25 @@
 
 namespace stat_bench::plots {
 
+CdfLinePlot::CdfLinePlot(std::size_t max_points_per_trace)
+    : max_points_per_trace_(max_points_per_trace) {}
+
 auto CdfLinePlot::name_for_file() const -> const util::Utf8String& {
     return name_for_file_;
 }
 
 void CdfLinePlot::write(const measurer::MeasurementType& measurement_type,
     const BenchmarkGroupName& group_name,
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::string& file_path) {
     (void)group_name;
 
     const auto title = util::Utf8String(fmt::format(
         "Cumulative Distribution Function of {}", measurement_type.str()));
 
-    const auto data_table = create_data_table_for_cdf_plot(measurements);
+    const auto data_table = create_data_table_for_cdf_plot(
+        measurements, max_points_per_trace_);
     auto figure = plotly_plotter::figure_builders::line(data_table)
                       .x(time_label)
                       .y(cumulative_probability_label)
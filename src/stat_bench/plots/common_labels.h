@@ -46,4 +46,29 @@ constexpr const char* sample_index_label = "Sample Index";
  */
 constexpr const char* cumulative_probability_label = "Cumulative Probability";
 
+/*!
+ * \brief Label for probability density in plots.
+ */
+constexpr const char* probability_density_label = "Probability Density";
+
+/*!
+ * \brief Label for numbers of threads in plots.
+ */
+constexpr const char* num_threads_label = "Threads";
+
+/*!
+ * \brief Label for names of metrics in plots.
+ */
+constexpr const char* metric_label = "Metric";
+
+/*!
+ * \brief Label for values of metrics in plots.
+ */
+constexpr const char* metric_value_label = "Value";
+
+/*!
+ * \brief Label for numbers of iterations in plots.
+ */
+constexpr const char* iterations_label = "Iterations";
+
 }  // namespace stat_bench::plots
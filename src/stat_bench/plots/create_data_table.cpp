@@ -20,11 +20,13 @@
 #include "create_data_table.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -36,13 +38,23 @@
 #include "common_labels.h"
 #include "stat_bench/benchmark_condition.h"
 #include "stat_bench/benchmark_full_name.h"
+#include "stat_bench/measurer/analyze_thread_scaling.h"
+#include "stat_bench/measurer/fit_complexity_by_case.h"
+#include "stat_bench/param/auto_num_threads.h"
+#include "stat_bench/param/num_threads_parameter_name.h"
 #include "stat_bench/param/parameter_dict.h"
 #include "stat_bench/param/parameter_name.h"
 #include "stat_bench/param/parameter_value.h"
+#include "stat_bench/plots/decimate_samples.h"
 #include "stat_bench/plots/plot_utils.h"
+#include "stat_bench/stat/complexity_fit.h"
+#include "stat_bench/stat/density_estimation.h"
+#include "stat_bench/stat/linear_regression.h"
+#include "stat_bench/stat/scalability_fit.h"
 #include "stat_bench/stat/statistics.h"
 #include "stat_bench/stat_bench_exception.h"
 #include "stat_bench/util/utf8_string.h"
+#include "stat_bench/util/worker_pool.h"
 
 namespace plotly_plotter {
 
@@ -97,53 +109,223 @@ struct formatter<stat_bench::param::ParameterValueVariant>
 
 namespace stat_bench::plots {
 
-auto create_data_table_with_mean_time(
-    const std::vector<measurer::Measurement>& measurements,
+namespace {
+
+/*!
+ * \brief Sort measurements by the value of a parameter.
+ *
+ * Lines in plots connect points in the order of rows in data tables, so
+ * measurements are sorted for grids of parameters not generated in the order
+ * of the parameter (e.g., sampled grids).
+ *
+ * \param[in] measurements Measurements.
+ * \param[in] parameter_names Parameter names. (The first one is used.)
+ * \return Sorted measurements.
+ */
+[[nodiscard]] auto sort_by_parameter(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::vector<param::ParameterName>& parameter_names)
-    -> plotly_plotter::data_table {
-    std::vector<std::string> case_names;
-    std::vector<double> processing_times;
-    std::vector<double> processing_time_errors;
+    -> std::vector<std::shared_ptr<const measurer::Measurement>> {
+    auto sorted = measurements;
+    if (parameter_names.empty()) {
+        return sorted;
+    }
+    const auto& parameter_name = parameter_names.front();
+    std::stable_sort(sorted.begin(), sorted.end(),
+        [&parameter_name](const auto& lhs, const auto& rhs) {
+            return lhs->cond().params().get_as_variant(parameter_name) <
+                rhs->cond().params().get_as_variant(parameter_name);
+        });
+    return sorted;
+}
+
+/*!
+ * \brief Remove parameters plotted in axes from parameters.
+ *
+ * Descriptions of thread placement are removed with numbers of threads, so
+ * that a line of numbers of threads isn't split by placement.
+ *
+ * \param[in] params Parameters.
+ * \param[in] parameter_names Names of parameters plotted in axes.
+ * \return Remaining parameters.
+ */
+[[nodiscard]] auto remove_plotted_parameters(const param::ParameterDict& params,
+    const std::vector<param::ParameterName>& parameter_names)
+    -> param::ParameterDict {
+    auto remaining_params = params;
+    for (const auto& parameter_name : parameter_names) {
+        remaining_params = remaining_params.clone_without(parameter_name);
+        if (parameter_name == param::num_threads_parameter_name() &&
+            remaining_params.has(param::expected_placement_parameter_name())) {
+            remaining_params = remaining_params.clone_without(
+                param::expected_placement_parameter_name());
+        }
+    }
+    return remaining_params;
+}
+
+}  // namespace
+
+namespace {
+
+/*!
+ * \brief Struct of columns of data tables with the mean of processing time.
+ */
+struct MeanTimeColumns {
+    //! Names of cases.
+    std::vector<std::string> case_names{};
+
+    //! Processing times.
+    std::vector<double> processing_times{};
+
+    //! Standard errors of processing times.
+    std::vector<double> processing_time_errors{};
+
+    //! Parameter values.
     std::unordered_map<param::ParameterName,
         std::vector<param::ParameterValueVariant>>
-        parameter_values_map;
+        parameter_values_map{};
+};
 
-    for (const auto& measurement : measurements) {
-        const auto& case_name = measurement.case_info().case_name();
-        auto params_without_target = measurement.cond().params();
-        for (const auto& parameter_name : parameter_names) {
-            params_without_target =
-                params_without_target.clone_without(parameter_name);
-        }
+/*!
+ * \brief Append rows of the mean of processing time.
+ *
+ * \param[in,out] columns Columns.
+ * \param[in] measurements Measurements.
+ * \param[in] parameter_names Names of parameters to include in the table.
+ */
+void append_mean_time_rows(MeanTimeColumns& columns,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    const std::vector<param::ParameterName>& parameter_names) {
+    for (const auto& measurement :
+        sort_by_parameter(measurements, parameter_names)) {
+        const auto& case_name = measurement->case_info().case_name();
+        const auto params_without_target = remove_plotted_parameters(
+            measurement->cond().params(), parameter_names);
         const auto case_name_for_plot =
             generate_plot_name(case_name, params_without_target);
-        case_names.push_back(case_name_for_plot.str());
+        columns.case_names.push_back(case_name_for_plot.str());
 
-        processing_times.push_back(measurement.durations_stat().mean());
-        processing_time_errors.push_back(
-            measurement.durations_stat().standard_error());
+        columns.processing_times.push_back(
+            measurement->durations_stat().mean());
+        columns.processing_time_errors.push_back(
+            measurement->durations_stat().standard_error());
 
         for (const auto& parameter_name : parameter_names) {
-            parameter_values_map[parameter_name].push_back(
-                measurement.cond().params().get_as_variant(parameter_name));
+            columns.parameter_values_map[parameter_name].push_back(
+                measurement->cond().params().get_as_variant(parameter_name));
         }
     }
+}
 
+/*!
+ * \brief Create a data table from columns.
+ *
+ * \param[in] columns Columns.
+ * \param[in] parameter_names Names of parameters to include in the table.
+ * \return Created data table.
+ */
+[[nodiscard]] auto create_data_table_from_columns(MeanTimeColumns&& columns,
+    const std::vector<param::ParameterName>& parameter_names)
+    -> plotly_plotter::data_table {
     plotly_plotter::data_table table;
-    table.emplace(case_name_label, std::move(case_names));
-    table.emplace(time_label, std::move(processing_times));
-    table.emplace(time_error_label, std::move(processing_time_errors));
+    table.emplace(case_name_label, std::move(columns.case_names));
+    table.emplace(time_label, std::move(columns.processing_times));
+    table.emplace(time_error_label, std::move(columns.processing_time_errors));
     for (const auto& parameter_name : parameter_names) {
         table.emplace(parameter_name.str().str(),
-            std::move(parameter_values_map[parameter_name]));
+            std::move(columns.parameter_values_map[parameter_name]));
     }
     return table;
 }
 
+/*!
+ * \brief Generate values of a parameter at which fitted curves are drawn.
+ *
+ * \param[in] sorted_values Sorted values of the parameter in measurements.
+ * \return Values of the parameter.
+ */
+[[nodiscard]] auto generate_fitted_curve_points(
+    const std::vector<double>& sorted_values) -> std::vector<double> {
+    // Points between measured values make curves of non-linear models smooth.
+    constexpr std::size_t points_per_interval = 8;
+    std::vector<double> points;
+    for (std::size_t i = 0; i < sorted_values.size(); ++i) {
+        if (i > 0 && sorted_values[i - 1] < sorted_values[i]) {
+            const double log_lower = std::log(sorted_values[i - 1]);
+            const double log_upper = std::log(sorted_values[i]);
+            for (std::size_t j = 1; j < points_per_interval; ++j) {
+                points.push_back(std::exp(log_lower +
+                    (log_upper - log_lower) * static_cast<double>(j) /
+                        static_cast<double>(points_per_interval)));
+            }
+        }
+        points.push_back(sorted_values[i]);
+    }
+    return points;
+}
+
+}  // namespace
+
+auto create_data_table_with_mean_time(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    const std::vector<param::ParameterName>& parameter_names)
+    -> plotly_plotter::data_table {
+    MeanTimeColumns columns;
+    append_mean_time_rows(columns, measurements, parameter_names);
+    return create_data_table_from_columns(std::move(columns), parameter_names);
+}
+
+auto create_data_table_with_mean_time_and_complexity_fit(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    const std::vector<param::ParameterName>& parameter_names)
+    -> plotly_plotter::data_table {
+    MeanTimeColumns columns;
+    append_mean_time_rows(columns, measurements, parameter_names);
+
+    const auto& fitted_parameter_name = parameter_names.front();
+    for (const auto& fit :
+        measurer::fit_complexity_by_case(measurements, fitted_parameter_name)) {
+        const auto params_without_target =
+            remove_plotted_parameters(fit.params, parameter_names);
+        const auto case_name_for_plot = fmt::format(FMT_STRING("{} ({})"),
+            generate_plot_name(fit.case_name, params_without_target).str(),
+            stat::format_complexity(fit.result));
+
+        std::vector<double> sorted_values;
+        sorted_values.reserve(fit.measurements.size());
+        for (const auto& measurement : fit.measurements) {
+            sorted_values.push_back(
+                measurement->cond().params().get_as_double(
+                    fitted_parameter_name));
+        }
+        for (const double value :
+            generate_fitted_curve_points(sorted_values)) {
+            columns.case_names.push_back(case_name_for_plot);
+            columns.processing_times.push_back(
+                stat::evaluate_complexity_model(fit.result, value));
+            columns.processing_time_errors.push_back(0.0);
+            columns.parameter_values_map[fitted_parameter_name].emplace_back(
+                static_cast<long double>(value));
+            for (std::size_t i = 1; i < parameter_names.size(); ++i) {
+                columns.parameter_values_map[parameter_names[i]].push_back(
+                    fit.params.get_as_variant(parameter_names[i]));
+            }
+        }
+    }
+
+    return create_data_table_from_columns(std::move(columns), parameter_names);
+}
+
 namespace {
 
 auto create_data_table_with_custom_output_without_stat(
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::vector<param::ParameterName>& parameter_names,
     const CustomOutputName& output_name)
     -> std::pair<plotly_plotter::data_table, bool> {
@@ -156,26 +338,23 @@ auto create_data_table_with_custom_output_without_stat(
     std::vector<double> custom_outputs;
 
     for (const auto& measurement : measurements) {
-        const auto& case_name = measurement.case_info().case_name();
-        auto params_without_target = measurement.cond().params();
-        for (const auto& parameter_name : parameter_names) {
-            params_without_target =
-                params_without_target.clone_without(parameter_name);
-        }
+        const auto& case_name = measurement->case_info().case_name();
+        const auto params_without_target = remove_plotted_parameters(
+            measurement->cond().params(), parameter_names);
         const auto case_name_for_plot =
             generate_plot_name(case_name, params_without_target);
         case_names.push_back(case_name_for_plot.str());
 
-        processing_times.push_back(measurement.durations_stat().mean());
+        processing_times.push_back(measurement->durations_stat().mean());
         processing_time_errors.push_back(
-            measurement.durations_stat().standard_error());
+            measurement->durations_stat().standard_error());
 
         for (const auto& parameter_name : parameter_names) {
             parameter_values_map[parameter_name].push_back(
-                measurement.cond().params().get_as_variant(parameter_name));
+                measurement->cond().params().get_as_variant(parameter_name));
         }
 
-        const auto& current_custom_outputs = measurement.custom_outputs();
+        const auto& current_custom_outputs = measurement->custom_outputs();
         const auto iter = std::find_if(current_custom_outputs.begin(),
             current_custom_outputs.end(), [&output_name](const auto& pair) {
                 return pair.first == output_name;
@@ -202,7 +381,8 @@ auto create_data_table_with_custom_output_without_stat(
 }
 
 auto create_data_table_with_custom_output_with_stat(
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::vector<param::ParameterName>& parameter_names,
     const CustomOutputName& output_name)
     -> std::pair<plotly_plotter::data_table, bool> {
@@ -216,26 +396,23 @@ auto create_data_table_with_custom_output_with_stat(
     std::vector<double> custom_output_errors;
 
     for (const auto& measurement : measurements) {
-        const auto& case_name = measurement.case_info().case_name();
-        auto params_without_target = measurement.cond().params();
-        for (const auto& parameter_name : parameter_names) {
-            params_without_target =
-                params_without_target.clone_without(parameter_name);
-        }
+        const auto& case_name = measurement->case_info().case_name();
+        const auto params_without_target = remove_plotted_parameters(
+            measurement->cond().params(), parameter_names);
         const auto case_name_for_plot =
             generate_plot_name(case_name, params_without_target);
         case_names.push_back(case_name_for_plot.str());
 
-        processing_times.push_back(measurement.durations_stat().mean());
+        processing_times.push_back(measurement->durations_stat().mean());
         processing_time_errors.push_back(
-            measurement.durations_stat().standard_error());
+            measurement->durations_stat().standard_error());
 
         for (const auto& parameter_name : parameter_names) {
             parameter_values_map[parameter_name].push_back(
-                measurement.cond().params().get_as_variant(parameter_name));
+                measurement->cond().params().get_as_variant(parameter_name));
         }
 
-        const auto& current_custom_outputs = measurement.custom_stat_outputs();
+        const auto& current_custom_outputs = measurement->custom_stat_outputs();
         const auto iter = std::find_if(current_custom_outputs.begin(),
             current_custom_outputs.end(), [&output_name](const auto& output) {
                 return output->name() == output_name;
@@ -245,7 +422,7 @@ auto create_data_table_with_custom_output_with_stat(
                 "Custom output {} not found in a measurement.", output_name));
         }
         const std::size_t index = iter - current_custom_outputs.begin();
-        const auto& stat = measurement.custom_stat().at(index);
+        const auto& stat = measurement->custom_stat().at(index);
         custom_outputs.push_back(stat.mean());
         custom_output_errors.push_back(stat.standard_error());
     }
@@ -269,26 +446,31 @@ auto create_data_table_with_custom_output_with_stat(
 }  // namespace
 
 auto create_data_table_with_custom_output(
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::vector<param::ParameterName>& parameter_names,
     const CustomOutputName& output_name)
     -> std::pair<plotly_plotter::data_table, bool> {
-    const auto& first_custom_outputs = measurements.front().custom_outputs();
+    const auto sorted_measurements =
+        sort_by_parameter(measurements, parameter_names);
+    const auto& first_custom_outputs =
+        sorted_measurements.front()->custom_outputs();
     const auto first_custom_output_iter = std::find_if(
         first_custom_outputs.begin(), first_custom_outputs.end(),
         [&output_name](const auto& pair) { return pair.first == output_name; });
     if (first_custom_output_iter != first_custom_outputs.end()) {
         // Case of custom output without statistics.
         return create_data_table_with_custom_output_without_stat(
-            measurements, parameter_names, output_name);
+            sorted_measurements, parameter_names, output_name);
     }
     // Case of custom output with statistics.
     return create_data_table_with_custom_output_with_stat(
-        measurements, parameter_names, output_name);
+        sorted_measurements, parameter_names, output_name);
 }
 
 auto create_data_table_with_all_time(
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::vector<param::ParameterName>& parameter_names)
     -> plotly_plotter::data_table {
     std::vector<std::string> case_names;
@@ -299,17 +481,14 @@ auto create_data_table_with_all_time(
         parameter_values_map;
 
     for (const auto& measurement : measurements) {
-        const auto& case_name = measurement.case_info().case_name();
-        auto params_without_target = measurement.cond().params();
-        for (const auto& parameter_name : parameter_names) {
-            params_without_target =
-                params_without_target.clone_without(parameter_name);
-        }
+        const auto& case_name = measurement->case_info().case_name();
+        const auto params_without_target = remove_plotted_parameters(
+            measurement->cond().params(), parameter_names);
         const auto case_name_for_plot =
             generate_plot_name(case_name, params_without_target);
 
-        const auto processing_times_for_plot =
-            measurement.durations_stat().unsorted_samples();
+        const auto& processing_times_for_plot =
+            measurement->durations_stat().unsorted_samples();
         const std::size_t num_samples = processing_times_for_plot.size();
 
         case_names.insert(
@@ -324,7 +503,7 @@ auto create_data_table_with_all_time(
 
         for (const auto& parameter_name : parameter_names) {
             const auto parameter_value =
-                measurement.cond().params().get_as_variant(parameter_name);
+                measurement->cond().params().get_as_variant(parameter_name);
             parameter_values_map[parameter_name].insert(
                 parameter_values_map[parameter_name].end(), num_samples,
                 parameter_value);
@@ -342,32 +521,94 @@ auto create_data_table_with_all_time(
     return table;
 }
 
-auto create_data_table_for_cdf_plot(
-    const std::vector<measurer::Measurement>& measurements)
-    -> plotly_plotter::data_table {
+auto create_data_table_with_decimated_time(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t max_points_per_trace) -> plotly_plotter::data_table {
     std::vector<std::string> case_names;
-    std::vector<double> probabilities;
+    std::vector<std::size_t> indices;
     std::vector<double> processing_times;
 
     for (const auto& measurement : measurements) {
-        const auto& case_name = measurement.case_info().case_name();
-        const auto& params = measurement.cond().params();
+        const auto& case_name = measurement->case_info().case_name();
+        const auto& params = measurement->cond().params();
         const auto case_name_for_plot = generate_plot_name(case_name, params);
 
-        const auto processing_times_for_plot =
-            measurement.durations_stat().sorted_samples();
-        const std::size_t num_samples = processing_times_for_plot.size();
+        const auto& samples = measurement->durations_stat().unsorted_samples();
+        const auto selected_indices =
+            decimate_min_max(samples, max_points_per_trace);
 
-        case_names.insert(
-            case_names.end(), num_samples, case_name_for_plot.str());
-        for (std::size_t i = 0; i < num_samples; ++i) {
-            probabilities.push_back(
-                static_cast<double>(i + 1) / static_cast<double>(num_samples));
+        case_names.insert(case_names.end(), selected_indices.size(),
+            case_name_for_plot.str());
+        for (const std::size_t index : selected_indices) {
+            indices.push_back(index + 1);
+            processing_times.push_back(samples[index]);
         }
+    }
+
+    plotly_plotter::data_table table;
+    table.emplace(case_name_label, std::move(case_names));
+    table.emplace(sample_index_label, std::move(indices));
+    table.emplace(time_label, std::move(processing_times));
+    return table;
+}
+
+auto create_data_table_with_time_distribution(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t max_points_per_trace) -> plotly_plotter::data_table {
+    std::vector<std::string> case_names;
+    std::vector<double> processing_times;
+
+    for (const auto& measurement : measurements) {
+        const auto& case_name = measurement->case_info().case_name();
+        const auto& params = measurement->cond().params();
+        const auto case_name_for_plot = generate_plot_name(case_name, params);
+
+        const auto processing_times_for_plot = reduce_for_distribution(
+            measurement->durations_stat().sorted_samples(),
+            max_points_per_trace);
+
+        case_names.insert(case_names.end(), processing_times_for_plot.size(),
+            case_name_for_plot.str());
         processing_times.insert(processing_times.end(),
             processing_times_for_plot.begin(), processing_times_for_plot.end());
     }
 
+    plotly_plotter::data_table table;
+    table.emplace(case_name_label, std::move(case_names));
+    table.emplace(time_label, std::move(processing_times));
+    return table;
+}
+
+auto create_data_table_for_cdf_plot(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t max_points_per_trace) -> plotly_plotter::data_table {
+    std::vector<std::string> case_names;
+    std::vector<double> probabilities;
+    std::vector<double> processing_times;
+
+    for (const auto& measurement : measurements) {
+        const auto& case_name = measurement->case_info().case_name();
+        const auto& params = measurement->cond().params();
+        const auto case_name_for_plot = generate_plot_name(case_name, params);
+
+        const auto& sorted_samples =
+            measurement->durations_stat().sorted_samples();
+        const std::size_t num_samples = sorted_samples.size();
+        const auto selected_indices =
+            select_quantile_indices(num_samples, max_points_per_trace);
+
+        case_names.insert(case_names.end(), selected_indices.size(),
+            case_name_for_plot.str());
+        for (const std::size_t index : selected_indices) {
+            probabilities.push_back(static_cast<double>(index + 1) /
+                static_cast<double>(num_samples));
+            processing_times.push_back(sorted_samples[index]);
+        }
+    }
+
     plotly_plotter::data_table table;
     table.emplace(case_name_label, std::move(case_names));
     table.emplace(cumulative_probability_label, std::move(probabilities));
@@ -375,4 +616,265 @@ auto create_data_table_for_cdf_plot(
     return table;
 }
 
+namespace {
+
+/*!
+ * \brief Calculate results for each measurement in parallel.
+ *
+ * \tparam Result Type of results.
+ * \tparam Function Type of the function to calculate a result.
+ * \param[in] measurements Measurements.
+ * \param[in] num_threads Number of threads.
+ * \param[in] function Function to calculate a result from a measurement.
+ * \return Results in the order of measurements.
+ */
+template <typename Result, typename Function>
+[[nodiscard]] auto calculate_for_each_measurement(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t num_threads, const Function& function) -> std::vector<Result> {
+    std::vector<Result> results(measurements.size());
+    num_threads = std::min(num_threads, measurements.size());
+    if (num_threads <= 1) {
+        for (std::size_t i = 0; i < measurements.size(); ++i) {
+            results[i] = function(*measurements[i]);
+        }
+        return results;
+    }
+
+    util::WorkerPool pool(num_threads, 2 * num_threads);
+    for (std::size_t i = 0; i < measurements.size(); ++i) {
+        pool.submit([&results, &measurements, &function, i] {
+            results[i] = function(*measurements[i]);
+        });
+    }
+    pool.wait();
+    return results;
+}
+
+}  // namespace
+
+auto create_data_table_for_histogram_plot(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t num_bins, bool log_bins, std::size_t num_threads)
+    -> plotly_plotter::data_table {
+    const auto histograms = calculate_for_each_measurement<stat::Histogram>(
+        measurements, num_threads,
+        [num_bins, log_bins](const measurer::Measurement& measurement) {
+            return stat::calc_histogram(
+                measurement.durations_stat().sorted_samples(), num_bins,
+                log_bins);
+        });
+
+    std::vector<std::string> case_names;
+    std::vector<double> processing_times;
+    std::vector<double> densities;
+    for (std::size_t i = 0; i < measurements.size(); ++i) {
+        const auto& measurement = measurements[i];
+        const auto& histogram = histograms[i];
+        if (histogram.densities.empty()) {
+            continue;
+        }
+        const auto case_name_for_plot = generate_plot_name(
+            measurement->case_info().case_name(), measurement->cond().params());
+
+        // Step curve starting and ending at zero.
+        const std::size_t num_points = 2 * histogram.densities.size() + 2;
+        case_names.insert(
+            case_names.end(), num_points, case_name_for_plot.str());
+        processing_times.push_back(histogram.edges.front());
+        densities.push_back(0.0);
+        for (std::size_t j = 0; j < histogram.densities.size(); ++j) {
+            processing_times.push_back(histogram.edges[j]);
+            densities.push_back(histogram.densities[j]);
+            processing_times.push_back(histogram.edges[j + 1]);
+            densities.push_back(histogram.densities[j]);
+        }
+        processing_times.push_back(histogram.edges.back());
+        densities.push_back(0.0);
+    }
+
+    plotly_plotter::data_table table;
+    table.emplace(case_name_label, std::move(case_names));
+    table.emplace(time_label, std::move(processing_times));
+    table.emplace(probability_density_label, std::move(densities));
+    return table;
+}
+
+auto create_data_table_for_density_plot(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t num_points, bool log_scale, std::size_t num_threads)
+    -> plotly_plotter::data_table {
+    const auto curves = calculate_for_each_measurement<stat::DensityCurve>(
+        measurements, num_threads,
+        [num_points, log_scale](const measurer::Measurement& measurement) {
+            return stat::estimate_density(
+                measurement.durations_stat().sorted_samples(), num_points,
+                log_scale);
+        });
+
+    std::vector<std::string> case_names;
+    std::vector<double> processing_times;
+    std::vector<double> densities;
+    for (std::size_t i = 0; i < measurements.size(); ++i) {
+        const auto& measurement = measurements[i];
+        const auto& curve = curves[i];
+        const auto case_name_for_plot = generate_plot_name(
+            measurement->case_info().case_name(), measurement->cond().params());
+        case_names.insert(
+            case_names.end(), curve.points.size(), case_name_for_plot.str());
+        processing_times.insert(
+            processing_times.end(), curve.points.begin(), curve.points.end());
+        densities.insert(
+            densities.end(), curve.densities.begin(), curve.densities.end());
+    }
+
+    plotly_plotter::data_table table;
+    table.emplace(case_name_label, std::move(case_names));
+    table.emplace(time_label, std::move(processing_times));
+    table.emplace(probability_density_label, std::move(densities));
+    return table;
+}
+
+namespace {
+
+/*!
+ * \brief Struct of columns of data tables for plots of scaling with numbers
+ * of threads.
+ */
+struct ThreadScalingColumns {
+    //! Names of cases.
+    std::vector<std::string> case_names{};
+
+    //! Numbers of threads.
+    std::vector<double> nums_threads{};
+
+    //! Names of metrics.
+    std::vector<std::string> metrics{};
+
+    //! Values of metrics.
+    std::vector<double> values{};
+
+    /*!
+     * \brief Append rows of the speedup and the parallel efficiency.
+     *
+     * \param[in] case_name Name of the case.
+     * \param[in] num_threads Number of threads.
+     * \param[in] speedup Speedup.
+     */
+    void append(
+        const std::string& case_name, double num_threads, double speedup) {
+        case_names.push_back(case_name);
+        nums_threads.push_back(num_threads);
+        metrics.emplace_back("Speedup");
+        values.push_back(speedup);
+
+        case_names.push_back(case_name);
+        nums_threads.push_back(num_threads);
+        metrics.emplace_back("Efficiency");
+        values.push_back(speedup / num_threads);
+    }
+};
+
+}  // namespace
+
+auto create_data_table_for_thread_scaling_plot(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements) -> plotly_plotter::data_table {
+    const auto scalings = measurer::analyze_thread_scaling(measurements);
+
+    ThreadScalingColumns columns;
+    std::vector<std::size_t> all_nums_threads;
+    for (const auto& scaling : scalings) {
+        const auto case_name_for_plot =
+            generate_plot_name(scaling.case_name, scaling.params).str();
+        for (const auto& point : scaling.points) {
+            columns.append(case_name_for_plot,
+                static_cast<double>(point.num_threads), point.speedup);
+            all_nums_threads.push_back(point.num_threads);
+        }
+
+        const auto fit_name_for_plot = fmt::format(
+            FMT_STRING("{} (USL, sigma={:.3f}, kappa={:.4f})"),
+            case_name_for_plot, scaling.usl.contention,
+            scaling.usl.coherency);
+        const auto max_num_threads = scaling.points.back().num_threads;
+        for (std::size_t num_threads = 1; num_threads <= max_num_threads;
+             ++num_threads) {
+            columns.append(fit_name_for_plot, static_cast<double>(num_threads),
+                stat::evaluate_scalability_model(
+                    scaling.usl, static_cast<double>(num_threads)));
+        }
+    }
+
+    std::sort(all_nums_threads.begin(), all_nums_threads.end());
+    all_nums_threads.erase(
+        std::unique(all_nums_threads.begin(), all_nums_threads.end()),
+        all_nums_threads.end());
+    for (const std::size_t num_threads : all_nums_threads) {
+        columns.append("Ideal", static_cast<double>(num_threads),
+            static_cast<double>(num_threads));
+    }
+
+    plotly_plotter::data_table table;
+    table.emplace(case_name_label, std::move(columns.case_names));
+    table.emplace(num_threads_label, std::move(columns.nums_threads));
+    table.emplace(metric_label, std::move(columns.metrics));
+    table.emplace(metric_value_label, std::move(columns.values));
+    return table;
+}
+
+auto create_data_table_for_iteration_regression_plot(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements) -> plotly_plotter::data_table {
+    std::vector<std::string> case_names;
+    std::vector<double> iterations;
+    std::vector<double> durations;
+
+    const auto append_line = [&case_names, &iterations, &durations](
+                                 const std::string& name,
+                                 const stat::LinearRegressionResult& result,
+                                 double min_iterations, double max_iterations) {
+        for (const double x : {min_iterations, max_iterations}) {
+            case_names.push_back(name);
+            iterations.push_back(x);
+            durations.push_back(result.slope * x + result.intercept);
+        }
+    };
+
+    for (const auto& measurement : measurements) {
+        const auto& regression = measurement->iteration_regression();
+        if (!regression.has_value() || regression->iterations.empty()) {
+            continue;
+        }
+        const auto case_name_for_plot =
+            generate_plot_name(measurement->case_info().case_name(),
+                measurement->cond().params())
+                .str();
+        for (std::size_t i = 0; i < regression->iterations.size(); ++i) {
+            case_names.push_back(case_name_for_plot);
+            iterations.push_back(regression->iterations[i]);
+            durations.push_back(regression->durations[i]);
+        }
+
+        const double min_iterations = regression->iterations.front();
+        const double max_iterations = regression->iterations.back();
+        append_line(fmt::format(FMT_STRING("{} (OLS, slope={:.3e})"),
+                        case_name_for_plot,
+                        regression->ordinary_least_squares.slope),
+            regression->ordinary_least_squares, min_iterations, max_iterations);
+        append_line(fmt::format(FMT_STRING("{} (Theil-Sen, slope={:.3e})"),
+                        case_name_for_plot, regression->theil_sen.slope),
+            regression->theil_sen, min_iterations, max_iterations);
+    }
+
+    plotly_plotter::data_table table;
+    table.emplace(case_name_label, std::move(case_names));
+    table.emplace(iterations_label, std::move(iterations));
+    table.emplace(time_label, std::move(durations));
+    return table;
+}
+
 }  // namespace stat_bench::plots
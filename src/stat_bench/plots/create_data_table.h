@@ -19,6 +19,8 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -38,7 +40,23 @@ namespace stat_bench::plots {
  * \return Created data table.
  */
 [[nodiscard]] auto create_data_table_with_mean_time(
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    const std::vector<param::ParameterName>& parameter_names)
+    -> plotly_plotter::data_table;
+
+/*!
+ * \brief Create a data table with the mean of processing time and curves of
+ * models of asymptotic complexity fitted in each case.
+ *
+ * \param[in] measurements Measurements.
+ * \param[in] parameter_names Names of parameters to include in the table.
+ * (The first one is used in fitting.)
+ * \return Created data table.
+ */
+[[nodiscard]] auto create_data_table_with_mean_time_and_complexity_fit(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::vector<param::ParameterName>& parameter_names)
     -> plotly_plotter::data_table;
 
@@ -51,7 +69,8 @@ namespace stat_bench::plots {
  * \return Created data table and whether custom output has errors.
  */
 [[nodiscard]] auto create_data_table_with_custom_output(
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::vector<param::ParameterName>& parameter_names,
     const CustomOutputName& output_name)
     -> std::pair<plotly_plotter::data_table, bool>;
@@ -64,18 +83,112 @@ namespace stat_bench::plots {
  * \return Created data table.
  */
 [[nodiscard]] auto create_data_table_with_all_time(
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::vector<param::ParameterName>& parameter_names)
     -> plotly_plotter::data_table;
 
+/*!
+ * \brief Create a data table with samples of processing time decimated
+ * preserving minimum and maximum values.
+ *
+ * \param[in] measurements Measurements.
+ * \param[in] max_points_per_trace Maximum number of points per trace.
+ * (0 for no limit.)
+ * \return Created data table.
+ */
+[[nodiscard]] auto create_data_table_with_decimated_time(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t max_points_per_trace) -> plotly_plotter::data_table;
+
+/*!
+ * \brief Create a data table with samples of processing time reduced
+ * preserving the distribution.
+ *
+ * \param[in] measurements Measurements.
+ * \param[in] max_points_per_trace Maximum number of points per trace.
+ * (0 for no limit.)
+ * \return Created data table.
+ */
+[[nodiscard]] auto create_data_table_with_time_distribution(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t max_points_per_trace) -> plotly_plotter::data_table;
+
 /*!
  * \brief Create a data table for cumulative distribution functions.
  *
  * \param[in] measurements Measurements.
+ * \param[in] max_points_per_trace Maximum number of points per trace.
+ * (0 for no limit.)
  * \return Created data table.
  */
 [[nodiscard]] auto create_data_table_for_cdf_plot(
-    const std::vector<measurer::Measurement>& measurements)
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t max_points_per_trace) -> plotly_plotter::data_table;
+
+/*!
+ * \brief Create a data table for histograms of processing time.
+ *
+ * Each histogram is represented as a step curve.
+ *
+ * \param[in] measurements Measurements.
+ * \param[in] num_bins Number of bins.
+ * \param[in] log_bins Whether to use log-spaced bins.
+ * \param[in] num_threads Number of threads to process measurements.
+ * \return Created data table.
+ */
+[[nodiscard]] auto create_data_table_for_histogram_plot(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t num_bins, bool log_bins, std::size_t num_threads)
+    -> plotly_plotter::data_table;
+
+/*!
+ * \brief Create a data table for estimated probability density of processing
+ * time.
+ *
+ * \param[in] measurements Measurements.
+ * \param[in] num_points Number of points per trace.
+ * \param[in] log_scale Whether to estimate density in the log scale.
+ * \param[in] num_threads Number of threads to process measurements.
+ * \return Created data table.
+ */
+[[nodiscard]] auto create_data_table_for_density_plot(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    std::size_t num_points, bool log_scale, std::size_t num_threads)
     -> plotly_plotter::data_table;
 
+/*!
+ * \brief Create a data table for plots of scaling with numbers of threads.
+ *
+ * The table has speedups and parallel efficiencies of measurements, those of
+ * ideal scaling, and those of the Universal Scalability Law fitted in each
+ * case.
+ *
+ * \param[in] measurements Measurements.
+ * \return Created data table.
+ */
+[[nodiscard]] auto create_data_table_for_thread_scaling_plot(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements) -> plotly_plotter::data_table;
+
+/*!
+ * \brief Create a data table for plots of durations of samples with respect
+ * to numbers of iterations.
+ *
+ * The table has durations of samples and lines fitted by ordinary least
+ * squares and Theil-Sen estimator. Measurements without results of linear
+ * regression are skipped.
+ *
+ * \param[in] measurements Measurements.
+ * \return Created data table.
+ */
+[[nodiscard]] auto create_data_table_for_iteration_regression_plot(
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements) -> plotly_plotter::data_table;
+
 }  // namespace stat_bench::plots
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to decimate samples for plots.
+ */
+#include "stat_bench/plots/decimate_samples.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace stat_bench::plots {
+
+auto decimate_min_max(const std::vector<double>& samples,
+    std::size_t max_points) -> std::vector<std::size_t> {
+    const std::size_t num_samples = samples.size();
+    std::vector<std::size_t> indices;
+    if (max_points == 0 || num_samples <= max_points) {
+        indices.reserve(num_samples);
+        for (std::size_t i = 0; i < num_samples; ++i) {
+            indices.push_back(i);
+        }
+        return indices;
+    }
+
+    const std::size_t num_buckets = std::max<std::size_t>(max_points / 2, 1);
+    indices.reserve(2 * num_buckets);
+    for (std::size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        const std::size_t begin = bucket * num_samples / num_buckets;
+        const std::size_t end = (bucket + 1) * num_samples / num_buckets;
+        std::size_t min_index = begin;
+        std::size_t max_index = begin;
+        for (std::size_t i = begin + 1; i < end; ++i) {
+            if (samples[i] < samples[min_index]) {
+                min_index = i;
+            }
+            if (samples[i] > samples[max_index]) {
+                max_index = i;
+            }
+        }
+        indices.push_back(std::min(min_index, max_index));
+        if (min_index != max_index) {
+            indices.push_back(std::max(min_index, max_index));
+        }
+    }
+    return indices;
+}
+
+auto select_quantile_indices(std::size_t num_samples, std::size_t max_points)
+    -> std::vector<std::size_t> {
+    std::vector<std::size_t> indices;
+    if (max_points == 0 || num_samples <= max_points) {
+        indices.reserve(num_samples);
+        for (std::size_t i = 0; i < num_samples; ++i) {
+            indices.push_back(i);
+        }
+        return indices;
+    }
+
+    const std::size_t num_points = std::max<std::size_t>(max_points, 2);
+    const std::size_t last_sample = num_samples - 1;
+    const std::size_t last_point = num_points - 1;
+    indices.reserve(num_points);
+    for (std::size_t i = 0; i < num_points; ++i) {
+        // Round to the nearest index. Indices are strictly increasing because
+        // last_sample > last_point.
+        indices.push_back((i * last_sample + last_point / 2) / last_point);
+    }
+    return indices;
+}
+
+namespace {
+
+/*!
+ * \brief Calculate a quantile of sorted samples with linear interpolation.
+ *
+ * \param[in] sorted_samples Sorted samples.
+ * \param[in] probability Probability.
+ * \return Quantile.
+ */
+[[nodiscard]] auto calc_quantile(
+    const std::vector<double>& sorted_samples, double probability) -> double {
+    const double position =
+        probability * static_cast<double>(sorted_samples.size() - 1);
+    const auto lower = static_cast<std::size_t>(position);
+    const std::size_t upper = std::min(lower + 1, sorted_samples.size() - 1);
+    const double rate = position - static_cast<double>(lower);
+    return sorted_samples[lower] +
+        rate * (sorted_samples[upper] - sorted_samples[lower]);
+}
+
+}  // namespace
+
+auto reduce_for_distribution(const std::vector<double>& sorted_samples,
+    std::size_t max_points) -> std::vector<double> {
+    const std::size_t num_samples = sorted_samples.size();
+    if (max_points == 0 || num_samples <= max_points) {
+        return sorted_samples;
+    }
+
+    constexpr double first_quartile_probability = 0.25;
+    constexpr double third_quartile_probability = 0.75;
+    constexpr double whisker_length_rate = 1.5;
+    const double first_quartile =
+        calc_quantile(sorted_samples, first_quartile_probability);
+    const double third_quartile =
+        calc_quantile(sorted_samples, third_quartile_probability);
+    const double whisker_length =
+        whisker_length_rate * (third_quartile - first_quartile);
+    const std::size_t lower_whisker_index = static_cast<std::size_t>(
+        std::distance(sorted_samples.begin(),
+            std::lower_bound(sorted_samples.begin(), sorted_samples.end(),
+                first_quartile - whisker_length)));
+    const std::size_t upper_whisker_index =
+        static_cast<std::size_t>(std::distance(sorted_samples.begin(),
+            std::upper_bound(sorted_samples.begin(), sorted_samples.end(),
+                third_quartile + whisker_length))) -
+        1;
+
+    constexpr std::size_t num_whisker_points = 2;
+    std::vector<std::size_t> indices = select_quantile_indices(num_samples,
+        std::max<std::size_t>(max_points, num_whisker_points + 2) -
+            num_whisker_points);
+    indices.push_back(lower_whisker_index);
+    indices.push_back(upper_whisker_index);
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+    std::vector<double> result;
+    result.reserve(indices.size());
+    for (const std::size_t index : indices) {
+        result.push_back(sorted_samples[index]);
+    }
+    return result;
+}
+
+}  // namespace stat_bench::plots
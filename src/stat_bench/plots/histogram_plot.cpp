@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of HistogramPlot class.
+ */
+#include "stat_bench/plots/histogram_plot.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <fmt/format.h>
+#include <plotly_plotter/figure.h>
+#include <plotly_plotter/figure_builders/line.h>
+#include <plotly_plotter/write_html.h>
+
+#include "common_labels.h"
+#include "create_data_table.h"
+#include "stat_bench/measurer/measurement_type.h"
+#include "stat_bench/util/utf8_string.h"
+
+namespace stat_bench::plots {
+
+HistogramPlot::HistogramPlot(
+    std::size_t num_bins, bool log_bins, std::size_t num_threads)
+    : num_bins_(num_bins), log_bins_(log_bins), num_threads_(num_threads) {}
+
+auto HistogramPlot::name_for_file() const -> const util::Utf8String& {
+    return name_for_file_;
+}
+
+void HistogramPlot::write(const measurer::MeasurementType& measurement_type,
+    const BenchmarkGroupName& group_name,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    const std::string& file_path) {
+    (void)group_name;
+
+    const auto title = util::Utf8String(
+        fmt::format("Histogram of {}", measurement_type.str()));
+
+    const auto data_table = create_data_table_for_histogram_plot(
+        measurements, num_bins_, log_bins_, num_threads_);
+    auto figure = plotly_plotter::figure_builders::line(data_table)
+                      .x(time_label)
+                      .y(probability_density_label)
+                      .group(case_name_label)
+                      .log_x(log_bins_)
+                      .create();
+    figure.title(title.str());
+    plotly_plotter::write_html(file_path, figure);
+}
+
+}  // namespace stat_bench::plots
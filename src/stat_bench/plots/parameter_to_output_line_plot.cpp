@@ -20,6 +20,7 @@
 #include "stat_bench/plots/parameter_to_output_line_plot.h"
 
 #include <iterator>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -56,7 +57,8 @@ auto ParameterToOutputLinePlot::name_for_file() const
 void ParameterToOutputLinePlot::write(
     const measurer::MeasurementType& measurement_type,
     const BenchmarkGroupName& group_name,
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::string& file_path) {
     (void)measurement_type;
     (void)group_name;
@@ -20,6 +20,7 @@
 #include "stat_bench/plots/parameter_to_time_box_plot.h"
 
 #include <iterator>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -50,7 +51,8 @@ auto ParameterToTimeBoxPlot::name_for_file() const -> const util::Utf8String& {
 void ParameterToTimeBoxPlot::write(
     const measurer::MeasurementType& measurement_type,
     const BenchmarkGroupName& group_name,
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::string& file_path) {
     (void)group_name;
 
@@ -20,6 +20,7 @@
 #include "stat_bench/plots/parameter_to_time_line_plot.h"
 
 #include <iterator>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -39,10 +40,13 @@
 namespace stat_bench::plots {
 
 ParameterToTimeLinePlot::ParameterToTimeLinePlot(
-    param::ParameterName parameter_name, PlotOptions options)
+    param::ParameterName parameter_name, PlotOptions options,
+    bool show_complexity_fit)
     : parameter_name_(std::move(parameter_name)),
       options_(options),
-      name_for_file_(create_name_for_file(parameter_name_, options_)) {}
+      show_complexity_fit_(show_complexity_fit),
+      name_for_file_(create_name_for_file(
+          parameter_name_, options_, show_complexity_fit_)) {}
 
 auto ParameterToTimeLinePlot::name_for_file() const -> const util::Utf8String& {
     return name_for_file_;
@@ -51,7 +55,8 @@ auto ParameterToTimeLinePlot::name_for_file() const -> const util::Utf8String& {
 void ParameterToTimeLinePlot::write(
     const measurer::MeasurementType& measurement_type,
     const BenchmarkGroupName& group_name,
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::string& file_path) {
     (void)group_name;
 
@@ -68,8 +73,10 @@ void ParameterToTimeLinePlot::write(
             options_.subplot_row_parameter_name().data());
     }
 
-    const auto data_table =
-        create_data_table_with_mean_time(measurements, parameter_names);
+    const auto data_table = show_complexity_fit_
+        ? create_data_table_with_mean_time_and_complexity_fit(
+              measurements, parameter_names)
+        : create_data_table_with_mean_time(measurements, parameter_names);
     auto figure_builder = plotly_plotter::figure_builders::line(data_table)
                               .x(parameter_name_.str().str())
                               .y(time_label)
@@ -91,8 +98,8 @@ void ParameterToTimeLinePlot::write(
 }
 
 auto ParameterToTimeLinePlot::create_name_for_file(
-    const param::ParameterName& parameter_name, const PlotOptions& options)
-    -> util::Utf8String {
+    const param::ParameterName& parameter_name, const PlotOptions& options,
+    bool show_complexity_fit) -> util::Utf8String {
     fmt::memory_buffer buffer;
     fmt::format_to(std::back_inserter(buffer), "by_{}",
         util::escape_for_file_name(parameter_name.str()));
@@ -106,6 +113,9 @@ auto ParameterToTimeLinePlot::create_name_for_file(
             util::escape_for_file_name(
                 util::Utf8String(options.subplot_row_parameter_name().data())));
     }
+    if (show_complexity_fit) {
+        fmt::format_to(std::back_inserter(buffer), "_complexity");
+    }
     return util::Utf8String(std::string(buffer.data(), buffer.size()));
 }
 
@@ -20,6 +20,7 @@
 #include "stat_bench/plots/parameter_to_time_violin_plot.h"
 
 #include <iterator>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -51,7 +52,8 @@ auto ParameterToTimeViolinPlot::name_for_file() const
 void ParameterToTimeViolinPlot::write(
     const measurer::MeasurementType& measurement_type,
     const BenchmarkGroupName& group_name,
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::string& file_path) {
     (void)group_name;
 
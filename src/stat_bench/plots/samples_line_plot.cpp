@@ -19,6 +19,8 @@
  */
 #include "stat_bench/plots/samples_line_plot.h"
 
+#include <cstddef>
+#include <memory>
 #include <vector>
 
 #include <plotly_plotter/figure.h>
@@ -34,19 +36,24 @@
 
 namespace stat_bench::plots {
 
+SamplesLinePlot::SamplesLinePlot(std::size_t max_points_per_trace)
+    : max_points_per_trace_(max_points_per_trace) {}
+
 auto SamplesLinePlot::name_for_file() const -> const util::Utf8String& {
     return name_for_file_;
 }
 
 void SamplesLinePlot::write(const measurer::MeasurementType& measurement_type,
     const BenchmarkGroupName& group_name,
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::string& file_path) {
     (void)group_name;
 
     const auto& title = measurement_type.str();
 
-    const auto data_table = create_data_table_with_all_time(measurements, {});
+    const auto data_table = create_data_table_with_decimated_time(
+        measurements, max_points_per_trace_);
     auto figure = plotly_plotter::figure_builders::line(data_table)
                       .x(sample_index_label)
                       .y(time_label)
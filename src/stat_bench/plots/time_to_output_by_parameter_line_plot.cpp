@@ -20,6 +20,7 @@
 #include "stat_bench/plots/time_to_output_by_parameter_line_plot.h"
 
 #include <iterator>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -54,7 +55,8 @@ auto TimeToOutputByParameterLinePlot::name_for_file() const
 void TimeToOutputByParameterLinePlot::write(
     const measurer::MeasurementType& measurement_type,
     const BenchmarkGroupName& group_name,
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::string& file_path) {
     (void)measurement_type;
     (void)group_name;
@@ -19,6 +19,8 @@
  */
 #include "stat_bench/plots/violin_plot.h"
 
+#include <cstddef>
+#include <memory>
 #include <vector>
 
 #include <plotly_plotter/figure.h>
@@ -32,19 +34,24 @@
 
 namespace stat_bench::plots {
 
+ViolinPlot::ViolinPlot(std::size_t max_points_per_trace)
+    : max_points_per_trace_(max_points_per_trace) {}
+
 auto ViolinPlot::name_for_file() const -> const util::Utf8String& {
     return name_for_file_;
 }
 
 void ViolinPlot::write(const measurer::MeasurementType& measurement_type,
     const BenchmarkGroupName& group_name,
-    const std::vector<measurer::Measurement>& measurements,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
     const std::string& file_path) {
     (void)group_name;
 
     const auto& title = measurement_type.str();
 
-    const auto data_table = create_data_table_with_all_time(measurements, {});
+    const auto data_table = create_data_table_with_time_distribution(
+        measurements, max_points_per_trace_);
     auto figure = plotly_plotter::figure_builders::violin(data_table)
                       .y(time_label)
                       .group(case_name_label)
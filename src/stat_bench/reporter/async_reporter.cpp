@@ -0,0 +1,179 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of AsyncReporter class.
+ */
+#include "stat_bench/reporter/async_reporter.h"
+
+#include <future>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/thread_affinity.h"
+
+namespace stat_bench::reporter {
+
+AsyncReporter::AsyncReporter(std::vector<std::shared_ptr<IReporter>> reporters,
+    std::optional<std::size_t> cpu_index, std::size_t queue_capacity)
+    : reporters_(std::move(reporters)), queue_(queue_capacity) {
+    thread_ = std::thread([this, cpu_index] { process_events(cpu_index); });
+}
+
+AsyncReporter::~AsyncReporter() {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        is_stopping_.store(true);
+    }
+    condition_variable_.notify_one();
+    thread_.join();
+}
+
+void AsyncReporter::add(std::shared_ptr<IReporter> reporter) {
+    reporters_.push_back(std::move(reporter));
+}
+
+void AsyncReporter::flush() {
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    push([&promise] { promise.set_value(); });
+    future.wait();
+    rethrow_if_failed();
+}
+
+void AsyncReporter::experiment_starts(
+    const clock::SystemTimePoint& time_stamp) {
+    push_to_reporters([time_stamp](IReporter& reporter) {
+        reporter.experiment_starts(time_stamp);
+    });
+}
+
+void AsyncReporter::experiment_finished(
+    const clock::SystemTimePoint& time_stamp) {
+    push_to_reporters([time_stamp](IReporter& reporter) {
+        reporter.experiment_finished(time_stamp);
+    });
+    flush();
+}
+
+void AsyncReporter::group_starts(const BenchmarkGroupName& name,
+    const bench_impl::BenchmarkGroupConfig& config) {
+    push_to_reporters([name, config](IReporter& reporter) {
+        reporter.group_starts(name, config);
+    });
+}
+
+void AsyncReporter::group_finished(const BenchmarkGroupName& name) {
+    push_to_reporters(
+        [name](IReporter& reporter) { reporter.group_finished(name); });
+}
+
+void AsyncReporter::measurement_type_starts(
+    const measurer::MeasurementType& type) {
+    push_to_reporters([type](IReporter& reporter) {
+        reporter.measurement_type_starts(type);
+    });
+}
+
+void AsyncReporter::measurement_type_finished(
+    const measurer::MeasurementType& type) {
+    push_to_reporters([type](IReporter& reporter) {
+        reporter.measurement_type_finished(type);
+    });
+}
+
+void AsyncReporter::case_starts(const BenchmarkFullName& case_info) {
+    push_to_reporters(
+        [case_info](IReporter& reporter) { reporter.case_starts(case_info); });
+}
+
+void AsyncReporter::case_finished(const BenchmarkFullName& case_info) {
+    push_to_reporters([case_info](IReporter& reporter) {
+        reporter.case_finished(case_info);
+    });
+}
+
+void AsyncReporter::measurement_succeeded(
+    const std::shared_ptr<const measurer::Measurement>& measurement) {
+    push_to_reporters([measurement](IReporter& reporter) {
+        reporter.measurement_succeeded(measurement);
+    });
+}
+
+void AsyncReporter::measurement_failed(const BenchmarkFullName& case_info,
+    const BenchmarkCondition& cond, const std::exception_ptr& error) {
+    push_to_reporters([case_info, cond, error](IReporter& reporter) {
+        reporter.measurement_failed(case_info, cond, error);
+    });
+}
+
+void AsyncReporter::push(Event event) {
+    rethrow_if_failed();
+    while (!queue_.try_push(std::move(event))) {
+        // The queue is full.
+        std::this_thread::yield();
+    }
+
+    // Wake up the thread of reporters if sleeping.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (is_waiting_.load()) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_variable_.notify_one();
+    }
+}
+
+void AsyncReporter::rethrow_if_failed() {
+    if (has_error_.load(std::memory_order_acquire)) {
+        std::rethrow_exception(error_);
+    }
+}
+
+void AsyncReporter::process_events(std::optional<std::size_t> cpu_index) {
+    if (cpu_index && !util::pin_current_thread_to_cpu(*cpu_index)) {
+        error_ = std::make_exception_ptr(StatBenchException(fmt::format(
+            FMT_STRING("Failed to pin the thread of reporters to CPU {}."),
+            *cpu_index)));
+        has_error_.store(true, std::memory_order_release);
+    }
+
+    Event event;
+    while (wait_for_event(event)) {
+        event();
+    }
+}
+
+auto AsyncReporter::wait_for_event(Event& event) -> bool {
+    while (true) {
+        if (queue_.try_pop(event)) {
+            return true;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        is_waiting_.store(true);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        condition_variable_.wait(lock,
+            [this] { return !queue_.empty() || is_stopping_.load(); });
+        is_waiting_.store(false);
+        if (queue_.empty()) {
+            // Stopping.
+            return false;
+        }
+    }
+}
+
+}  // namespace stat_bench::reporter
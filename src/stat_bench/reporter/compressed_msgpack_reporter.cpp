@@ -19,16 +19,14 @@
  */
 #include "stat_bench/reporter/compressed_msgpack_reporter.h"
 
-#include <cstdio>
+#include <cstddef>
 #include <utility>
 
-#include <fmt/format.h>
 #include <msgpack_light/output_stream.h>
 #include <msgpack_light/serialize.h>
-#include <zlib.h>
 
 #include "stat_bench/reporter/msgpack_data_file_helper.h"  // IWYU pragma: keep
-#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/parallel_gzip_writer.h"
 #include "stat_bench/util/prepare_directory.h"
 
 namespace stat_bench::reporter {
@@ -42,14 +40,11 @@ public:
      * \brief Constructor.
      *
      * \param[in] file_path File path.
+     * \param[in] compression_level Compression level.
      */
-    explicit CompressedMsgpackOutputFileStream(const std::string& file_path)
-        : file_(gzopen(file_path.c_str(), "wb9")) {
-        if (file_ == nullptr) {
-            throw StatBenchException(
-                fmt::format(FMT_STRING("Failed to open {}."), file_path));
-        }
-    }
+    CompressedMsgpackOutputFileStream(
+        const std::string& file_path, int compression_level)
+        : writer_(file_path, compression_level) {}
 
     CompressedMsgpackOutputFileStream(
         const CompressedMsgpackOutputFileStream&) = delete;
@@ -63,7 +58,7 @@ public:
     /*!
      * \brief Destructor.
      */
-    ~CompressedMsgpackOutputFileStream() { (void)gzclose(file_); }
+    ~CompressedMsgpackOutputFileStream() = default;
 
     /*!
      * \brief Write data.
@@ -72,25 +67,31 @@ public:
      * \param[in] size Size of the data.
      */
     void write(const unsigned char* data, std::size_t size) override {
-        if (gzwrite(file_, data, size) != static_cast<int>(size)) {
-            throw StatBenchException("Failed to write data.");
-        }
+        writer_.write(data, size);
     }
 
+    /*!
+     * \brief Finish writing the file.
+     */
+    void close() { writer_.close(); }
+
 private:
-    //! File.
-    gzFile file_;
+    //! Writer.
+    util::ParallelGzipWriter writer_;
 };
 
-CompressedMsgPackReporter::CompressedMsgPackReporter(std::string file_path)
-    : DataFileReporterBase(std::move(file_path)) {}
+CompressedMsgPackReporter::CompressedMsgPackReporter(
+    std::string file_path, int compression_level)
+    : DataFileReporterBase(std::move(file_path)),
+      compression_level_(compression_level) {}
 
 void CompressedMsgPackReporter::write_data_file(
     const std::string& file_path, const data_file_spec::RootData& data) {
     util::prepare_directory_for(file_path);
 
-    CompressedMsgpackOutputFileStream stream{file_path};
+    CompressedMsgpackOutputFileStream stream{file_path, compression_level_};
     msgpack_light::serialize_to(stream, data);
+    stream.close();
 }
 
 }  // namespace stat_bench::reporter
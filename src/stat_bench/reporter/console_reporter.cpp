@@ -31,15 +31,24 @@
 #include <fmt/color.h>
 #include <fmt/format.h>
 
+#include "stat_bench/bench_impl/benchmark_group_config.h"
 #include "stat_bench/benchmark_case_name.h"
 #include "stat_bench/benchmark_condition.h"
 #include "stat_bench/benchmark_full_name.h"
 #include "stat_bench/clock/duration.h"
 #include "stat_bench/clock/monotone_time_point.h"
 #include "stat_bench/custom_output_name.h"
+#include "stat_bench/measurer/analyze_thread_scaling.h"
+#include "stat_bench/measurer/fit_complexity_by_case.h"
+#include "stat_bench/measurer/fit_iteration_regression.h"
 #include "stat_bench/measurer/measurement.h"
 #include "stat_bench/param/parameter_dict.h"
+#include "stat_bench/param/parameter_name.h"
+#include "stat_bench/stat/complexity_fit.h"
 #include "stat_bench/stat/custom_stat_output.h"
+#include "stat_bench/stat/drift_diagnostics.h"
+#include "stat_bench/stat/linear_regression.h"
+#include "stat_bench/stat/scalability_fit.h"
 #include "stat_bench/stat/statistics.h"
 #include "stat_bench/util/utf8_string.h"
 #include "stat_bench/version.h"
@@ -89,6 +98,20 @@ auto format_duration(double val) -> std::string {
         fmt::group_digits(static_cast<std::uint64_t>(val * sec_to_us)));
 }
 
+auto format_case_name_with_params(
+    const BenchmarkCaseName& case_name, const param::ParameterDict& params)
+    -> std::string {
+    if (params.empty()) {
+        return case_name.str().str();
+    }
+    return fmt::format(FMT_STRING("{} ({}) "), case_name, params);
+}
+
+auto format_case_name_with_params(const BenchmarkFullName& case_info,
+    const BenchmarkCondition& cond) -> std::string {
+    return format_case_name_with_params(case_info.case_name(), cond.params());
+}
+
 }  // namespace
 
 //! Format of the table for console output.
@@ -98,7 +121,8 @@ auto format_duration(double val) -> std::string {
 #define CONSOLE_TABLE_FORMAT_ERROR "{:<58}  {}"
 
 void ConsoleReporter::group_starts(const BenchmarkGroupName& name,
-    const bench_impl::BenchmarkGroupConfig& /*config*/) {
+    const bench_impl::BenchmarkGroupConfig& config) {
+    complexity_parameters_ = config.complexity_parameters();
     print_line(file_, '=');
     fmt::print(file_, FMT_STRING("{}\n"), name);
     print_line(file_, '=');
@@ -121,8 +145,119 @@ void ConsoleReporter::measurement_type_starts(
     (void)std::fflush(file_);
 }
 
+namespace {
+
+/*!
+ * \brief Print metrics of scaling with numbers of threads.
+ *
+ * \param[in] file File pointer of the console.
+ * \param[in] measurements Measurements.
+ */
+void print_thread_scaling(std::FILE* file,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements) {
+    const auto scalings = measurer::analyze_thread_scaling(measurements);
+    if (scalings.empty()) {
+        return;
+    }
+    fmt::print(file, FMT_STRING("\nThread scaling:\n"));
+    fmt::print(file, FMT_STRING("{:<58}  {:>7}  {:>16} {:>9} {:>10}\n"), "",
+        "Threads", "Throughput [1/s]", "Speedup", "Efficiency");
+    for (const auto& scaling : scalings) {
+        const std::string name =
+            format_case_name_with_params(scaling.case_name, scaling.params);
+        for (const auto& point : scaling.points) {
+            fmt::print(file,
+                FMT_STRING("{:<58}  {:>7}  {:>16.3e} {:>9.3f} {:>10.3f}\n"),
+                (&point == &scaling.points.front()) ? name : "",
+                point.num_threads, point.throughput, point.speedup,
+                point.efficiency);
+        }
+        fmt::print(file,
+            FMT_STRING("{:<58}  Amdahl: sigma={:.4f} (R^2={:.4f}), "
+                       "USL: sigma={:.4f}, kappa={:.5f} (R^2={:.4f}), "
+                       "peak={:.1f} threads\n"),
+            "", scaling.amdahl.contention, scaling.amdahl.r_squared,
+            scaling.usl.contention, scaling.usl.coherency,
+            scaling.usl.r_squared, stat::calc_peak_num_threads(scaling.usl));
+    }
+}
+
+/*!
+ * \brief Print models of asymptotic complexity fitted in each case.
+ *
+ * \param[in] file File pointer of the console.
+ * \param[in] measurements Measurements.
+ * \param[in] parameter_name Name of the parameter used in fitting.
+ */
+void print_complexity_fits(std::FILE* file,
+    const std::vector<std::shared_ptr<const measurer::Measurement>>&
+        measurements,
+    const param::ParameterName& parameter_name) {
+    const auto fits =
+        measurer::fit_complexity_by_case(measurements, parameter_name);
+    if (fits.empty()) {
+        return;
+    }
+    fmt::print(file, FMT_STRING("\nComplexity by {}:\n"), parameter_name);
+    for (const auto& fit : fits) {
+        fmt::print(file,
+            FMT_STRING("{:<58}  {}, coefficient={:.3e}, R^2={:.4f}\n"),
+            format_case_name_with_params(fit.case_name, fit.params),
+            stat::format_complexity(fit.result), fit.result.coefficient,
+            fit.result.r_squared);
+    }
+}
+
+}  // namespace
+
+namespace {
+
+/*!
+ * \brief Print a result of linear regression of durations on numbers of
+ * iterations.
+ *
+ * \param[in] file File pointer of the console.
+ * \param[in] method Name of the method of regression.
+ * \param[in] result Result.
+ */
+void print_iteration_regression(std::FILE* file, const char* method,
+    const stat::LinearRegressionResult& result) {
+    fmt::print(file,
+        FMT_STRING("{:<58}  {}: {} us/iteration (95% CI: {} - {}), "
+                   "intercept={} us, R^2={:.4f}\n"),
+        "", method, format_duration(result.slope),
+        format_duration(result.slope_lower),
+        format_duration(result.slope_upper),
+        format_duration(result.intercept), result.r_squared);
+}
+
+/*!
+ * \brief Print a warning of drift across samples.
+ *
+ * \param[in] file File pointer of the console.
+ * \param[in] drift Diagnostics of drift.
+ */
+void print_drift_warning(
+    std::FILE* file, const stat::DriftDiagnostics& drift) {
+    fmt::print(file, fmt::fg(fmt::color::yellow),
+        FMT_STRING("{:<58}  Drift detected: Mann-Kendall z={:.2f} "
+                   "(p={:.2e}), lag-1 autocorrelation={:.3f}, "
+                   "effective samples={:.1f}"),
+        "", drift.mann_kendall_z, drift.mann_kendall_p_value,
+        drift.lag1_autocorrelation, drift.effective_sample_size);
+    fmt::print(file, "\n");
+}
+
+}  // namespace
+
 void ConsoleReporter::measurement_type_finished(
     const measurer::MeasurementType& /*type*/) {
+    print_thread_scaling(file_, measurements_);
+    for (const auto& parameter_name : complexity_parameters_) {
+        print_complexity_fits(file_, measurements_, parameter_name);
+    }
+    measurements_.clear();
     fmt::print(file_, "\n");
     (void)std::fflush(file_);
 }
@@ -135,38 +270,37 @@ void ConsoleReporter::case_finished(const BenchmarkFullName& /*case_info*/) {
     // no operation
 }
 
-namespace {
-
-auto format_case_name_with_params(const BenchmarkFullName& case_info,
-    const BenchmarkCondition& cond) -> std::string {
-    if (cond.params().empty()) {
-        return case_info.case_name().str().str();
-    }
-    return fmt::format(
-        FMT_STRING("{} ({}) "), case_info.case_name(), cond.params());
-}
-
-}  // namespace
-
 void ConsoleReporter::measurement_succeeded(
-    const measurer::Measurement& measurement) {
+    const std::shared_ptr<const measurer::Measurement>& measurement) {
     fmt::print(file_, FMT_STRING(CONSOLE_TABLE_FORMAT),
         format_case_name_with_params(
-            measurement.case_info(), measurement.cond()),
-        measurement.iterations(), measurement.samples(),
-        format_duration(measurement.durations_stat().mean()),
-        format_duration(measurement.durations_stat().standard_error()),
-        format_duration(measurement.durations_stat().max()));
-    for (std::size_t i = 0; i < measurement.custom_stat_outputs().size(); ++i) {
+            measurement->case_info(), measurement->cond()),
+        measurement->iterations(), measurement->samples(),
+        format_duration(measurement->durations_stat().mean()),
+        format_duration(measurement->durations_stat().standard_error()),
+        format_duration(measurement->durations_stat().max()));
+    for (std::size_t i = 0; i < measurement->custom_stat_outputs().size();
+         ++i) {
         fmt::print(file_, FMT_STRING("{}={:.3e}, "),
-            measurement.custom_stat_outputs().at(i)->name(),
-            measurement.custom_stat().at(i).mean());
+            measurement->custom_stat_outputs().at(i)->name(),
+            measurement->custom_stat().at(i).mean());
     }
-    for (const auto& out : measurement.custom_outputs()) {
+    for (const auto& out : measurement->custom_outputs()) {
         fmt::print(file_, FMT_STRING("{}={:.3e}, "), out.first, out.second);
     }
     fmt::print(file_, "\n");
+    if (measurement->iteration_regression().has_value()) {
+        const auto& regression = measurement->iteration_regression().value();
+        print_iteration_regression(
+            file_, "OLS", regression.ordinary_least_squares);
+        print_iteration_regression(
+            file_, "Theil-Sen", regression.theil_sen);
+    }
+    if (measurement->drift_diagnostics().drifting) {
+        print_drift_warning(file_, measurement->drift_diagnostics());
+    }
     (void)std::fflush(file_);
+    measurements_.push_back(measurement);
 }
 
 void ConsoleReporter::measurement_failed(const BenchmarkFullName& case_info,
@@ -15,21 +15,197 @@
  */
 /*!
  * \file
- * \brief Definition of functions to help output of data files.
+ * \brief Definition of functions to help input and output of data files.
  */
 #include "stat_bench/reporter/data_file_helper.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <functional>
+#include <string>
+#include <system_error>
 
 #include "stat_bench/benchmark_case_name.h"
 #include "stat_bench/benchmark_condition.h"
 #include "stat_bench/benchmark_full_name.h"
 #include "stat_bench/benchmark_group_name.h"
 #include "stat_bench/measurer/measurement_type.h"
+#include "stat_bench/param/num_threads_parameter_name.h"
+#include "stat_bench/param/parameter_name.h"
+#include "stat_bench/param/parameter_value.h"
+#include "stat_bench/stat/complexity_fit.h"
+#include "stat_bench/util/ordered_map.h"
 
 namespace stat_bench::reporter::data_file_spec {
 
+namespace {
+
+/*!
+ * \brief Enumeration of types of parameters restored from data files.
+ *
+ * Types are ordered so that larger types can represent more values, except
+ * for boolean values which can be represented only by themselves and strings.
+ */
+enum class RestoredParameterType : std::uint8_t {
+    boolean,           //!< Boolean value.
+    unsigned_integer,  //!< Unsigned integer.
+    signed_integer,    //!< Signed integer.
+    floating_point,    //!< Floating-point number.
+    string             //!< String.
+};
+
+/*!
+ * \brief Parse an integer.
+ *
+ * \tparam T Type of the integer.
+ * \param[in] str String.
+ * \param[out] value Parsed value.
+ * \retval true The whole string was parsed.
+ * \retval false The string is not an integer.
+ */
+template <typename T>
+[[nodiscard]] auto parse_integer(const std::string& str, T& value) -> bool {
+    const char* begin = str.data();
+    const char* end = str.data() + str.size();
+    const auto [ptr, error] = std::from_chars(begin, end, value);
+    return error == std::errc() && ptr == end;
+}
+
+/*!
+ * \brief Parse a floating-point number.
+ *
+ * \param[in] str String.
+ * \param[out] value Parsed value.
+ * \retval true The whole string was parsed.
+ * \retval false The string is not a floating-point number.
+ */
+[[nodiscard]] auto parse_floating_point(const std::string& str, double& value)
+    -> bool {
+    // Reject strings like " 1" and "inf" which std::strtod accepts.
+    if (str.empty() ||
+        str.find_first_not_of("0123456789+-.eE") != std::string::npos) {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    value = std::strtod(str.c_str(), &end);
+    return errno == 0 && end == str.c_str() + str.size();
+}
+
+/*!
+ * \brief Detect the narrowest type of a parameter value.
+ *
+ * \param[in] str String of the value.
+ * \return Type.
+ */
+[[nodiscard]] auto detect_type(const std::string& str)
+    -> RestoredParameterType {
+    if (str == "true" || str == "false") {
+        return RestoredParameterType::boolean;
+    }
+    std::size_t unsigned_value{};
+    if (parse_integer(str, unsigned_value)) {
+        return RestoredParameterType::unsigned_integer;
+    }
+    std::intmax_t signed_value{};
+    if (parse_integer(str, signed_value)) {
+        return RestoredParameterType::signed_integer;
+    }
+    double floating_point_value{};
+    if (parse_floating_point(str, floating_point_value)) {
+        return RestoredParameterType::floating_point;
+    }
+    return RestoredParameterType::string;
+}
+
+/*!
+ * \brief Get a type which can represent values of two types.
+ *
+ * \param[in] lhs A type.
+ * \param[in] rhs Another type.
+ * \return Type.
+ */
+[[nodiscard]] auto merge_types(RestoredParameterType lhs,
+    RestoredParameterType rhs) -> RestoredParameterType {
+    if (lhs == rhs) {
+        return lhs;
+    }
+    if (lhs == RestoredParameterType::boolean ||
+        rhs == RestoredParameterType::boolean) {
+        return RestoredParameterType::string;
+    }
+    return std::max(lhs, rhs);
+}
+
+/*!
+ * \brief Create a parameter value.
+ *
+ * \param[in] str String of the value.
+ * \param[in] type Type of the value.
+ * \return Value.
+ */
+[[nodiscard]] auto create_param_value(const std::string& str,
+    RestoredParameterType type) -> param::ParameterValue {
+    param::ParameterValue value;
+    switch (type) {
+    case RestoredParameterType::boolean:
+        value.emplace<bool>(str == "true");
+        break;
+    case RestoredParameterType::unsigned_integer: {
+        std::size_t parsed{};
+        (void)parse_integer(str, parsed);
+        value.emplace<std::size_t>(parsed);
+        break;
+    }
+    case RestoredParameterType::signed_integer: {
+        std::intmax_t parsed{};
+        (void)parse_integer(str, parsed);
+        value.emplace<std::intmax_t>(parsed);
+        break;
+    }
+    case RestoredParameterType::floating_point: {
+        double parsed{};
+        (void)parse_floating_point(str, parsed);
+        value.emplace<double>(parsed);
+        break;
+    }
+    case RestoredParameterType::string:
+        value.emplace<std::string>(str);
+        break;
+    }
+    return value;
+}
+
+/*!
+ * \brief Restore a custom output with statistics.
+ *
+ * Values in data files are already preprocessed, so they are restored as
+ * means of a single iteration without warming up.
+ *
+ * \param[in] data Data in data files.
+ * \return Custom output.
+ */
+[[nodiscard]] auto restore(const CustomStatOutputData& data)
+    -> std::shared_ptr<stat::CustomStatOutput> {
+    const std::size_t threads = data.values.size();
+    const std::size_t samples = data.values.empty() ? 0 : data.values[0].size();
+    auto output = std::make_shared<stat::CustomStatOutput>(
+        CustomOutputName(data.name), threads, samples, 0, 1,
+        stat::CustomOutputAnalysisType::mean);
+    for (std::size_t i = 0; i < threads; ++i) {
+        for (std::size_t j = 0; j < data.values[i].size(); ++j) {
+            output->add(i, j, static_cast<double>(data.values[i][j]));
+        }
+    }
+    return output;
+}
+
+}  // namespace
+
 auto convert(const param::ParameterDict& params)
     -> std::unordered_map<util::Utf8String, util::Utf8String> {
     return params.as_string_dict();
@@ -43,8 +219,16 @@ auto convert(const stat::Statistics& stat) -> StatData {
         static_cast<float>(stat.standard_error())};
 }
 
+auto convert(const stat::DriftDiagnostics& drift) -> DriftData {
+    return DriftData{static_cast<float>(drift.lag1_autocorrelation),
+        static_cast<float>(drift.mann_kendall_z),
+        static_cast<float>(drift.mann_kendall_p_value),
+        static_cast<float>(drift.effective_sample_size), drift.drifting};
+}
+
 auto convert(const std::vector<std::vector<clock::Duration>>& durations,
-    const stat::Statistics& durations_stat) -> DurationData {
+    const stat::Statistics& durations_stat,
+    const stat::DriftDiagnostics& drift) -> DurationData {
     std::vector<std::vector<float>> values;
     values.reserve(durations.size());
     for (const auto& durations_per_thread : durations) {
@@ -55,7 +239,8 @@ auto convert(const std::vector<std::vector<clock::Duration>>& durations,
             values_per_thread.push_back(static_cast<float>(duration.seconds()));
         }
     }
-    return DurationData{convert(durations_stat), std::move(values)};
+    return DurationData{
+        convert(durations_stat), std::move(values), convert(drift)};
 }
 
 auto convert(const std::shared_ptr<stat::CustomStatOutput>& stat_output,
@@ -101,10 +286,124 @@ auto convert(const measurer::Measurement& measurement) -> MeasurementData {
         measurement.case_info().case_name().str(),
         convert(measurement.cond().params()),
         measurement.measurement_type().str(), measurement.iterations(),
-        measurement.samples(),
-        convert(measurement.durations(), measurement.durations_stat()),
+        measurement.samples(), measurement.warming_up_samples(),
+        convert(measurement.durations(), measurement.durations_stat(),
+            measurement.drift_diagnostics()),
         convert(measurement.custom_stat_outputs(), measurement.custom_stat()),
         convert(measurement.custom_outputs())};
 }
 
+auto convert(const measurer::CaseComplexityFit& fit,
+    const param::ParameterName& parameter_name) -> ComplexityFitData {
+    const measurer::Measurement& measurement = *fit.measurements.front();
+    return ComplexityFitData{measurement.case_info().group_name().str(),
+        fit.case_name.str(), measurement.measurement_type().str(),
+        convert(fit.params), parameter_name.str(),
+        util::Utf8String(stat::format_complexity(fit.result)),
+        static_cast<float>(fit.result.coefficient),
+        static_cast<float>(fit.result.exponent),
+        static_cast<float>(fit.result.r_squared)};
+}
+
+auto convert(const stat::LinearRegressionResult& result)
+    -> LinearRegressionData {
+    return LinearRegressionData{static_cast<float>(result.slope),
+        static_cast<float>(result.intercept),
+        static_cast<float>(result.slope_lower),
+        static_cast<float>(result.slope_upper),
+        static_cast<float>(result.r_squared)};
+}
+
+auto convert(const measurer::Measurement& measurement,
+    const measurer::IterationRegression& regression)
+    -> IterationRegressionData {
+    return IterationRegressionData{
+        measurement.case_info().group_name().str(),
+        measurement.case_info().case_name().str(),
+        measurement.measurement_type().str(),
+        convert(measurement.cond().params()),
+        convert(regression.ordinary_least_squares),
+        convert(regression.theil_sen)};
+}
+
+auto restore(const std::vector<MeasurementData>& data)
+    -> std::vector<measurer::Measurement> {
+    std::unordered_map<util::Utf8String, RestoredParameterType> param_types;
+    for (const auto& measurement : data) {
+        for (const auto& [name, value] : measurement.params) {
+            const RestoredParameterType type = detect_type(value.str());
+            const auto [iter, inserted] = param_types.try_emplace(name, type);
+            if (!inserted) {
+                iter->second = merge_types(iter->second, type);
+            }
+        }
+    }
+
+    std::vector<util::Utf8String> param_names;
+    param_names.reserve(param_types.size());
+    for (const auto& [name, type] : param_types) {
+        param_names.push_back(name);
+    }
+    const util::Utf8String& threads_name =
+        param::num_threads_parameter_name().str();
+    std::sort(param_names.begin(), param_names.end(),
+        [&threads_name](const util::Utf8String& lhs,
+            const util::Utf8String& rhs) {
+            if ((lhs == threads_name) != (rhs == threads_name)) {
+                return lhs == threads_name;
+            }
+            return lhs.str() < rhs.str();
+        });
+
+    std::vector<measurer::Measurement> measurements;
+    measurements.reserve(data.size());
+    for (const auto& measurement : data) {
+        util::OrderedMap<param::ParameterName, param::ParameterValue> params;
+        for (const auto& name : param_names) {
+            const auto iter = measurement.params.find(name);
+            if (iter == measurement.params.end()) {
+                continue;
+            }
+            params.emplace(param::ParameterName(name),
+                create_param_value(iter->second.str(), param_types.at(name)));
+        }
+
+        std::vector<std::vector<clock::Duration>> durations;
+        durations.reserve(measurement.durations.values.size());
+        for (const auto& values_per_thread : measurement.durations.values) {
+            auto& durations_per_thread = durations.emplace_back();
+            durations_per_thread.reserve(values_per_thread.size());
+            for (const float value : values_per_thread) {
+                durations_per_thread.emplace_back(static_cast<double>(value));
+            }
+        }
+
+        std::vector<std::shared_ptr<stat::CustomStatOutput>>
+            custom_stat_outputs;
+        custom_stat_outputs.reserve(measurement.custom_stat_outputs.size());
+        for (const auto& output : measurement.custom_stat_outputs) {
+            custom_stat_outputs.push_back(restore(output));
+        }
+
+        std::vector<std::pair<CustomOutputName, double>> custom_outputs;
+        custom_outputs.reserve(measurement.custom_outputs.size());
+        for (const auto& output : measurement.custom_outputs) {
+            custom_outputs.emplace_back(CustomOutputName(output.name),
+                static_cast<double>(output.value));
+        }
+
+        const std::size_t threads = durations.size();
+        measurements.emplace_back(
+            BenchmarkFullName(BenchmarkGroupName(measurement.group_name),
+                BenchmarkCaseName(measurement.case_name)),
+            BenchmarkCondition(
+                threads, param::ParameterDict(std::move(params))),
+            measurer::MeasurementType(measurement.measurement_type),
+            measurement.iterations, measurement.samples, std::move(durations),
+            std::move(custom_stat_outputs), std::move(custom_outputs),
+            measurement.warming_up_samples);
+    }
+    return measurements;
+}
+
 }  // namespace stat_bench::reporter::data_file_spec
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of read_data_file function.
+ */
+#include "stat_bench/reporter/data_file_reader.h"
+
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <vector>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+#include <zlib.h>
+
+#include "stat_bench/reporter/json_data_file_helper.h"  // IWYU pragma: keep
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::reporter {
+
+namespace {
+
+/*!
+ * \brief Read the whole content of a file.
+ *
+ * Files compressed with gzip are decompressed automatically.
+ *
+ * \param[in] file_path File path.
+ * \return Content.
+ */
+[[nodiscard]] auto read_file_content(const std::string& file_path)
+    -> std::vector<unsigned char> {
+    gzFile file = gzopen(file_path.c_str(), "rb");
+    if (file == nullptr) {
+        throw StatBenchException(
+            fmt::format("Failed to open {}.", file_path));
+    }
+
+    std::vector<unsigned char> content;
+    constexpr std::size_t buffer_size = static_cast<std::size_t>(1024 * 1024);
+    std::vector<unsigned char> buffer(buffer_size);
+    while (true) {
+        const int read_size =
+            gzread(file, buffer.data(), static_cast<unsigned int>(buffer_size));
+        if (read_size < 0) {
+            (void)gzclose(file);
+            throw StatBenchException(
+                fmt::format("Failed to read {}.", file_path));
+        }
+        if (read_size == 0) {
+            break;
+        }
+        content.insert(content.end(), buffer.begin(),
+            buffer.begin() + static_cast<std::ptrdiff_t>(read_size));
+    }
+    (void)gzclose(file);
+    return content;
+}
+
+/*!
+ * \brief Check whether a content is in JSON.
+ *
+ * \param[in] content Content.
+ * \retval true The content is in JSON.
+ * \retval false The content is not in JSON. (MsgPack is assumed.)
+ */
+[[nodiscard]] auto is_json(const std::vector<unsigned char>& content) -> bool {
+    for (const unsigned char c : content) {
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+            continue;
+        }
+        return c == '{';
+    }
+    return false;
+}
+
+/*!
+ * \brief Replace null values with NaN.
+ *
+ * JSON has no representation of NaN, so NaN is written as null in JSON files.
+ *
+ * \param[in,out] data Data.
+ */
+void replace_null_with_nan(nlohmann::json& data) {
+    if (data.is_null()) {
+        data = std::numeric_limits<double>::quiet_NaN();
+        return;
+    }
+    if (data.is_structured()) {
+        for (auto& child : data) {
+            replace_null_with_nan(child);
+        }
+    }
+}
+
+}  // namespace
+
+auto read_data_file(const std::string& file_path) -> data_file_spec::RootData {
+    const std::vector<unsigned char> content = read_file_content(file_path);
+    try {
+        nlohmann::json data = is_json(content)
+            ? nlohmann::json::parse(content)
+            : nlohmann::json::from_msgpack(content);
+        replace_null_with_nan(data);
+        return data.get<data_file_spec::RootData>();
+    } catch (const std::exception& e) {
+        throw StatBenchException(
+            fmt::format("Invalid data file {}: {}", file_path, e.what()));
+    }
+}
+
+}  // namespace stat_bench::reporter
@@ -19,12 +19,16 @@
  */
 #include "stat_bench/reporter/data_file_reporter_base.h"
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "stat_bench/bench_impl/benchmark_group_config.h"
+#include "stat_bench/measurer/fit_complexity_by_case.h"
 #include "stat_bench/reporter/data_file_helper.h"
+#include "stat_bench/util/cache_sizes.h"
 #include "stat_bench/util/utf8_string.h"
 
 namespace stat_bench::reporter {
@@ -36,6 +40,11 @@ void DataFileReporterBase::experiment_starts(
     const clock::SystemTimePoint& time_stamp) {
     data_.started_at =
         util::Utf8String(fmt::format(FMT_STRING("{}"), time_stamp));
+
+    const auto& cache_sizes = util::detect_cache_sizes();
+    data_.cache_sizes.l1d = cache_sizes.l1d;
+    data_.cache_sizes.l2 = cache_sizes.l2;
+    data_.cache_sizes.l3 = cache_sizes.l3;
 }
 
 void DataFileReporterBase::experiment_finished(
@@ -43,12 +52,22 @@ void DataFileReporterBase::experiment_finished(
     data_.finished_at =
         util::Utf8String(fmt::format(FMT_STRING("{}"), time_stamp));
 
+    data_.measurements.reserve(measurements_.size());
+    for (const auto& measurement : measurements_) {
+        data_.measurements.push_back(data_file_spec::convert(*measurement));
+        if (measurement->iteration_regression()) {
+            data_.iteration_regressions.push_back(data_file_spec::convert(
+                *measurement, *measurement->iteration_regression()));
+        }
+    }
+    measurements_.clear();
+
     write_data_file(file_path_, data_);
 }
 
 void DataFileReporterBase::group_starts(const BenchmarkGroupName& /*name*/,
-    const bench_impl::BenchmarkGroupConfig& /*config*/) {
-    // no operation
+    const bench_impl::BenchmarkGroupConfig& config) {
+    complexity_parameters_ = config.complexity_parameters();
 }
 
 void DataFileReporterBase::group_finished(const BenchmarkGroupName& /*name*/) {
@@ -57,12 +76,26 @@ void DataFileReporterBase::group_finished(const BenchmarkGroupName& /*name*/) {
 
 void DataFileReporterBase::measurement_type_starts(
     const measurer::MeasurementType& /*type*/) {
-    // no operation
+    first_measurement_of_type_ = measurements_.size();
 }
 
 void DataFileReporterBase::measurement_type_finished(
     const measurer::MeasurementType& /*type*/) {
-    // no operation
+    if (complexity_parameters_.empty()) {
+        return;
+    }
+    const std::vector<std::shared_ptr<const measurer::Measurement>>
+        measurements_of_type(
+            measurements_.begin() +
+                static_cast<std::ptrdiff_t>(first_measurement_of_type_),
+            measurements_.end());
+    for (const auto& parameter_name : complexity_parameters_) {
+        for (const auto& fit : measurer::fit_complexity_by_case(
+                 measurements_of_type, parameter_name)) {
+            data_.complexity_fits.push_back(
+                data_file_spec::convert(fit, parameter_name));
+        }
+    }
 }
 
 void DataFileReporterBase::case_starts(const BenchmarkFullName& /*case_info*/) {
@@ -75,8 +108,8 @@ void DataFileReporterBase::case_finished(
 }
 
 void DataFileReporterBase::measurement_succeeded(
-    const measurer::Measurement& measurement) {
-    data_.measurements.push_back(data_file_spec::convert(measurement));
+    const std::shared_ptr<const measurer::Measurement>& measurement) {
+    measurements_.push_back(measurement);
 }
 
 void DataFileReporterBase::measurement_failed(
@@ -25,6 +25,6 @@ namespace stat_bench::reporter {
 
 //! URL of the schema of data files.
 inline constexpr std::string_view data_file_schema_url =
-    "https://cppstatbench.musicscience37.com/schemas/data_file_schema_v4.json";
+    "https://cppstatbench.musicscience37.com/schemas/data_file_schema_v5.json";
 
 }  // namespace stat_bench::reporter
@@ -19,40 +19,24 @@
  */
 #include "stat_bench/reporter/json_reporter.h"
 
-#include <fstream>
-#include <string_view>
 #include <utility>
 
-#include <fmt/format.h>
-#include <nlohmann/json.hpp>
-
-#include "data_file_schema_url.h"
+#include "json_stream_writer.h"
 #include "stat_bench/reporter/data_file_spec.h"
-#include "stat_bench/reporter/json_data_file_helper.h"  // IWYU pragma: keep
-#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/buffered_file_writer.h"
 #include "stat_bench/util/prepare_directory.h"
 
 namespace stat_bench::reporter {
 
-JsonReporter::JsonReporter(std::string file_path)
-    : DataFileReporterBase(std::move(file_path)) {}
+JsonReporter::JsonReporter(std::string file_path, JsonFormat format)
+    : DataFileReporterBase(std::move(file_path)), format_(format) {}
 
 void JsonReporter::write_data_file(
     const std::string& file_path, const data_file_spec::RootData& data) {
     util::prepare_directory_for(file_path);
-    std::ofstream stream{file_path};
-    if (!stream) {
-        throw StatBenchException(
-            fmt::format(FMT_STRING("Failed to open {}."), file_path));
-    }
-
-    auto json_data = nlohmann::json(data);
-    json_data["$schema"] = data_file_schema_url;
-
-    constexpr int indent = 2;
-    constexpr char indent_char = ' ';
-    constexpr bool ensure_ascii = true;
-    stream << json_data.dump(indent, indent_char, ensure_ascii);
+    util::BufferedFileWriter writer{file_path};
+    write_json_data_file(writer, data, format_);
+    writer.close();
 }
 
 }  // namespace stat_bench::reporter
@@ -0,0 +1,657 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of write_json_data_file function.
+ */
+#include "json_stream_writer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "data_file_schema_url.h"
+#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/utf8_string.h"
+
+namespace stat_bench::reporter {
+
+namespace {
+
+/*!
+ * \brief Class to write JSON tokens to a file.
+ */
+class JsonStreamWriter {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] writer Writer of the file.
+     * \param[in] format Format.
+     */
+    JsonStreamWriter(util::BufferedFileWriter& writer, JsonFormat format)
+        : writer_(writer), pretty_(format == JsonFormat::pretty) {}
+
+    /*!
+     * \brief Start an object.
+     */
+    void start_object() { start_container('{'); }
+
+    /*!
+     * \brief Finish an object.
+     */
+    void end_object() { end_container('}'); }
+
+    /*!
+     * \brief Start an array.
+     */
+    void start_array() { start_container('['); }
+
+    /*!
+     * \brief Finish an array.
+     */
+    void end_array() { end_container(']'); }
+
+    /*!
+     * \brief Write a key in an object.
+     *
+     * \param[in] key Key.
+     */
+    void key(std::string_view key) {
+        start_element();
+        write_string(key);
+        if (pretty_) {
+            writer_.write(": ", 2);
+        } else {
+            writer_.put(':');
+        }
+        after_key_ = true;
+    }
+
+    /*!
+     * \brief Write a string value.
+     *
+     * \param[in] value Value.
+     */
+    void value(std::string_view value) {
+        start_element();
+        write_string(value);
+    }
+
+    /*!
+     * \brief Write a string value.
+     *
+     * \param[in] value Value.
+     */
+    void value(const util::Utf8String& value) { this->value(value.str()); }
+
+    /*!
+     * \brief Write an integer value.
+     *
+     * \param[in] value Value.
+     */
+    void value(std::size_t value) {
+        start_element();
+        std::array<char, buffer_size> buffer{};
+        const auto* const end = fmt::format_to(buffer.data(), "{}", value);
+        writer_.write(
+            buffer.data(), static_cast<std::size_t>(end - buffer.data()));
+    }
+
+    /*!
+     * \brief Write a boolean value.
+     *
+     * \param[in] value Value.
+     */
+    void value(bool value) {
+        start_element();
+        if (value) {
+            writer_.write("true", 4);
+        } else {
+            writer_.write("false", 5);
+        }
+    }
+
+    /*!
+     * \brief Write a floating-point value.
+     *
+     * \param[in] value Value.
+     */
+    void value(float value) {
+        start_element();
+        if (!std::isfinite(value)) {
+            // Same as nlohmann library.
+            writer_.write("null", 4);
+            return;
+        }
+        std::array<char, buffer_size> buffer{};
+        auto* end = fmt::format_to(buffer.data(), "{}", value);
+        const bool has_point = std::any_of(buffer.data(), end,
+            [](char c) { return c == '.' || c == 'e' || c == 'E'; });
+        if (!has_point) {
+            // Keep numbers floating-point numbers in JSON as nlohmann library.
+            *end = '.';
+            ++end;
+            *end = '0';
+            ++end;
+        }
+        writer_.write(
+            buffer.data(), static_cast<std::size_t>(end - buffer.data()));
+    }
+
+private:
+    //! Size of buffers to format numbers.
+    static constexpr std::size_t buffer_size = 64;
+
+    //! Number of spaces in an indent.
+    static constexpr std::size_t indent_width = 2;
+
+    /*!
+     * \brief Start a container.
+     *
+     * \param[in] open_char Character to open the container.
+     */
+    void start_container(char open_char) {
+        start_element();
+        writer_.put(open_char);
+        is_first_element_.push_back(true);
+    }
+
+    /*!
+     * \brief Finish a container.
+     *
+     * \param[in] close_char Character to close the container.
+     */
+    void end_container(char close_char) {
+        const bool is_empty = is_first_element_.back();
+        is_first_element_.pop_back();
+        if (pretty_ && !is_empty) {
+            write_new_line();
+        }
+        writer_.put(close_char);
+    }
+
+    /*!
+     * \brief Prepare to write an element of a container.
+     */
+    void start_element() {
+        if (after_key_) {
+            after_key_ = false;
+            return;
+        }
+        if (is_first_element_.empty()) {
+            return;
+        }
+        if (is_first_element_.back()) {
+            is_first_element_.back() = false;
+        } else {
+            writer_.put(',');
+        }
+        if (pretty_) {
+            write_new_line();
+        }
+    }
+
+    /*!
+     * \brief Write a new line with indentation.
+     */
+    void write_new_line() {
+        writer_.put('\n');
+        std::size_t num_spaces = is_first_element_.size() * indent_width;
+        static constexpr std::string_view spaces = "                ";
+        while (num_spaces > spaces.size()) {
+            writer_.write(spaces);
+            num_spaces -= spaces.size();
+        }
+        writer_.write(spaces.data(), num_spaces);
+    }
+
+    /*!
+     * \brief Write a string escaping non-ASCII characters.
+     *
+     * \param[in] str String.
+     */
+    void write_string(std::string_view str) {
+        writer_.put('"');
+        std::size_t plain_begin = 0;
+        std::size_t i = 0;
+        while (i < str.size()) {
+            const auto c = static_cast<unsigned char>(str[i]);
+            if (c >= 0x20U && c < 0x7FU && c != '"' && c != '\\') {
+                ++i;
+                continue;
+            }
+            writer_.write(str.data() + plain_begin, i - plain_begin);
+            i = write_escaped(str, i);
+            plain_begin = i;
+        }
+        writer_.write(str.data() + plain_begin, str.size() - plain_begin);
+        writer_.put('"');
+    }
+
+    /*!
+     * \brief Write an escaped character.
+     *
+     * \param[in] str String.
+     * \param[in] pos Position of the character.
+     * \return Position of the next character.
+     */
+    auto write_escaped(std::string_view str, std::size_t pos) -> std::size_t {
+        const auto c = static_cast<unsigned char>(str[pos]);
+        switch (c) {
+        case '"':
+            writer_.write("\\\"", 2);
+            return pos + 1U;
+        case '\\':
+            writer_.write("\\\\", 2);
+            return pos + 1U;
+        case '\b':
+            writer_.write("\\b", 2);
+            return pos + 1U;
+        case '\f':
+            writer_.write("\\f", 2);
+            return pos + 1U;
+        case '\n':
+            writer_.write("\\n", 2);
+            return pos + 1U;
+        case '\r':
+            writer_.write("\\r", 2);
+            return pos + 1U;
+        case '\t':
+            writer_.write("\\t", 2);
+            return pos + 1U;
+        default:
+            break;
+        }
+
+        std::size_t num_bytes = 1;
+        std::uint32_t code_point = c;
+        // NOLINTBEGIN(*-magic-numbers)
+        if (c >= 0xF0U) {
+            num_bytes = 4;
+            code_point = c & 0x07U;
+        } else if (c >= 0xE0U) {
+            num_bytes = 3;
+            code_point = c & 0x0FU;
+        } else if (c >= 0xC0U) {
+            num_bytes = 2;
+            code_point = c & 0x1FU;
+        } else if (c >= 0x80U) {
+            throw StatBenchException("Invalid UTF-8 string.");
+        }
+        if (pos + num_bytes > str.size()) {
+            throw StatBenchException("Invalid UTF-8 string.");
+        }
+        for (std::size_t i = 1; i < num_bytes; ++i) {
+            code_point = (code_point << 6U) |
+                (static_cast<unsigned char>(str[pos + i]) & 0x3FU);
+        }
+
+        if (code_point >= 0x10000U) {
+            const std::uint32_t offset_code_point = code_point - 0x10000U;
+            write_unicode_escape(0xD800U + (offset_code_point >> 10U));
+            write_unicode_escape(0xDC00U + (offset_code_point & 0x3FFU));
+        } else {
+            write_unicode_escape(code_point);
+        }
+        // NOLINTEND(*-magic-numbers)
+        return pos + num_bytes;
+    }
+
+    /*!
+     * \brief Write an escape sequence of a UTF-16 code unit.
+     *
+     * \param[in] code_unit Code unit.
+     */
+    void write_unicode_escape(std::uint32_t code_unit) {
+        std::array<char, buffer_size> buffer{};
+        const auto* const end =
+            fmt::format_to(buffer.data(), "\\u{:04x}", code_unit);
+        writer_.write(
+            buffer.data(), static_cast<std::size_t>(end - buffer.data()));
+    }
+
+    //! Writer of the file.
+    util::BufferedFileWriter& writer_;
+
+    //! Whether to write in the pretty format.
+    bool pretty_;
+
+    //! Whether the next element is the first element in each container.
+    std::vector<bool> is_first_element_{};
+
+    //! Whether a key has been written just before.
+    bool after_key_{false};
+};
+
+/*!
+ * \brief Write statistics.
+ *
+ * \param[in] writer Writer.
+ * \param[in] data Data.
+ */
+void write_stat(
+    JsonStreamWriter& writer, const data_file_spec::StatData& data) {
+    writer.start_object();
+    writer.key("max");
+    writer.value(data.max);
+    writer.key("mean");
+    writer.value(data.mean);
+    writer.key("median");
+    writer.value(data.median);
+    writer.key("min");
+    writer.value(data.min);
+    writer.key("standard_deviation");
+    writer.value(data.standard_deviation);
+    writer.key("standard_error");
+    writer.value(data.standard_error);
+    writer.key("variance");
+    writer.value(data.variance);
+    writer.end_object();
+}
+
+/*!
+ * \brief Write diagnostics of drift.
+ *
+ * \param[in] writer Writer.
+ * \param[in] data Data.
+ */
+void write_drift(
+    JsonStreamWriter& writer, const data_file_spec::DriftData& data) {
+    writer.start_object();
+    writer.key("drifting");
+    writer.value(data.drifting);
+    writer.key("effective_sample_size");
+    writer.value(data.effective_sample_size);
+    writer.key("lag1_autocorrelation");
+    writer.value(data.lag1_autocorrelation);
+    writer.key("mann_kendall_p_value");
+    writer.value(data.mann_kendall_p_value);
+    writer.key("mann_kendall_z");
+    writer.value(data.mann_kendall_z);
+    writer.end_object();
+}
+
+/*!
+ * \brief Write values.
+ *
+ * \param[in] writer Writer.
+ * \param[in] values Values.
+ */
+void write_values(
+    JsonStreamWriter& writer, const std::vector<std::vector<float>>& values) {
+    writer.start_array();
+    for (const auto& values_in_thread : values) {
+        writer.start_array();
+        for (const float value : values_in_thread) {
+            writer.value(value);
+        }
+        writer.end_array();
+    }
+    writer.end_array();
+}
+
+/*!
+ * \brief Write parameters.
+ *
+ * \param[in] writer Writer.
+ * \param[in] params Parameters.
+ */
+void write_params(JsonStreamWriter& writer,
+    const std::unordered_map<util::Utf8String, util::Utf8String>& params) {
+    std::vector<const std::pair<const util::Utf8String, util::Utf8String>*>
+        sorted_params;
+    sorted_params.reserve(params.size());
+    for (const auto& param : params) {
+        sorted_params.push_back(&param);
+    }
+    std::sort(sorted_params.begin(), sorted_params.end(),
+        [](const auto* lhs, const auto* rhs) {
+            return lhs->first < rhs->first;
+        });
+
+    writer.start_object();
+    for (const auto* param : sorted_params) {
+        writer.key(param->first.str());
+        writer.value(param->second);
+    }
+    writer.end_object();
+}
+
+/*!
+ * \brief Write a measurement.
+ *
+ * \param[in] writer Writer.
+ * \param[in] data Data.
+ */
+void write_measurement(
+    JsonStreamWriter& writer, const data_file_spec::MeasurementData& data) {
+    writer.start_object();
+
+    writer.key("case_name");
+    writer.value(data.case_name);
+
+    writer.key("custom_outputs");
+    writer.start_array();
+    for (const auto& output : data.custom_outputs) {
+        writer.start_object();
+        writer.key("name");
+        writer.value(output.name);
+        writer.key("value");
+        writer.value(output.value);
+        writer.end_object();
+    }
+    writer.end_array();
+
+    writer.key("custom_stat_outputs");
+    writer.start_array();
+    for (const auto& output : data.custom_stat_outputs) {
+        writer.start_object();
+        writer.key("name");
+        writer.value(output.name);
+        writer.key("stat");
+        write_stat(writer, output.stat);
+        writer.key("values");
+        write_values(writer, output.values);
+        writer.end_object();
+    }
+    writer.end_array();
+
+    writer.key("durations");
+    writer.start_object();
+    writer.key("drift");
+    write_drift(writer, data.durations.drift);
+    writer.key("stat");
+    write_stat(writer, data.durations.stat);
+    writer.key("values");
+    write_values(writer, data.durations.values);
+    writer.end_object();
+
+    writer.key("group_name");
+    writer.value(data.group_name);
+
+    writer.key("iterations");
+    writer.value(data.iterations);
+
+    writer.key("measurement_type");
+    writer.value(data.measurement_type);
+
+    writer.key("params");
+    write_params(writer, data.params);
+
+    writer.key("samples");
+    writer.value(data.samples);
+
+    writer.key("warming_up_samples");
+    writer.value(data.warming_up_samples);
+
+    writer.end_object();
+}
+
+/*!
+ * \brief Write a result of fitting of a model of complexity.
+ *
+ * \param[in] writer Writer.
+ * \param[in] data Data.
+ */
+void write_complexity_fit(
+    JsonStreamWriter& writer, const data_file_spec::ComplexityFitData& data) {
+    writer.start_object();
+
+    writer.key("case_name");
+    writer.value(data.case_name);
+
+    writer.key("coefficient");
+    writer.value(data.coefficient);
+
+    writer.key("exponent");
+    writer.value(data.exponent);
+
+    writer.key("group_name");
+    writer.value(data.group_name);
+
+    writer.key("measurement_type");
+    writer.value(data.measurement_type);
+
+    writer.key("model");
+    writer.value(data.model);
+
+    writer.key("parameter_name");
+    writer.value(data.parameter_name);
+
+    writer.key("params");
+    write_params(writer, data.params);
+
+    writer.key("r_squared");
+    writer.value(data.r_squared);
+
+    writer.end_object();
+}
+
+/*!
+ * \brief Write a result of linear regression.
+ *
+ * \param[in] writer Writer.
+ * \param[in] data Data.
+ */
+void write_linear_regression(JsonStreamWriter& writer,
+    const data_file_spec::LinearRegressionData& data) {
+    writer.start_object();
+    writer.key("intercept");
+    writer.value(data.intercept);
+    writer.key("r_squared");
+    writer.value(data.r_squared);
+    writer.key("slope");
+    writer.value(data.slope);
+    writer.key("slope_lower");
+    writer.value(data.slope_lower);
+    writer.key("slope_upper");
+    writer.value(data.slope_upper);
+    writer.end_object();
+}
+
+/*!
+ * \brief Write a result of linear regression of durations on numbers of
+ * iterations.
+ *
+ * \param[in] writer Writer.
+ * \param[in] data Data.
+ */
+void write_iteration_regression(JsonStreamWriter& writer,
+    const data_file_spec::IterationRegressionData& data) {
+    writer.start_object();
+
+    writer.key("case_name");
+    writer.value(data.case_name);
+
+    writer.key("group_name");
+    writer.value(data.group_name);
+
+    writer.key("measurement_type");
+    writer.value(data.measurement_type);
+
+    writer.key("ordinary_least_squares");
+    write_linear_regression(writer, data.ordinary_least_squares);
+
+    writer.key("params");
+    write_params(writer, data.params);
+
+    writer.key("theil_sen");
+    write_linear_regression(writer, data.theil_sen);
+
+    writer.end_object();
+}
+
+}  // namespace
+
+void write_json_data_file(util::BufferedFileWriter& writer,
+    const data_file_spec::RootData& data, JsonFormat format) {
+    JsonStreamWriter json_writer{writer, format};
+
+    json_writer.start_object();
+
+    json_writer.key("$schema");
+    json_writer.value(data_file_schema_url);
+
+    json_writer.key("cache_sizes");
+    json_writer.start_object();
+    json_writer.key("l1d");
+    json_writer.value(data.cache_sizes.l1d);
+    json_writer.key("l2");
+    json_writer.value(data.cache_sizes.l2);
+    json_writer.key("l3");
+    json_writer.value(data.cache_sizes.l3);
+    json_writer.end_object();
+
+    json_writer.key("complexity_fits");
+    json_writer.start_array();
+    for (const auto& fit : data.complexity_fits) {
+        write_complexity_fit(json_writer, fit);
+    }
+    json_writer.end_array();
+
+    json_writer.key("finished_at");
+    json_writer.value(data.finished_at);
+
+    json_writer.key("iteration_regressions");
+    json_writer.start_array();
+    for (const auto& regression : data.iteration_regressions) {
+        write_iteration_regression(json_writer, regression);
+    }
+    json_writer.end_array();
+
+    json_writer.key("measurements");
+    json_writer.start_array();
+    for (const auto& measurement : data.measurements) {
+        write_measurement(json_writer, measurement);
+    }
+    json_writer.end_array();
+
+    json_writer.key("started_at");
+    json_writer.value(data.started_at);
+
+    json_writer.end_object();
+}
+
+}  // namespace stat_bench::reporter
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of write_json_data_file function.
+ *
+ * (Internal header.)
+ */
+#pragma once
+
+#include "stat_bench/reporter/data_file_spec.h"
+#include "stat_bench/reporter/json_reporter.h"
+#include "stat_bench/util/buffered_file_writer.h"
+
+namespace stat_bench::reporter {
+
+/*!
+ * \brief Write a data file in JSON without constructing JSON objects in
+ * memory.
+ *
+ * Keys of objects are written in the lexicographical order as in nlohmann
+ * library.
+ *
+ * \param[in] writer Writer of the file.
+ * \param[in] data Data.
+ * \param[in] format Format.
+ */
+void write_json_data_file(util::BufferedFileWriter& writer,
+    const data_file_spec::RootData& data, JsonFormat format);
+
+}  // namespace stat_bench::reporter
@@ -30,6 +30,7 @@
 #include "stat_bench/benchmark_group_name.h"
 #include "stat_bench/plots/box_plot.h"
 #include "stat_bench/plots/cdf_line_plot.h"
+#include "stat_bench/plots/density_plot.h"
 #include "stat_bench/plots/samples_line_plot.h"
 #include "stat_bench/plots/violin_plot.h"
 #include "stat_bench/util/escape_for_file_name.h"
@@ -37,14 +38,36 @@
 
 namespace stat_bench::reporter {
 
-PlotReporter::PlotReporter(std::string prefix)
-    : prefix_(std::move(prefix)), group_name_(""), measurement_type_("") {
-    builtin_plots_.push_back(std::make_shared<plots::SamplesLinePlot>());
-    builtin_plots_.push_back(std::make_shared<plots::CdfLinePlot>());
-    builtin_plots_.push_back(std::make_shared<plots::ViolinPlot>());
-    builtin_plots_.push_back(std::make_shared<plots::BoxPlot>());
+PlotReporter::PlotReporter(std::string prefix,
+    std::size_t max_points_per_trace, std::size_t num_threads,
+    std::vector<std::size_t> cpu_indices, std::size_t density_plot_threshold)
+    : prefix_(std::move(prefix)),
+      group_name_(""),
+      measurement_type_(""),
+      violin_plot_(std::make_shared<plots::ViolinPlot>(max_points_per_trace)),
+      density_plot_threshold_(density_plot_threshold) {
+    builtin_plots_.push_back(
+        std::make_shared<plots::SamplesLinePlot>(max_points_per_trace));
+    builtin_plots_.push_back(
+        std::make_shared<plots::CdfLinePlot>(max_points_per_trace));
+    builtin_plots_.push_back(violin_plot_);
+    builtin_plots_.push_back(
+        std::make_shared<plots::BoxPlot>(max_points_per_trace));
+    if (density_plot_threshold_ > 0) {
+        density_plot_ = std::make_shared<plots::DensityPlot>();
+    }
+
+    if (num_threads > 0) {
+        // Each task holds all measurements of a measurement type, so the
+        // number of pending tasks is limited to bound the memory usage.
+        const std::size_t max_pending_tasks = 2 * num_threads;
+        worker_pool_ = std::make_unique<util::WorkerPool>(
+            num_threads, max_pending_tasks, std::move(cpu_indices));
+    }
 }
 
+PlotReporter::~PlotReporter() = default;
+
 void PlotReporter::experiment_starts(
     const clock::SystemTimePoint& /*time_stamp*/) {
     // no operation
@@ -52,7 +75,9 @@ void PlotReporter::experiment_starts(
 
 void PlotReporter::experiment_finished(
     const clock::SystemTimePoint& /*time_stamp*/) {
-    // no operation
+    if (worker_pool_) {
+        worker_pool_->wait();
+    }
 }
 
 void PlotReporter::group_starts(const BenchmarkGroupName& name,
@@ -82,17 +107,47 @@ void PlotReporter::measurement_type_starts(
 
 void PlotReporter::measurement_type_finished(
     const measurer::MeasurementType& /*type*/) {
-    const auto process_plot = [this](
+    // Measurements are shared among tasks rendering plots.
+    const auto measurements = std::make_shared<
+        const std::vector<std::shared_ptr<const measurer::Measurement>>>(
+        std::move(measurements_));
+    const auto process_plot = [this, &measurements](
                                   const std::shared_ptr<plots::IPlot>& plot) {
-        const std::string file_path = fmt::format("{}/{}/{}_{}.html", prefix_,
+        std::string file_path = fmt::format("{}/{}/{}_{}.html", prefix_,
             util::escape_for_file_name(group_name_.str()),
             measurement_type_for_file_paths_,
             util::escape_for_file_name(plot->name_for_file()));
+        // Directories are created here to avoid races among worker threads.
         std::filesystem::create_directories(
             std::filesystem::path(file_path).parent_path());
-        plot->write(measurement_type_, group_name_, measurements_, file_path);
+        if (!worker_pool_) {
+            plot->write(
+                measurement_type_, group_name_, *measurements, file_path);
+            return;
+        }
+        worker_pool_->submit(
+            [plot, measurement_type = measurement_type_,
+                group_name = group_name_, measurements,
+                file_path = std::move(file_path)] {
+                plot->write(
+                    measurement_type, group_name, *measurements, file_path);
+            });
     };
+    bool use_density_plot = false;
+    if (density_plot_) {
+        for (const auto& measurement : *measurements) {
+            if (measurement->durations_stat().sorted_samples().size() >
+                density_plot_threshold_) {
+                use_density_plot = true;
+                break;
+            }
+        }
+    }
     for (const auto& plot : builtin_plots_) {
+        if (use_density_plot && plot == violin_plot_) {
+            process_plot(density_plot_);
+            continue;
+        }
         process_plot(plot);
     }
     for (const auto& plot : group_plots_) {
@@ -111,7 +166,7 @@ void PlotReporter::case_finished(const BenchmarkFullName& /*case_info*/) {
 }
 
 void PlotReporter::measurement_succeeded(
-    const measurer::Measurement& measurement) {
+    const std::shared_ptr<const measurer::Measurement>& measurement) {
     measurements_.push_back(measurement);
 }
 
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of replay_measurements function.
+ */
+#include "stat_bench/reporter/replay_measurements.h"
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "stat_bench/benchmark_full_name.h"
+#include "stat_bench/clock/system_time_point.h"
+#include "stat_bench/measurer/measurement_type.h"
+#include "stat_bench/util/ordered_map.h"
+
+namespace stat_bench::reporter {
+
+void replay_measurements(std::vector<measurer::Measurement> measurements,
+    IReporter& reporter, const GroupConfigurator& configure_group) {
+    using MeasurementList =
+        std::vector<std::shared_ptr<const measurer::Measurement>>;
+    util::OrderedMap<BenchmarkGroupName,
+        util::OrderedMap<measurer::MeasurementType, MeasurementList>>
+        groups;
+    for (auto& measurement : measurements) {
+        const BenchmarkGroupName group_name =
+            measurement.case_info().group_name();
+        const measurer::MeasurementType measurement_type =
+            measurement.measurement_type();
+        groups.try_emplace(group_name)
+            .first->second.try_emplace(measurement_type)
+            .first->second.push_back(
+                std::make_shared<const measurer::Measurement>(
+                    std::move(measurement)));
+    }
+    measurements.clear();
+
+    reporter.experiment_starts(
+        clock::SystemTimePoint(std::chrono::system_clock::now()));
+    for (const auto& [group_name, measurement_types] : groups) {
+        bench_impl::BenchmarkGroupConfig config;
+        configure_group(group_name, config);
+        reporter.group_starts(group_name, config);
+        for (const auto& [measurement_type, measurement_list] :
+            measurement_types) {
+            reporter.measurement_type_starts(measurement_type);
+            std::optional<BenchmarkFullName> current_case;
+            for (const auto& measurement : measurement_list) {
+                if (current_case &&
+                    current_case->case_name() !=
+                        measurement->case_info().case_name()) {
+                    reporter.case_finished(*current_case);
+                    current_case.reset();
+                }
+                if (!current_case) {
+                    current_case = measurement->case_info();
+                    reporter.case_starts(*current_case);
+                }
+                reporter.measurement_succeeded(measurement);
+            }
+            if (current_case) {
+                reporter.case_finished(*current_case);
+            }
+            reporter.measurement_type_finished(measurement_type);
+        }
+        reporter.group_finished(group_name);
+    }
+    reporter.experiment_finished(
+        clock::SystemTimePoint(std::chrono::system_clock::now()));
+}
+
+}  // namespace stat_bench::reporter
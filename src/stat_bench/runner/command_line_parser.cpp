@@ -42,11 +42,42 @@ CommandLineParser::CommandLineParser() {
             .optional()
             .help("Generate plots of results."));
 
+    cli_.add_argument(lyra::opt(config_.plot_max_points, "num")
+            .name("--plot_max_points")
+            .optional()
+            .help("Maximum number of points per trace in plots of samples. "
+                  "Zero specifies no limit."));
+
+    cli_.add_argument(lyra::opt(config_.plot_threads, "num")
+            .name("--plot_threads")
+            .optional()
+            .help("Number of threads to render plots. "
+                  "Zero specifies rendering in the thread of reporters."));
+
+    cli_.add_argument(lyra::opt(config_.plot_cpus, "index")
+            .name("--plot_cpu")
+            .cardinality(0, 0)
+            .help("Index of a CPU core to run threads rendering plots. "
+                  "When omitted, the threads aren't restricted."));
+
+    cli_.add_argument(lyra::opt(config_.plot_density_threshold, "num")
+            .name("--plot_density_threshold")
+            .optional()
+            .help("Number of samples in a case above which a plot of "
+                  "probability density replaces the violin plot. "
+                  "Zero specifies no replacement."));
+
     cli_.add_argument(lyra::opt(config_.json_file_path, "filepath")
             .name("--json")
             .optional()
             .help("Generate JSON data file of results."));
 
+    cli_.add_argument(lyra::opt(config_.json_compact)
+            .name("--json_compact")
+            .optional()
+            .help(
+                "Write JSON data file in compact format without whitespaces."));
+
     cli_.add_argument(lyra::opt(config_.msgpack_file_path, "filepath")
             .name("--msgpack")
             .optional()
@@ -58,6 +89,25 @@ CommandLineParser::CommandLineParser() {
             .optional()
             .help("Generate compressed MsgPack data file of results."));
 
+    cli_.add_argument(lyra::opt(config_.compression_level, "num")
+            .name("--compression_level")
+            .optional()
+            .choices([](int val) { return val >= 1 && val <= 9; })
+            .help("Compression level of compressed MsgPack data file "
+                  "from 1 (fastest) to 9 (smallest)."));
+
+    cli_.add_argument(lyra::opt(config_.sync_reporters)
+            .name("--sync_reporters")
+            .optional()
+            .help("Call reporters in the thread of measurements "
+                  "instead of a separate thread."));
+
+    cli_.add_argument(lyra::opt(config_.reporter_cpu, "index")
+            .name("--reporter_cpu")
+            .optional()
+            .help("Index of the CPU core to pin the thread of reporters. "
+                  "Negative values specify no pinning."));
+
     cli_.add_argument(lyra::opt(config_.samples, "num")
             .name("--samples")
             .optional()
@@ -82,6 +132,41 @@ CommandLineParser::CommandLineParser() {
             .choices([](double val) { return val >= 0.0; })
             .help("Minimum duration for warming up. [sec]"));
 
+    cli_.add_argument(lyra::opt(config_.param_sampling, "method")
+            .name("--param_sampling")
+            .optional()
+            .choices("full", "random", "latin_hypercube",
+                "fractional_factorial")
+            .help("Method to sample combinations of parameters "
+                  "(full, random, latin_hypercube, fractional_factorial). "
+                  "When omitted, the method in each fixture is used."));
+
+    cli_.add_argument(lyra::opt(config_.max_conditions, "num")
+            .name("--max_conditions")
+            .optional()
+            .help("Maximum number of combinations of parameters per case. "
+                  "Zero specifies the value in each fixture. "
+                  "Requires --param_sampling."));
+
+    cli_.add_argument(lyra::opt(config_.param_sampling_seed, "num")
+            .name("--param_sampling_seed")
+            .optional()
+            .help("Seed of random numbers used in sampling of parameters. "
+                  "Requires --param_sampling."));
+
+    cli_.add_argument(lyra::opt(config_.threads, "num")
+            .name("--threads")
+            .cardinality(0, 0)
+            .help("Number of threads used instead of values generated from "
+                  "the topology of CPUs. "
+                  "This option can be specified multiple times."));
+
+    cli_.add_argument(lyra::opt(config_.max_threads, "num")
+            .name("--max_threads")
+            .optional()
+            .help("Maximum number of threads in values generated from "
+                  "the topology of CPUs. Zero specifies no limit."));
+
     cli_.add_argument(lyra::opt(config_.include_glob, "pattern")
             .name("--include")
             .cardinality(0, 0)
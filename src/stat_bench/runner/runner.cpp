@@ -19,9 +19,14 @@
  */
 #include "stat_bench/runner/runner.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <exception>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "stat_bench/bench_impl/benchmark_case_registry.h"
 #include "stat_bench/bench_impl/benchmark_group.h"
@@ -32,13 +37,22 @@
 #include "stat_bench/clock/system_clock.h"
 #include "stat_bench/clock/system_time_point.h"
 #include "stat_bench/filters/composed_filter.h"
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/param/adaptive_refinement.h"
+#include "stat_bench/param/auto_num_threads.h"
 #include "stat_bench/param/parameter_config.h"
+#include "stat_bench/param/parameter_dict.h"
 #include "stat_bench/param/parameter_generator.h"
+#include "stat_bench/param/parameter_sampling.h"
+#include "stat_bench/param/parameter_value_vector.h"
+#include "stat_bench/reporter/async_reporter.h"
 #include "stat_bench/reporter/compressed_msgpack_reporter.h"
 #include "stat_bench/reporter/console_reporter.h"
 #include "stat_bench/reporter/json_reporter.h"
 #include "stat_bench/reporter/msgpack_reporter.h"
 #include "stat_bench/reporter/plot_reporter.h"
+#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/cpu_topology.h"
 #include "stat_bench/util/ordered_map.h"
 
 namespace stat_bench::runner {
@@ -49,27 +63,65 @@ Runner::Runner(
           config.min_warming_up_duration_sec, config.samples,
           config.min_warming_up_iterations),
       registry_(registry) {
-    reporters_.push_back(std::make_shared<reporter::ConsoleReporter>());
+    if (!config.param_sampling.empty()) {
+        param_sampling_ = param::ParameterSamplingConfig{
+            param::parse_parameter_sampling_method(config.param_sampling),
+            config.max_conditions, config.param_sampling_seed};
+    } else if (config.max_conditions != 0) {
+        // Without a method, conditions would be truncated in the order of
+        // generation for fixtures sampling all combinations.
+        throw StatBenchException(
+            "--max_conditions requires --param_sampling.");
+    } else if (config.param_sampling_seed !=
+        param::default_parameter_sampling_seed) {
+        throw StatBenchException(
+            "--param_sampling_seed requires --param_sampling.");
+    }
+    if (!config.threads.empty()) {
+        auto_threads_ = config.threads;
+    } else if (config.max_threads != 0) {
+        auto_threads_ = param::generate_auto_num_threads(
+            util::detect_cpu_topology(), config.max_threads);
+    }
+
+    std::vector<std::shared_ptr<reporter::IReporter>> reporters;
+    reporters.push_back(std::make_shared<reporter::ConsoleReporter>());
 
     if (!config.plot_prefix.empty()) {
-        reporters_.push_back(
-            std::make_shared<reporter::PlotReporter>(config.plot_prefix));
+        reporters.push_back(std::make_shared<reporter::PlotReporter>(
+            config.plot_prefix, config.plot_max_points, config.plot_threads,
+            config.plot_cpus, config.plot_density_threshold));
     }
 
     if (!config.json_file_path.empty()) {
-        reporters_.push_back(
-            std::make_shared<reporter::JsonReporter>(config.json_file_path));
+        reporters.push_back(std::make_shared<reporter::JsonReporter>(
+            config.json_file_path,
+            config.json_compact ? reporter::JsonFormat::compact
+                                : reporter::JsonFormat::pretty));
     }
 
     if (!config.msgpack_file_path.empty()) {
-        reporters_.push_back(std::make_shared<reporter::MsgPackReporter>(
+        reporters.push_back(std::make_shared<reporter::MsgPackReporter>(
             config.msgpack_file_path));
     }
 
     if (!config.compressed_msgpack_file_path.empty()) {
-        reporters_.push_back(
+        reporters.push_back(
             std::make_shared<reporter::CompressedMsgPackReporter>(
-                config.compressed_msgpack_file_path));
+                config.compressed_msgpack_file_path,
+                config.compression_level));
+    }
+
+    if (config.sync_reporters) {
+        reporters_ = std::move(reporters);
+    } else {
+        std::optional<std::size_t> reporter_cpu;
+        if (config.reporter_cpu >= 0) {
+            reporter_cpu = static_cast<std::size_t>(config.reporter_cpu);
+        }
+        async_reporter_ = std::make_shared<reporter::AsyncReporter>(
+            std::move(reporters), reporter_cpu);
+        reporters_.push_back(async_reporter_);
     }
 
     filters::ComposedFilter filter;
@@ -133,31 +185,158 @@ void Runner::run_case(
     const std::shared_ptr<bench_impl::IBenchmarkCase>& bench_case,
     const MeasurementConfig& measurement_config) const {
     auto params = bench_case->params();
+    if (param_sampling_) {
+        params.set_sampling(*param_sampling_);
+    }
+    if (!auto_threads_.empty() && params.has_auto_threads()) {
+        params.set_auto_threads(auto_threads_, util::detect_cpu_topology(),
+            params.annotates_thread_placement());
+    }
     auto generator = params.create_generator();
+    if (generator.empty()) {
+        return;
+    }
+
+    // Resources cached in executions are released even when errors in
+    // reporters or adaptive refinement stop this case.
+    try {
+        std::vector<std::shared_ptr<const measurer::Measurement>> measurements;
+        while (true) {
+            const auto condition = BenchmarkCondition(generator.generate());
+
+            auto measurement = run_case_with_condition(
+                bench_case, condition, measurement_config);
+            if (measurement) {
+                measurements.push_back(std::move(measurement));
+            }
+
+            if (!generator.iterate()) {
+                break;
+            }
+        }
+
+        for (const auto& [param_name, values] : params.params()) {
+            if (values->refinement() && values->size() > 0) {
+                refine_case(bench_case, measurement_config, params,
+                    param_name, *values, measurements);
+            }
+        }
+    } catch (...) {
+        bench_case->release_cached_resources();
+        throw;
+    }
+
+    bench_case->release_cached_resources();
+}
+
+void Runner::refine_case(
+    const std::shared_ptr<bench_impl::IBenchmarkCase>& bench_case,
+    const MeasurementConfig& measurement_config,
+    const param::ParameterConfig& params,
+    const param::ParameterName& param_name,
+    const param::IParameterValueVector& values,
+    std::vector<std::shared_ptr<const measurer::Measurement>>& measurements)
+    const {
+    const auto& config = *values.refinement();
+
+    /*!
+     * \brief Struct of candidates of conditions to add.
+     */
+    struct Candidate {
+        //! Score.
+        double score;
 
-    while (true) {
-        const auto condition = BenchmarkCondition(generator.generate());
+        //! Parameters.
+        param::ParameterDict params;
+    };
 
-        run_case_with_condition(bench_case, condition, measurement_config);
+    std::size_t remaining_points = config.max_points;
+    while (remaining_points > 0) {
+        // Measurements are grouped by parameters other than the refined one.
+        util::OrderedMap<param::ParameterDict,
+            std::vector<std::shared_ptr<const measurer::Measurement>>>
+            lines;
+        for (const auto& measurement : measurements) {
+            lines[measurement->cond().params().clone_without(param_name)]
+                .push_back(measurement);
+        }
+
+        std::vector<Candidate> candidates;
+        for (auto& [other_params, line] : lines) {
+            std::stable_sort(line.begin(), line.end(),
+                [&param_name](const auto& lhs, const auto& rhs) {
+                    return lhs->cond().params().get_as_double(param_name) <
+                        rhs->cond().params().get_as_double(param_name);
+                });
+            std::vector<double> param_values;
+            std::vector<double> mean_times;
+            param_values.reserve(line.size());
+            mean_times.reserve(line.size());
+            for (const auto& measurement : line) {
+                param_values.push_back(
+                    measurement->cond().params().get_as_double(param_name));
+                mean_times.push_back(measurement->durations_stat().mean());
+            }
 
-        if (!generator.iterate()) {
+            const auto intervals = param::find_refinement_intervals(
+                param_values, mean_times, config.threshold);
+            for (const auto& interval : intervals) {
+                const double lower = param_values[interval.index];
+                const double upper = param_values[interval.index + 1];
+                const auto value = values.create_value(
+                    param::calc_refinement_point(lower, upper));
+                const double value_as_double = value.to_double();
+                if (!(lower < value_as_double && value_as_double < upper)) {
+                    continue;
+                }
+                auto new_params =
+                    line.front()->cond().params().clone_with(param_name, value);
+                if (!params.satisfies_constraints(new_params)) {
+                    continue;
+                }
+                candidates.push_back(
+                    Candidate{interval.score, std::move(new_params)});
+            }
+        }
+        if (candidates.empty()) {
             break;
         }
+
+        std::stable_sort(candidates.begin(), candidates.end(),
+            [](const Candidate& lhs, const Candidate& rhs) {
+                return lhs.score > rhs.score;
+            });
+        if (candidates.size() > remaining_points) {
+            candidates.erase(candidates.begin() +
+                    static_cast<std::ptrdiff_t>(remaining_points),
+                candidates.end());
+        }
+        remaining_points -= candidates.size();
+
+        for (const auto& candidate : candidates) {
+            auto measurement = run_case_with_condition(bench_case,
+                BenchmarkCondition(candidate.params), measurement_config);
+            if (measurement) {
+                measurements.push_back(std::move(measurement));
+            }
+        }
     }
 }
 
-void Runner::run_case_with_condition(
+auto Runner::run_case_with_condition(
     const std::shared_ptr<bench_impl::IBenchmarkCase>& bench_case,
     const BenchmarkCondition& condition,
-    const MeasurementConfig& measurement_config) const {
+    const MeasurementConfig& measurement_config) const
+    -> std::shared_ptr<const measurer::Measurement> {
     for (const auto& reporter : reporters_) {
         reporter->case_starts(bench_case->info());
     }
 
+    std::shared_ptr<const measurer::Measurement> measurement;
     std::exception_ptr error_in_reporter;
     try {
-        const auto measurement =
-            measurer_.measure(bench_case.get(), condition, measurement_config);
+        measurement = std::make_shared<const measurer::Measurement>(
+            measurer_.measure(bench_case.get(), condition, measurement_config));
 
         try {
             for (const auto& reporter : reporters_) {
@@ -179,6 +358,8 @@ void Runner::run_case_with_condition(
     for (const auto& reporter : reporters_) {
         reporter->case_finished(bench_case->info());
     }
+
+    return measurement;
 }
 
 }  // namespace stat_bench::runner
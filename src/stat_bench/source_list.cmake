@@ -14,42 +14,72 @@ set(SOURCE_FILES
     filters/glob_filter.cpp
     filters/regex_filter.cpp
     measurement_config.cpp
+    measurer/analyze_thread_scaling.cpp
     measurer/determine_iterations.cpp
+    measurer/determine_steady_state_warming_up_samples.cpp
     measurer/determine_warming_up_samples.cpp
+    measurer/fit_complexity_by_case.cpp
+    measurer/fit_iteration_regression.cpp
     measurer/generate_default_measurement_configs.cpp
     measurer/measure_once.cpp
     measurer/measurement_type.cpp
     measurer/measurer.cpp
+    param/adaptive_refinement.cpp
+    param/auto_num_threads.cpp
     param/parameter_dict.cpp
     param/parameter_generator.cpp
     param/parameter_name.cpp
+    param/parameter_sampling.cpp
     plot_options.cpp
     plots/box_plot.cpp
     plots/cdf_line_plot.cpp
     plots/create_data_table.cpp
+    plots/decimate_samples.cpp
+    plots/density_plot.cpp
+    plots/histogram_plot.cpp
+    plots/iteration_regression_plot.cpp
     plots/parameter_to_output_line_plot.cpp
     plots/parameter_to_time_box_plot.cpp
     plots/parameter_to_time_line_plot.cpp
     plots/parameter_to_time_violin_plot.cpp
     plots/plot_utils.cpp
     plots/samples_line_plot.cpp
+    plots/thread_scaling_plot.cpp
     plots/time_to_output_by_parameter_line_plot.cpp
     plots/violin_plot.cpp
+    reporter/async_reporter.cpp
     reporter/compressed_msgpack_reporter.cpp
     reporter/console_reporter.cpp
     reporter/data_file_helper.cpp
+    reporter/data_file_reader.cpp
     reporter/data_file_reporter_base.cpp
     reporter/json_reporter.cpp
+    reporter/json_stream_writer.cpp
     reporter/msgpack_reporter.cpp
     reporter/plot_reporter.cpp
+    reporter/replay_measurements.cpp
     runner/command_line_parser.cpp
     runner/runner.cpp
     stat/calc_stat.cpp
+    stat/complexity_fit.cpp
+    stat/density_estimation.cpp
+    stat/drift_diagnostics.cpp
+    stat/linear_regression.cpp
+    stat/scalability_fit.cpp
+    stat/steady_state.cpp
     use_pointer.cpp
+    util/aligned_buffer.cpp
+    util/buffered_file_writer.cpp
+    util/cache_evictor.cpp
+    util/cache_sizes.cpp
     util/check_glob_pattern.cpp
+    util/cpu_topology.cpp
     util/escape_for_file_name.cpp
     util/escape_for_html.cpp
+    util/parallel_gzip_writer.cpp
     util/prepare_directory.cpp
     util/sync_barrier.cpp
+    util/thread_affinity.cpp
     util/utf8_string.cpp
+    util/worker_pool.cpp
 )
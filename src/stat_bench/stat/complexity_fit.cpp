@@ -0,0 +1,295 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to fit models of asymptotic complexity.
+ */
+#include "stat_bench/stat/complexity_fit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::stat {
+
+namespace {
+
+//! Minimum number of points to fit models.
+constexpr std::size_t min_points = 3;
+
+/*!
+ * \brief Calculate the function of a fixed model.
+ *
+ * \param[in] model Model.
+ * \param[in] n Value of the parameter.
+ * \return Value of the function.
+ */
+[[nodiscard]] auto calc_model_function(ComplexityModel model, double n)
+    -> double {
+    switch (model) {
+    case ComplexityModel::constant:
+        return 1.0;
+    case ComplexityModel::logarithmic:
+        return std::log(n);
+    case ComplexityModel::linear:
+        return n;
+    case ComplexityModel::linearithmic:
+        return n * std::log(n);
+    case ComplexityModel::quadratic:
+        return n * n;
+    default:
+        throw StatBenchException("Invalid model of complexity.");
+    }
+}
+
+/*!
+ * \brief Calculate weights of points.
+ *
+ * \param[in] times Mean times.
+ * \param[in] errors Standard errors of times.
+ * \return Weights.
+ */
+[[nodiscard]] auto calc_weights(
+    const std::vector<double>& times, const std::vector<double>& errors)
+    -> std::vector<double> {
+    const bool use_errors = std::all_of(errors.begin(), errors.end(),
+        [](double error) { return error > 0.0 && std::isfinite(error); });
+    std::vector<double> weights;
+    weights.reserve(times.size());
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        if (use_errors) {
+            weights.push_back(1.0 / (errors[i] * errors[i]));
+        } else if (times[i] > 0.0) {
+            weights.push_back(1.0 / (times[i] * times[i]));
+        } else {
+            weights.push_back(1.0);
+        }
+    }
+    return weights;
+}
+
+/*!
+ * \brief Calculate the weighted sum of squared residuals.
+ *
+ * \param[in] result Result of fitting.
+ * \param[in] sizes Values of the parameter.
+ * \param[in] times Mean times.
+ * \param[in] weights Weights.
+ * \return Weighted sum of squared residuals.
+ */
+[[nodiscard]] auto calc_residual_sum(const ComplexityFitResult& result,
+    const std::vector<double>& sizes, const std::vector<double>& times,
+    const std::vector<double>& weights) -> double {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        const double residual =
+            times[i] - evaluate_complexity_model(result, sizes[i]);
+        sum += weights[i] * residual * residual;
+    }
+    return sum;
+}
+
+/*!
+ * \brief Calculate the weighted coefficient of determination.
+ *
+ * \param[in] residual_sum Weighted sum of squared residuals.
+ * \param[in] times Mean times.
+ * \param[in] weights Weights.
+ * \return Coefficient of determination.
+ */
+[[nodiscard]] auto calc_r_squared(double residual_sum,
+    const std::vector<double>& times, const std::vector<double>& weights)
+    -> double {
+    double weight_sum = 0.0;
+    double weighted_time_sum = 0.0;
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        weight_sum += weights[i];
+        weighted_time_sum += weights[i] * times[i];
+    }
+    const double mean_time = weighted_time_sum / weight_sum;
+    double total_sum = 0.0;
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        const double diff = times[i] - mean_time;
+        total_sum += weights[i] * diff * diff;
+    }
+    if (total_sum <= 0.0) {
+        return residual_sum <= 0.0 ? 1.0 : 0.0;
+    }
+    return 1.0 - residual_sum / total_sum;
+}
+
+}  // namespace
+
+auto to_string(ComplexityModel model) -> std::string {
+    switch (model) {
+    case ComplexityModel::constant:
+        return "O(1)";
+    case ComplexityModel::logarithmic:
+        return "O(log n)";
+    case ComplexityModel::linear:
+        return "O(n)";
+    case ComplexityModel::linearithmic:
+        return "O(n log n)";
+    case ComplexityModel::quadratic:
+        return "O(n^2)";
+    case ComplexityModel::power:
+        return "O(n^k)";
+    }
+    return "";
+}
+
+auto format_complexity(const ComplexityFitResult& result) -> std::string {
+    if (result.model == ComplexityModel::power) {
+        return fmt::format(FMT_STRING("O(n^{:.2f})"), result.exponent);
+    }
+    return to_string(result.model);
+}
+
+auto evaluate_complexity_model(const ComplexityFitResult& result, double n)
+    -> double {
+    if (result.model == ComplexityModel::power) {
+        return result.coefficient * std::pow(n, result.exponent);
+    }
+    return result.coefficient * calc_model_function(result.model, n);
+}
+
+auto fit_complexity_model(ComplexityModel model,
+    const std::vector<double>& sizes, const std::vector<double>& times,
+    const std::vector<double>& errors) -> ComplexityFitResult {
+    if (sizes.size() != times.size() || sizes.size() != errors.size()) {
+        throw StatBenchException(
+            "Sizes of vectors to fit models of complexity must be same.");
+    }
+    if (std::any_of(sizes.begin(), sizes.end(),
+            [](double size) { return !(size > 0.0); })) {
+        throw StatBenchException(
+            "Values of parameters to fit models of complexity must be "
+            "positive.");
+    }
+    const auto weights = calc_weights(times, errors);
+
+    ComplexityFitResult result;
+    result.model = model;
+    if (model == ComplexityModel::power) {
+        // log(t) = log(a) + k log(n) with standard errors of log(t) being
+        // approximately relative errors of t.
+        double sum_w = 0.0;
+        double sum_wx = 0.0;
+        double sum_wy = 0.0;
+        double sum_wxx = 0.0;
+        double sum_wxy = 0.0;
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            if (!(times[i] > 0.0)) {
+                continue;
+            }
+            const double x = std::log(sizes[i]);
+            const double y = std::log(times[i]);
+            const double w = weights[i] * times[i] * times[i];
+            sum_w += w;
+            sum_wx += w * x;
+            sum_wy += w * y;
+            sum_wxx += w * x * x;
+            sum_wxy += w * x * y;
+        }
+        const double denominator = sum_w * sum_wxx - sum_wx * sum_wx;
+        if (sum_w > 0.0 && denominator > 0.0) {
+            result.exponent = (sum_w * sum_wxy - sum_wx * sum_wy) / denominator;
+            result.coefficient =
+                std::exp((sum_wy - result.exponent * sum_wx) / sum_w);
+        }
+    } else {
+        double numerator = 0.0;
+        double denominator = 0.0;
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            const double f = calc_model_function(model, sizes[i]);
+            numerator += weights[i] * f * times[i];
+            denominator += weights[i] * f * f;
+        }
+        if (denominator > 0.0) {
+            result.coefficient = numerator / denominator;
+        }
+        switch (model) {
+        case ComplexityModel::linear:
+        case ComplexityModel::linearithmic:
+            result.exponent = 1.0;
+            break;
+        case ComplexityModel::quadratic:
+            result.exponent = 2.0;
+            break;
+        default:
+            result.exponent = 0.0;
+            break;
+        }
+    }
+
+    result.r_squared = calc_r_squared(
+        calc_residual_sum(result, sizes, times, weights), times, weights);
+    return result;
+}
+
+auto fit_complexity(const std::vector<double>& sizes,
+    const std::vector<double>& times, const std::vector<double>& errors)
+    -> std::optional<ComplexityFitResult> {
+    std::vector<double> valid_sizes;
+    std::vector<double> valid_times;
+    std::vector<double> valid_errors;
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+        if (sizes[i] > 0.0 && std::isfinite(sizes[i]) &&
+            std::isfinite(times[i])) {
+            valid_sizes.push_back(sizes[i]);
+            valid_times.push_back(times[i]);
+            valid_errors.push_back(errors[i]);
+        }
+    }
+    if (valid_sizes.size() < min_points) {
+        return std::nullopt;
+    }
+    const auto weights = calc_weights(valid_times, valid_errors);
+    const auto num_points = static_cast<double>(valid_sizes.size());
+
+    std::optional<ComplexityFitResult> best;
+    double best_criterion = std::numeric_limits<double>::infinity();
+    for (const auto model :
+        {ComplexityModel::constant, ComplexityModel::logarithmic,
+            ComplexityModel::linear, ComplexityModel::linearithmic,
+            ComplexityModel::quadratic, ComplexityModel::power}) {
+        const auto result = fit_complexity_model(
+            model, valid_sizes, valid_times, valid_errors);
+        const double num_model_params =
+            model == ComplexityModel::power ? 2.0 : 1.0;
+        const double residual_sum = std::max(
+            calc_residual_sum(result, valid_sizes, valid_times, weights),
+            std::numeric_limits<double>::min());
+        const double criterion = num_points *
+                std::log(residual_sum / num_points) +
+            2.0 * num_model_params;
+        if (criterion < best_criterion) {
+            best_criterion = criterion;
+            best = result;
+        }
+    }
+    return best;
+}
+
+}  // namespace stat_bench::stat
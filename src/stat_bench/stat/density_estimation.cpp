@@ -0,0 +1,243 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to estimate probability density.
+ */
+#include "stat_bench/stat/density_estimation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace stat_bench::stat {
+
+namespace {
+
+/*!
+ * \brief Transform values for estimation.
+ *
+ * \param[in] sorted_values Sorted values.
+ * \param[in] log_scale Whether to use the log scale.
+ * \return Transformed values in ascending order. (Only finite values.)
+ */
+[[nodiscard]] auto transform_values(
+    const std::vector<double>& sorted_values, bool log_scale)
+    -> std::vector<double> {
+    std::vector<double> values;
+    values.reserve(sorted_values.size());
+    for (const double value : sorted_values) {
+        if (log_scale) {
+            if (value > 0.0 && std::isfinite(value)) {
+                values.push_back(std::log10(value));
+            }
+        } else if (std::isfinite(value)) {
+            values.push_back(value);
+        }
+    }
+    return values;
+}
+
+/*!
+ * \brief Transform a value back to the original scale.
+ *
+ * \param[in] value Transformed value.
+ * \param[in] log_scale Whether to use the log scale.
+ * \return Value in the original scale.
+ */
+[[nodiscard]] auto restore_value(double value, bool log_scale) -> double {
+    if (log_scale) {
+        constexpr double base = 10.0;
+        return std::pow(base, value);
+    }
+    return value;
+}
+
+/*!
+ * \brief Calculate a width used when values don't have spread.
+ *
+ * \param[in] value Value.
+ * \return Width.
+ */
+[[nodiscard]] auto calc_fallback_width(double value) -> double {
+    constexpr double relative_width = 1e-3;
+    constexpr double min_width = 1e-12;
+    return std::max(std::abs(value) * relative_width, min_width);
+}
+
+/*!
+ * \brief Calculate a quantile of sorted values with linear interpolation.
+ *
+ * \param[in] sorted_values Sorted values.
+ * \param[in] probability Probability.
+ * \return Quantile.
+ */
+[[nodiscard]] auto calc_quantile(
+    const std::vector<double>& sorted_values, double probability) -> double {
+    const double position =
+        probability * static_cast<double>(sorted_values.size() - 1);
+    const auto lower = static_cast<std::size_t>(std::floor(position));
+    const std::size_t upper = std::min(lower + 1, sorted_values.size() - 1);
+    const double rate = position - static_cast<double>(lower);
+    return sorted_values[lower] +
+        rate * (sorted_values[upper] - sorted_values[lower]);
+}
+
+}  // namespace
+
+auto calc_silverman_bandwidth(const std::vector<double>& sorted_values)
+    -> double {
+    const std::size_t num_values = sorted_values.size();
+    if (num_values < 2) {
+        return 0.0;
+    }
+
+    double mean = 0.0;
+    for (const double value : sorted_values) {
+        mean += value;
+    }
+    mean /= static_cast<double>(num_values);
+    double variance = 0.0;
+    for (const double value : sorted_values) {
+        variance += (value - mean) * (value - mean);
+    }
+    variance /= static_cast<double>(num_values - 1);
+    const double standard_deviation = std::sqrt(variance);
+
+    constexpr double first_quartile = 0.25;
+    constexpr double third_quartile = 0.75;
+    // Ratio of IQR to the standard deviation in normal distributions.
+    constexpr double iqr_to_standard_deviation = 1.34;
+    const double iqr = calc_quantile(sorted_values, third_quartile) -
+        calc_quantile(sorted_values, first_quartile);
+    double spread =
+        std::min(standard_deviation, iqr / iqr_to_standard_deviation);
+    if (spread <= 0.0) {
+        spread = standard_deviation;
+    }
+
+    constexpr double coeff = 0.9;
+    constexpr double exponent = -0.2;
+    return coeff * spread *
+        std::pow(static_cast<double>(num_values), exponent);
+}
+
+auto estimate_density(const std::vector<double>& sorted_values,
+    std::size_t num_points, bool log_scale) -> DensityCurve {
+    const std::vector<double> values =
+        transform_values(sorted_values, log_scale);
+    if (values.empty() || num_points < 2) {
+        return DensityCurve{};
+    }
+
+    double bandwidth = calc_silverman_bandwidth(values);
+    if (!(bandwidth > 0.0)) {
+        bandwidth = calc_fallback_width(values.front());
+    }
+
+    // Grid points cover tails of kernels at both ends.
+    constexpr double tail_in_bandwidth = 3.0;
+    const double grid_begin = values.front() - tail_in_bandwidth * bandwidth;
+    const double grid_end = values.back() + tail_in_bandwidth * bandwidth;
+    const double grid_step =
+        (grid_end - grid_begin) / static_cast<double>(num_points - 1);
+
+    // Linear binning.
+    std::vector<double> weights(num_points, 0.0);
+    for (const double value : values) {
+        const double position = (value - grid_begin) / grid_step;
+        const auto lower = std::min(
+            static_cast<std::size_t>(std::floor(position)), num_points - 2);
+        const double rate = position - static_cast<double>(lower);
+        weights[lower] += 1.0 - rate;
+        weights[lower + 1] += rate;
+    }
+
+    // Kernels are truncated where they are negligible.
+    constexpr double kernel_radius_in_bandwidth = 4.0;
+    const auto kernel_radius = std::min(
+        static_cast<std::size_t>(std::ceil(
+            kernel_radius_in_bandwidth * bandwidth / grid_step)),
+        num_points - 1);
+    std::vector<double> kernel(kernel_radius + 1);
+    constexpr double sqrt_two_pi = 2.5066282746310002;
+    const double normalizer =
+        1.0 / (static_cast<double>(values.size()) * bandwidth * sqrt_two_pi);
+    for (std::size_t i = 0; i <= kernel_radius; ++i) {
+        const double distance = static_cast<double>(i) * grid_step / bandwidth;
+        kernel[i] = normalizer * std::exp(-0.5 * distance * distance);
+    }
+
+    DensityCurve curve;
+    curve.points.reserve(num_points);
+    curve.densities.reserve(num_points);
+    for (std::size_t i = 0; i < num_points; ++i) {
+        const std::size_t begin = i > kernel_radius ? i - kernel_radius : 0;
+        const std::size_t end = std::min(i + kernel_radius + 1, num_points);
+        double density = 0.0;
+        for (std::size_t j = begin; j < end; ++j) {
+            density += weights[j] * kernel[i > j ? i - j : j - i];
+        }
+        curve.points.push_back(restore_value(
+            grid_begin + static_cast<double>(i) * grid_step, log_scale));
+        curve.densities.push_back(density);
+    }
+    return curve;
+}
+
+auto calc_histogram(const std::vector<double>& sorted_values,
+    std::size_t num_bins, bool log_scale) -> Histogram {
+    const std::vector<double> values =
+        transform_values(sorted_values, log_scale);
+    if (values.empty() || num_bins == 0) {
+        return Histogram{};
+    }
+
+    double range_begin = values.front();
+    double range_end = values.back();
+    if (!(range_end > range_begin)) {
+        const double half_width = 0.5 * calc_fallback_width(range_begin);
+        range_begin -= half_width;
+        range_end += half_width;
+    }
+    const double bin_width =
+        (range_end - range_begin) / static_cast<double>(num_bins);
+
+    std::vector<std::size_t> counts(num_bins, 0);
+    for (const double value : values) {
+        const auto bin = std::min(
+            static_cast<std::size_t>((value - range_begin) / bin_width),
+            num_bins - 1);
+        ++counts[bin];
+    }
+
+    Histogram histogram;
+    histogram.edges.reserve(num_bins + 1);
+    for (std::size_t i = 0; i <= num_bins; ++i) {
+        histogram.edges.push_back(restore_value(
+            range_begin + static_cast<double>(i) * bin_width, log_scale));
+    }
+    histogram.densities.reserve(num_bins);
+    const double normalizer =
+        1.0 / (static_cast<double>(values.size()) * bin_width);
+    for (const std::size_t count : counts) {
+        histogram.densities.push_back(static_cast<double>(count) * normalizer);
+    }
+    return histogram;
+}
+
+}  // namespace stat_bench::stat
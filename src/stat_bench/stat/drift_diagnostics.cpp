@@ -0,0 +1,208 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to diagnose drifts of samples.
+ */
+#include "stat_bench/stat/drift_diagnostics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::stat {
+
+namespace {
+
+/*!
+ * \brief Calculate the lag-1 autocorrelation.
+ *
+ * \param[in] values Values in the order of time.
+ * \return Autocorrelation.
+ */
+[[nodiscard]] auto calc_lag1_autocorrelation(const std::vector<double>& values)
+    -> double {
+    double mean = 0.0;
+    for (const double value : values) {
+        mean += value;
+    }
+    mean /= static_cast<double>(values.size());
+
+    double numerator = 0.0;
+    double denominator = 0.0;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const double deviation = values[i] - mean;
+        denominator += deviation * deviation;
+        if (i + 1U < values.size()) {
+            numerator += deviation * (values[i + 1U] - mean);
+        }
+    }
+    if (denominator <= 0.0) {
+        return 0.0;
+    }
+    return numerator / denominator;
+}
+
+/*!
+ * \brief Sort values counting inversions using merge sort.
+ *
+ * \param[in,out] values Values. (Sorted in this function.)
+ * \return Number of pairs of indices i < j with values[i] > values[j].
+ */
+[[nodiscard]] auto sort_counting_inversions(std::vector<double>& values)
+    -> std::uint64_t {
+    std::uint64_t inversions = 0;
+    std::vector<double> buffer(values.size());
+    for (std::size_t width = 1; width < values.size(); width *= 2U) {
+        for (std::size_t begin = 0; begin < values.size();
+             begin += 2U * width) {
+            const std::size_t middle = std::min(begin + width, values.size());
+            const std::size_t end = std::min(middle + width, values.size());
+            std::size_t left = begin;
+            std::size_t right = middle;
+            std::size_t out = begin;
+            while (left < middle && right < end) {
+                // Equal values are taken from the left not to count ties.
+                if (values[right] < values[left]) {
+                    inversions += middle - left;
+                    buffer[out++] = values[right++];
+                } else {
+                    buffer[out++] = values[left++];
+                }
+            }
+            while (left < middle) {
+                buffer[out++] = values[left++];
+            }
+            while (right < end) {
+                buffer[out++] = values[right++];
+            }
+        }
+        values.swap(buffer);
+    }
+    return inversions;
+}
+
+/*!
+ * \brief Calculate the standardized statistic of Mann-Kendall trend test.
+ *
+ * The statistic S is calculated in O(n log n) time from the number of
+ * inversions, because S is the number of increasing pairs minus the number
+ * of decreasing pairs.
+ *
+ * \param[in] values Values in the order of time.
+ * \return Statistic.
+ */
+[[nodiscard]] auto calc_mann_kendall_z(const std::vector<double>& values)
+    -> double {
+    std::vector<double> sorted = values;
+    const auto decreasing_pairs =
+        static_cast<double>(sort_counting_inversions(sorted));
+
+    // Variance with correction of ties.
+    const auto n = static_cast<double>(values.size());
+    double variance = n * (n - 1.0) * (2.0 * n + 5.0);  // NOLINT
+    double tied_pairs = 0.0;
+    for (std::size_t begin = 0; begin < sorted.size();) {
+        std::size_t end = begin + 1U;
+        while (end < sorted.size() && sorted[end] == sorted[begin]) {
+            ++end;
+        }
+        const auto ties = static_cast<double>(end - begin);
+        variance -= ties * (ties - 1.0) * (2.0 * ties + 5.0);  // NOLINT
+        tied_pairs += 0.5 * ties * (ties - 1.0);               // NOLINT
+        begin = end;
+    }
+    const double increasing_pairs =
+        0.5 * n * (n - 1.0) - tied_pairs - decreasing_pairs;  // NOLINT
+    const double s = increasing_pairs - decreasing_pairs;
+    variance /= 18.0;  // NOLINT
+    if (variance <= 0.0) {
+        return 0.0;
+    }
+
+    // Continuity correction.
+    if (s > 0.0) {
+        return (s - 1.0) / std::sqrt(variance);
+    }
+    if (s < 0.0) {
+        return (s + 1.0) / std::sqrt(variance);
+    }
+    return 0.0;
+}
+
+}  // namespace
+
+auto diagnose_drift(const std::vector<std::vector<clock::Duration>>& durations,
+    double significance_level) -> DriftDiagnostics {
+    if (durations.empty() || durations.at(0).empty()) {
+        throw StatBenchException("No duration sample for diagnostics.");
+    }
+    const std::size_t samples = durations.front().size();
+    std::vector<double> series(samples, 0.0);
+    std::size_t num_durations = 0;
+    for (const auto& thread_durations : durations) {
+        for (std::size_t i = 0; i < samples; ++i) {
+            series[i] += thread_durations.at(i).seconds();
+        }
+        num_durations += thread_durations.size();
+    }
+
+    DriftDiagnostics result;
+    result.effective_sample_size = static_cast<double>(num_durations);
+    constexpr std::size_t min_samples = 3;
+    if (samples < min_samples) {
+        return result;
+    }
+
+    result.lag1_autocorrelation = calc_lag1_autocorrelation(series);
+    if (result.lag1_autocorrelation > 0.0) {
+        result.effective_sample_size = std::max(
+            result.effective_sample_size *
+                (1.0 - result.lag1_autocorrelation) /
+                (1.0 + result.lag1_autocorrelation),
+            1.0);
+    }
+
+    result.mann_kendall_z = calc_mann_kendall_z(series);
+    result.mann_kendall_p_value =
+        std::erfc(std::abs(result.mann_kendall_z) / std::sqrt(2.0));
+    result.drifting = result.mann_kendall_p_value < significance_level;
+    return result;
+}
+
+auto adjust_standard_error(const Statistics& stat,
+    const DriftDiagnostics& diagnostics) -> Statistics {
+    const auto num_samples =
+        static_cast<double>(stat.unsorted_samples().size());
+    if (diagnostics.effective_sample_size <= 0.0 ||
+        diagnostics.effective_sample_size >= num_samples) {
+        return stat;
+    }
+    const double standard_error = stat.standard_error() *
+        std::sqrt(num_samples / diagnostics.effective_sample_size);
+    std::vector<double> unsorted_samples = stat.unsorted_samples();
+    std::vector<double> sorted_samples = stat.sorted_samples();
+    return Statistics(std::move(unsorted_samples), std::move(sorted_samples),
+        stat.mean(), stat.max(), stat.min(), stat.median(), stat.variance(),
+        stat.standard_deviation(), standard_error);
+}
+
+}  // namespace stat_bench::stat
@@ -0,0 +1,298 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions of linear regression.
+ */
+#include "stat_bench/stat/linear_regression.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::stat {
+
+namespace {
+
+//! Quantile of the standard normal distribution for 95% intervals.
+constexpr double normal_quantile_975 = 1.959963984540054;
+
+/*!
+ * \brief Check inputs of linear regression.
+ *
+ * \param[in] x Values of the explanatory variable.
+ * \param[in] y Values of the response variable.
+ */
+void check_inputs(const std::vector<double>& x, const std::vector<double>& y) {
+    if (x.size() != y.size()) {
+        throw StatBenchException(
+            "Sizes of vectors for linear regression must be same.");
+    }
+    if (x.size() < 2U) {
+        throw StatBenchException(
+            "Linear regression requires at least two points.");
+    }
+}
+
+/*!
+ * \brief 97.5% quantiles of Student's t-distribution for 1 to 30 degrees of
+ * freedom.
+ */
+constexpr std::array<double, 30> small_t_quantiles_975{12.706204736174698,
+    4.302652729749464, 3.182446305284263, 2.776445105197793,
+    2.570581835636314, 2.446911851144969, 2.364624251592785,
+    2.306004135204166, 2.262157162798205, 2.228138851986274,
+    2.200985160091640, 2.178812829667226, 2.160368656462793,
+    2.144786687917803, 2.131449545559764, 2.119905299221255,
+    2.109815577833316, 2.100922040241039, 2.093024054408309,
+    2.085963447265837, 2.079613844727662, 2.073873067904015,
+    2.068657610419048, 2.063898561628026, 2.059538552753297,
+    2.055529438642871, 2.051830516480284, 2.048407141795244,
+    2.045229642132703, 2.042272456301238};
+
+/*!
+ * \brief Calculate the 97.5% quantile of Student's t-distribution.
+ *
+ * Quantiles for 30 or less degrees of freedom are taken from a table, and
+ * others are calculated using Cornish-Fisher expansion, whose error is less
+ * than 1e-5 there.
+ *
+ * \param[in] degrees_of_freedom Degrees of freedom. (Integer.)
+ * \return Quantile.
+ */
+[[nodiscard]] auto t_quantile_975(double degrees_of_freedom) -> double {
+    if (degrees_of_freedom <=
+        static_cast<double>(small_t_quantiles_975.size())) {
+        const auto index =
+            static_cast<std::size_t>(std::max(degrees_of_freedom, 1.0)) - 1U;
+        return small_t_quantiles_975[index];
+    }
+    const double z = normal_quantile_975;
+    const double z2 = z * z;
+    const double nu = degrees_of_freedom;
+    // NOLINTBEGIN(readability-magic-numbers)
+    return z + z * (z2 + 1.0) / (4.0 * nu) +
+        z * ((5.0 * z2 + 16.0) * z2 + 3.0) / (96.0 * nu * nu) +
+        z * (((3.0 * z2 + 19.0) * z2 + 17.0) * z2 - 15.0) /
+        (384.0 * nu * nu * nu);
+    // NOLINTEND(readability-magic-numbers)
+}
+
+/*!
+ * \brief Calculate the median of values.
+ *
+ * \param[in] values Values. (Reordered in this function.)
+ * \return Median.
+ */
+[[nodiscard]] auto calc_median(std::vector<double>& values) -> double {
+    const std::size_t middle = values.size() / 2U;
+    std::nth_element(values.begin(),
+        values.begin() + static_cast<std::ptrdiff_t>(middle), values.end());
+    const double upper = values[middle];
+    if (values.size() % 2U == 1U) {
+        return upper;
+    }
+    const double lower = *std::max_element(
+        values.begin(), values.begin() + static_cast<std::ptrdiff_t>(middle));
+    return 0.5 * (lower + upper);  // NOLINT
+}
+
+/*!
+ * \brief Calculate slopes between pairs of points.
+ *
+ * All pairs are used when their number is at most max_theil_sen_pairs, and
+ * max_theil_sen_pairs pairs are sampled randomly with a fixed seed otherwise.
+ * Pairs with the same x are skipped.
+ *
+ * \param[in] x Values of the explanatory variable.
+ * \param[in] y Values of the response variable.
+ * \return Slopes.
+ */
+[[nodiscard]] auto calc_pairwise_slopes(
+    const std::vector<double>& x, const std::vector<double>& y)
+    -> std::vector<double> {
+    const std::size_t size = x.size();
+    std::vector<double> slopes;
+    if (size - 1U <= 2U * max_theil_sen_pairs / size) {
+        slopes.reserve(size * (size - 1U) / 2U);
+        for (std::size_t i = 0; i < size; ++i) {
+            for (std::size_t j = i + 1U; j < size; ++j) {
+                if (x[i] != x[j]) {
+                    slopes.push_back((y[j] - y[i]) / (x[j] - x[i]));
+                }
+            }
+        }
+        return slopes;
+    }
+
+    const auto [min_x, max_x] = std::minmax_element(x.begin(), x.end());
+    if (*min_x == *max_x) {
+        return slopes;
+    }
+
+    // Indices are drawn by multiplication and shift of 32-bit random numbers,
+    // whose bias is negligible for numbers of points much less than 2^32.
+    // The default seed is used for reproducible results.
+    std::mt19937 engine;  // NOLINT
+    const auto draw_index = [&engine, size] {
+        return static_cast<std::size_t>(
+            (static_cast<std::uint64_t>(static_cast<std::uint32_t>(engine())) *
+                static_cast<std::uint64_t>(size)) >>
+            32U);  // NOLINT
+    };
+    slopes.reserve(max_theil_sen_pairs);
+    while (slopes.size() < max_theil_sen_pairs) {
+        const std::size_t i = draw_index();
+        const std::size_t j = draw_index();
+        if (x[i] != x[j]) {
+            slopes.push_back((y[j] - y[i]) / (x[j] - x[i]));
+        }
+    }
+    return slopes;
+}
+
+/*!
+ * \brief Calculate the coefficient of determination of a line.
+ *
+ * \param[in] result Result of fitting.
+ * \param[in] x Values of the explanatory variable.
+ * \param[in] y Values of the response variable.
+ * \return Coefficient of determination.
+ */
+[[nodiscard]] auto calc_r_squared(const LinearRegressionResult& result,
+    const std::vector<double>& x, const std::vector<double>& y) -> double {
+    double mean = 0.0;
+    for (const double value : y) {
+        mean += value;
+    }
+    mean /= static_cast<double>(y.size());
+    double residual_sum = 0.0;
+    double total_sum = 0.0;
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        const double residual = y[i] - (result.slope * x[i] + result.intercept);
+        residual_sum += residual * residual;
+        total_sum += (y[i] - mean) * (y[i] - mean);
+    }
+    if (total_sum <= 0.0) {
+        return residual_sum <= 0.0 ? 1.0 : 0.0;
+    }
+    return 1.0 - residual_sum / total_sum;
+}
+
+}  // namespace
+
+auto fit_ordinary_least_squares(const std::vector<double>& x,
+    const std::vector<double>& y) -> LinearRegressionResult {
+    check_inputs(x, y);
+    const auto n = static_cast<double>(x.size());
+    double mean_x = 0.0;
+    double mean_y = 0.0;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        mean_x += x[i];
+        mean_y += y[i];
+    }
+    mean_x /= n;
+    mean_y /= n;
+    double sum_xx = 0.0;
+    double sum_xy = 0.0;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        sum_xx += (x[i] - mean_x) * (x[i] - mean_x);
+        sum_xy += (x[i] - mean_x) * (y[i] - mean_y);
+    }
+    if (sum_xx <= 0.0) {
+        throw StatBenchException(
+            "Linear regression requires at least two different values of x.");
+    }
+
+    LinearRegressionResult result;
+    result.slope = sum_xy / sum_xx;
+    result.intercept = mean_y - result.slope * mean_x;
+    result.r_squared = calc_r_squared(result, x, y);
+
+    if (x.size() > 2U) {
+        double residual_sum = 0.0;
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            const double residual =
+                y[i] - (result.slope * x[i] + result.intercept);
+            residual_sum += residual * residual;
+        }
+        const double degrees_of_freedom = n - 2.0;
+        const double slope_error =
+            std::sqrt(residual_sum / degrees_of_freedom / sum_xx);
+        const double half_width =
+            t_quantile_975(degrees_of_freedom) * slope_error;
+        result.slope_lower = result.slope - half_width;
+        result.slope_upper = result.slope + half_width;
+    } else {
+        result.slope_lower = result.slope;
+        result.slope_upper = result.slope;
+    }
+    return result;
+}
+
+auto fit_theil_sen(const std::vector<double>& x, const std::vector<double>& y)
+    -> LinearRegressionResult {
+    check_inputs(x, y);
+
+    const auto n = static_cast<double>(x.size());
+    const double num_pairs = 0.5 * n * (n - 1.0);  // NOLINT
+    std::vector<double> slopes = calc_pairwise_slopes(x, y);
+    if (slopes.empty()) {
+        throw StatBenchException(
+            "Linear regression requires at least two different values of x.");
+    }
+
+    LinearRegressionResult result;
+    result.slope = calc_median(slopes);
+    std::vector<double> intercepts;
+    intercepts.reserve(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        intercepts.push_back(y[i] - result.slope * x[i]);
+    }
+    result.intercept = calc_median(intercepts);
+    result.r_squared = calc_r_squared(result, x, y);
+
+    // Sen's confidence interval using the variance of Kendall's S without
+    // correction of ties. Bounds are the slopes at the one-based ranks
+    // (N - C) / 2 and (N + C) / 2 + 1 in ascending order.
+    // When pairs are sampled, C is scaled to the number of sampled pairs.
+    std::sort(slopes.begin(), slopes.end());
+    const auto num_slopes = static_cast<double>(slopes.size());
+    const double width = normal_quantile_975 *
+        std::sqrt(n * (n - 1.0) * (2.0 * n + 5.0) / 18.0) *  // NOLINT
+        std::min(1.0, num_slopes / num_pairs);
+    const double lower_rank = std::floor(0.5 * (num_slopes - width));  // NOLINT
+    const double upper_rank =
+        std::ceil(0.5 * (num_slopes + width)) + 1.0;  // NOLINT
+    const auto clamp_index = [&slopes](double rank) {
+        if (rank < 1.0) {
+            return static_cast<std::size_t>(0);
+        }
+        return std::min(
+            static_cast<std::size_t>(rank) - 1U, slopes.size() - 1U);
+    };
+    result.slope_lower = slopes[clamp_index(lower_rank)];
+    result.slope_upper = slopes[clamp_index(upper_rank)];
+    return result;
+}
+
+}  // namespace stat_bench::stat
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to fit models of scalability with respect to
+ * the number of threads.
+ */
+#include "stat_bench/stat/scalability_fit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::stat {
+
+namespace {
+
+/*!
+ * \brief Check inputs of fitting.
+ *
+ * \param[in] nums_threads Numbers of threads.
+ * \param[in] speedups Speedups relative to one thread.
+ */
+void check_inputs(const std::vector<double>& nums_threads,
+    const std::vector<double>& speedups) {
+    if (nums_threads.size() != speedups.size()) {
+        throw StatBenchException(
+            "Sizes of vectors to fit models of scalability must be same.");
+    }
+    for (std::size_t i = 0; i < nums_threads.size(); ++i) {
+        if (!(nums_threads[i] >= 1.0) || !(speedups[i] > 0.0)) {
+            throw StatBenchException(
+                "Numbers of threads and speedups to fit models of scalability "
+                "must be positive.");
+        }
+    }
+}
+
+/*!
+ * \brief Calculate the coefficient of determination of speedups.
+ *
+ * \param[in] result Result of fitting.
+ * \param[in] nums_threads Numbers of threads.
+ * \param[in] speedups Speedups relative to one thread.
+ * \return Coefficient of determination.
+ */
+[[nodiscard]] auto calc_r_squared(const ScalabilityFitResult& result,
+    const std::vector<double>& nums_threads,
+    const std::vector<double>& speedups) -> double {
+    if (speedups.empty()) {
+        return 0.0;
+    }
+    double mean = 0.0;
+    for (const double speedup : speedups) {
+        mean += speedup;
+    }
+    mean /= static_cast<double>(speedups.size());
+    double residual_sum = 0.0;
+    double total_sum = 0.0;
+    for (std::size_t i = 0; i < speedups.size(); ++i) {
+        const double residual = speedups[i] -
+            evaluate_scalability_model(result, nums_threads[i]);
+        residual_sum += residual * residual;
+        total_sum += (speedups[i] - mean) * (speedups[i] - mean);
+    }
+    if (total_sum <= 0.0) {
+        return residual_sum <= 0.0 ? 1.0 : 0.0;
+    }
+    return 1.0 - residual_sum / total_sum;
+}
+
+/*!
+ * \brief Fit a coefficient of a single term of the linearized USL using least
+ * squares without the intercept.
+ *
+ * \param[in] nums_threads Numbers of threads.
+ * \param[in] speedups Speedups relative to one thread.
+ * \param[in] use_coherency Whether to fit the coherency coefficient instead
+ * of the contention coefficient.
+ * \return Coefficient. (Non-negative.)
+ */
+[[nodiscard]] auto fit_single_coefficient(
+    const std::vector<double>& nums_threads,
+    const std::vector<double>& speedups, bool use_coherency) -> double {
+    double numerator = 0.0;
+    double denominator = 0.0;
+    for (std::size_t i = 0; i < nums_threads.size(); ++i) {
+        const double n = nums_threads[i];
+        const double x = use_coherency ? n * (n - 1.0) : n - 1.0;
+        const double y = n / speedups[i] - 1.0;
+        numerator += x * y;
+        denominator += x * x;
+    }
+    if (denominator <= 0.0) {
+        return 0.0;
+    }
+    return std::max(numerator / denominator, 0.0);
+}
+
+}  // namespace
+
+auto evaluate_scalability_model(
+    const ScalabilityFitResult& result, double num_threads) -> double {
+    return num_threads /
+        (1.0 + result.contention * (num_threads - 1.0) +
+            result.coherency * num_threads * (num_threads - 1.0));
+}
+
+auto calc_peak_num_threads(const ScalabilityFitResult& result) -> double {
+    if (result.coherency <= 0.0) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return std::sqrt(std::max(1.0 - result.contention, 0.0) / result.coherency);
+}
+
+auto fit_amdahl(const std::vector<double>& nums_threads,
+    const std::vector<double>& speedups) -> ScalabilityFitResult {
+    check_inputs(nums_threads, speedups);
+    ScalabilityFitResult result;
+    result.contention = fit_single_coefficient(nums_threads, speedups, false);
+    result.r_squared = calc_r_squared(result, nums_threads, speedups);
+    return result;
+}
+
+auto fit_usl(const std::vector<double>& nums_threads,
+    const std::vector<double>& speedups) -> ScalabilityFitResult {
+    check_inputs(nums_threads, speedups);
+
+    // Normal equations of y = sigma * x1 + kappa * x2.
+    double sum_x1x1 = 0.0;
+    double sum_x1x2 = 0.0;
+    double sum_x2x2 = 0.0;
+    double sum_x1y = 0.0;
+    double sum_x2y = 0.0;
+    for (std::size_t i = 0; i < nums_threads.size(); ++i) {
+        const double n = nums_threads[i];
+        const double x1 = n - 1.0;
+        const double x2 = n * (n - 1.0);
+        const double y = n / speedups[i] - 1.0;
+        sum_x1x1 += x1 * x1;
+        sum_x1x2 += x1 * x2;
+        sum_x2x2 += x2 * x2;
+        sum_x1y += x1 * y;
+        sum_x2y += x2 * y;
+    }
+    const double determinant = sum_x1x1 * sum_x2x2 - sum_x1x2 * sum_x1x2;
+
+    ScalabilityFitResult result;
+    // Determinants are relatively small when fewer than two numbers of
+    // threads other than one are given.
+    constexpr double relative_tolerance = 1e-10;
+    if (determinant > relative_tolerance * sum_x1x1 * sum_x2x2) {
+        result.contention =
+            (sum_x2x2 * sum_x1y - sum_x1x2 * sum_x2y) / determinant;
+        result.coherency =
+            (sum_x1x1 * sum_x2y - sum_x1x2 * sum_x1y) / determinant;
+    }
+    if (!(determinant > relative_tolerance * sum_x1x1 * sum_x2x2) ||
+        result.contention < 0.0 || result.coherency < 0.0) {
+        // Use the best fit on the boundary of the constraints.
+        ScalabilityFitResult contention_only;
+        contention_only.contention =
+            fit_single_coefficient(nums_threads, speedups, false);
+        ScalabilityFitResult coherency_only;
+        coherency_only.coherency =
+            fit_single_coefficient(nums_threads, speedups, true);
+        if (calc_r_squared(contention_only, nums_threads, speedups) >=
+            calc_r_squared(coherency_only, nums_threads, speedups)) {
+            result = contention_only;
+        } else {
+            result = coherency_only;
+        }
+    }
+    result.r_squared = calc_r_squared(result, nums_threads, speedups);
+    return result;
+}
+
+}  // namespace stat_bench::stat
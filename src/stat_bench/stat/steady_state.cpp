@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to detect steady states.
+ */
+#include "stat_bench/stat/steady_state.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::stat {
+
+auto detect_steady_state(const std::vector<double>& values,
+    std::size_t batch_size) -> std::optional<std::size_t> {
+    if (batch_size == 0U) {
+        throw StatBenchException("Size of batches must be at least one.");
+    }
+
+    // The last incomplete batch is ignored.
+    const std::size_t num_batches = values.size() / batch_size;
+    constexpr std::size_t min_batches = 4;
+    if (num_batches < min_batches) {
+        return std::nullopt;
+    }
+    std::vector<double> batch_means;
+    batch_means.reserve(num_batches);
+    for (std::size_t i = 0; i < num_batches; ++i) {
+        double sum = 0.0;
+        for (std::size_t j = i * batch_size; j < (i + 1U) * batch_size; ++j) {
+            sum += values[j];
+        }
+        batch_means.push_back(sum / static_cast<double>(batch_size));
+    }
+
+    // Statistics of the remaining batches are calculated from the end using
+    // mean and sum of squared deviations updated by Welford's method.
+    std::vector<double> statistics(num_batches, 0.0);
+    double mean = 0.0;
+    double squared_deviations = 0.0;
+    for (std::size_t i = num_batches; i > 0U; --i) {
+        const double value = batch_means[i - 1U];
+        const auto count = static_cast<double>(num_batches - i + 1U);
+        const double delta = value - mean;
+        mean += delta / count;
+        squared_deviations += delta * (value - mean);
+        statistics[i - 1U] = squared_deviations / (count * count);
+    }
+
+    // At least two batches must remain.
+    const auto candidates_end =
+        statistics.begin() + static_cast<std::ptrdiff_t>(num_batches - 1U);
+    const auto min_iter = std::min_element(statistics.begin(), candidates_end);
+    const auto truncated_batches =
+        static_cast<std::size_t>(min_iter - statistics.begin());
+    if (2U * truncated_batches >= num_batches) {
+        return std::nullopt;
+    }
+    return truncated_batches * batch_size;
+}
+
+}  // namespace stat_bench::stat
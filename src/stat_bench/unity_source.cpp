@@ -13,41 +13,71 @@
 #include "filters/glob_filter.cpp"        // NOLINT(bugprone-suspicious-include)
 #include "filters/regex_filter.cpp"       // NOLINT(bugprone-suspicious-include)
 #include "measurement_config.cpp"         // NOLINT(bugprone-suspicious-include)
+#include "measurer/analyze_thread_scaling.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "measurer/determine_iterations.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "measurer/determine_steady_state_warming_up_samples.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "measurer/determine_warming_up_samples.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "measurer/fit_complexity_by_case.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "measurer/fit_iteration_regression.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "measurer/generate_default_measurement_configs.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "measurer/measure_once.cpp"      // NOLINT(bugprone-suspicious-include)
 #include "measurer/measurement_type.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "measurer/measurer.cpp"          // NOLINT(bugprone-suspicious-include)
+#include "param/adaptive_refinement.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "param/auto_num_threads.cpp"     // NOLINT(bugprone-suspicious-include)
 #include "param/parameter_dict.cpp"       // NOLINT(bugprone-suspicious-include)
 #include "param/parameter_generator.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "param/parameter_name.cpp"       // NOLINT(bugprone-suspicious-include)
+#include "param/parameter_sampling.cpp"   // NOLINT(bugprone-suspicious-include)
 #include "plot_options.cpp"               // NOLINT(bugprone-suspicious-include)
 #include "plots/box_plot.cpp"             // NOLINT(bugprone-suspicious-include)
 #include "plots/cdf_line_plot.cpp"        // NOLINT(bugprone-suspicious-include)
 #include "plots/create_data_table.cpp"    // NOLINT(bugprone-suspicious-include)
+#include "plots/decimate_samples.cpp"     // NOLINT(bugprone-suspicious-include)
+#include "plots/density_plot.cpp"         // NOLINT(bugprone-suspicious-include)
+#include "plots/histogram_plot.cpp"       // NOLINT(bugprone-suspicious-include)
+#include "plots/iteration_regression_plot.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plots/parameter_to_output_line_plot.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plots/parameter_to_time_box_plot.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plots/parameter_to_time_line_plot.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plots/parameter_to_time_violin_plot.cpp"  // NOLINT(bugprone-suspicious-include)
-#include "plots/plot_utils.cpp"         // NOLINT(bugprone-suspicious-include)
-#include "plots/samples_line_plot.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plots/plot_utils.cpp"           // NOLINT(bugprone-suspicious-include)
+#include "plots/samples_line_plot.cpp"    // NOLINT(bugprone-suspicious-include)
+#include "plots/thread_scaling_plot.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plots/time_to_output_by_parameter_line_plot.cpp"  // NOLINT(bugprone-suspicious-include)
-#include "plots/violin_plot.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plots/violin_plot.cpp"        // NOLINT(bugprone-suspicious-include)
+#include "reporter/async_reporter.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "reporter/compressed_msgpack_reporter.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "reporter/console_reporter.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "reporter/data_file_helper.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "reporter/data_file_reader.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "reporter/data_file_reporter_base.cpp"  // NOLINT(bugprone-suspicious-include)
-#include "reporter/json_reporter.cpp"     // NOLINT(bugprone-suspicious-include)
+#include "reporter/json_reporter.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "reporter/json_stream_writer.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "reporter/msgpack_reporter.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "reporter/plot_reporter.cpp"     // NOLINT(bugprone-suspicious-include)
+#include "reporter/replay_measurements.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "runner/command_line_parser.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "runner/runner.cpp"              // NOLINT(bugprone-suspicious-include)
 #include "stat/calc_stat.cpp"             // NOLINT(bugprone-suspicious-include)
+#include "stat/complexity_fit.cpp"        // NOLINT(bugprone-suspicious-include)
+#include "stat/density_estimation.cpp"    // NOLINT(bugprone-suspicious-include)
+#include "stat/drift_diagnostics.cpp"     // NOLINT(bugprone-suspicious-include)
+#include "stat/linear_regression.cpp"     // NOLINT(bugprone-suspicious-include)
+#include "stat/scalability_fit.cpp"       // NOLINT(bugprone-suspicious-include)
+#include "stat/steady_state.cpp"          // NOLINT(bugprone-suspicious-include)
 #include "use_pointer.cpp"                // NOLINT(bugprone-suspicious-include)
+#include "util/aligned_buffer.cpp"        // NOLINT(bugprone-suspicious-include)
+#include "util/buffered_file_writer.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "util/cache_evictor.cpp"         // NOLINT(bugprone-suspicious-include)
+#include "util/cache_sizes.cpp"           // NOLINT(bugprone-suspicious-include)
 #include "util/check_glob_pattern.cpp"    // NOLINT(bugprone-suspicious-include)
+#include "util/cpu_topology.cpp"          // NOLINT(bugprone-suspicious-include)
 #include "util/escape_for_file_name.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "util/escape_for_html.cpp"       // NOLINT(bugprone-suspicious-include)
+#include "util/parallel_gzip_writer.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "util/prepare_directory.cpp"     // NOLINT(bugprone-suspicious-include)
 #include "util/sync_barrier.cpp"          // NOLINT(bugprone-suspicious-include)
+#include "util/thread_affinity.cpp"       // NOLINT(bugprone-suspicious-include)
 #include "util/utf8_string.cpp"           // NOLINT(bugprone-suspicious-include)
+#include "util/worker_pool.cpp"           // NOLINT(bugprone-suspicious-include)
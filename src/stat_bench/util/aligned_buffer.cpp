@@ -0,0 +1,221 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of AlignedBuffer class.
+ */
+#include "stat_bench/util/aligned_buffer.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <utility>
+
+#include "stat_bench/stat_bench_exception.h"
+
+#if defined(__linux__)
+// Linux
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace stat_bench::util {
+
+namespace {
+
+/*!
+ * \brief Round up a value to a multiple of a unit.
+ *
+ * \param[in] value Value.
+ * \param[in] unit Unit.
+ * \return Rounded value.
+ */
+[[nodiscard]] auto round_up(std::size_t value, std::size_t unit) noexcept
+    -> std::size_t {
+    return (value + unit - 1U) / unit * unit;
+}
+
+/*!
+ * \brief Align an address.
+ *
+ * \param[in] ptr Address.
+ * \param[in] alignment Alignment.
+ * \return Aligned address.
+ */
+[[nodiscard]] auto align_address(void* ptr, std::size_t alignment) noexcept
+    -> char* {
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);  // NOLINT
+    const auto aligned = round_up(address, alignment);
+    return static_cast<char*>(ptr) + (aligned - address);
+}
+
+#if defined(__linux__)
+/*!
+ * \brief Bind memory to a NUMA node.
+ *
+ * \param[in] ptr Beginning of the memory.
+ * \param[in] size Size of the memory.
+ * \param[in] numa_node NUMA node.
+ */
+void bind_to_numa_node(void* ptr, std::size_t size, std::size_t numa_node) {
+    // Use the system call directly not to depend on libnuma.
+    using NodeMask = unsigned long;  // NOLINT(google-runtime-int)
+    constexpr std::size_t max_nodes = sizeof(NodeMask) * 8U;
+    if (numa_node >= max_nodes) {
+        throw StatBenchException(
+            "Too large index of a NUMA node: " + std::to_string(numa_node));
+    }
+    const NodeMask mask = static_cast<NodeMask>(1) << numa_node;
+    constexpr int mpol_bind = 2;  // MPOL_BIND in linux/mempolicy.h
+    if (syscall(SYS_mbind, ptr, size, mpol_bind, &mask, max_nodes, 0U) !=
+        0) {
+        throw StatBenchException("Failed to bind a buffer to NUMA node " +
+            std::to_string(numa_node) + ": " + std::strerror(errno));
+    }
+}
+#endif
+
+}  // namespace
+
+AlignedBuffer::AlignedBuffer(std::size_t size, const BufferOptions& options)
+    : size_(size) {
+    if (options.alignment == 0U ||
+        (options.alignment & (options.alignment - 1U)) != 0U) {
+        throw StatBenchException(
+            "Alignment of a buffer must be a power of two.");
+    }
+    const bool use_pages = options.huge_pages != HugePageMode::none ||
+        options.numa_node.has_value();
+    if (!use_pages) {
+        allocated_size_ = size + options.offset + options.alignment;
+        allocated_ = ::operator new(allocated_size_);
+        data_ = align_address(allocated_, options.alignment) + options.offset;
+        if (options.prefault) {
+            std::memset(allocated_, 0, allocated_size_);
+        }
+        return;
+    }
+
+#if defined(__linux__)
+    const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    std::size_t alignment = options.alignment;
+    std::size_t granularity = page_size;
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;  // NOLINT
+    if (options.huge_pages == HugePageMode::transparent) {
+        // Transparent huge pages are used only for aligned regions.
+        if (alignment < huge_page_size) {
+            alignment = huge_page_size;
+        }
+    } else if (options.huge_pages == HugePageMode::explicit_pages) {
+        granularity = huge_page_size;
+        flags |= MAP_HUGETLB;  // NOLINT
+    }
+    const std::size_t extra = alignment > granularity ? alignment : 0U;
+    allocated_size_ = round_up(size + options.offset + extra, granularity);
+    if (allocated_size_ == 0U) {
+        allocated_size_ = granularity;
+    }
+    void* ptr = mmap(nullptr, allocated_size_,
+        PROT_READ | PROT_WRITE,  // NOLINT
+        flags, -1, 0);
+    if (ptr == MAP_FAILED) {  // NOLINT
+        const int error = errno;
+        allocated_size_ = 0;
+        if (options.huge_pages == HugePageMode::explicit_pages) {
+            throw StatBenchException(
+                std::string("Failed to allocate huge pages (check "
+                            "vm.nr_hugepages): ") +
+                std::strerror(error));
+        }
+        throw std::bad_alloc();
+    }
+    allocated_ = ptr;
+    is_mapped_ = true;
+    char* aligned = align_address(allocated_, alignment);
+
+    try {
+        if (options.huge_pages == HugePageMode::transparent) {
+            // This is only advice, so errors are ignored.
+            (void)madvise(aligned,
+                allocated_size_ -
+                    static_cast<std::size_t>(
+                        aligned - static_cast<char*>(allocated_)),
+                MADV_HUGEPAGE);
+        }
+        if (options.numa_node) {
+            bind_to_numa_node(allocated_, allocated_size_, *options.numa_node);
+        }
+    } catch (...) {
+        release();
+        throw;
+    }
+
+    data_ = aligned + options.offset;
+    if (options.prefault) {
+        std::memset(allocated_, 0, allocated_size_);
+    }
+#else
+    throw StatBenchException(
+        "Huge pages and binding to NUMA nodes are supported only on Linux.");
+#endif
+}
+
+AlignedBuffer::AlignedBuffer(AlignedBuffer&& obj) noexcept
+    : allocated_(std::exchange(obj.allocated_, nullptr)),
+      allocated_size_(std::exchange(obj.allocated_size_, 0U)),
+      is_mapped_(std::exchange(obj.is_mapped_, false)),
+      data_(std::exchange(obj.data_, nullptr)),
+      size_(std::exchange(obj.size_, 0U)) {}
+
+auto AlignedBuffer::operator=(AlignedBuffer&& obj) noexcept
+    -> AlignedBuffer& {
+    if (this != &obj) {
+        release();
+        allocated_ = std::exchange(obj.allocated_, nullptr);
+        allocated_size_ = std::exchange(obj.allocated_size_, 0U);
+        is_mapped_ = std::exchange(obj.is_mapped_, false);
+        data_ = std::exchange(obj.data_, nullptr);
+        size_ = std::exchange(obj.size_, 0U);
+    }
+    return *this;
+}
+
+AlignedBuffer::~AlignedBuffer() noexcept { release(); }
+
+void AlignedBuffer::release() noexcept {
+    if (allocated_ == nullptr) {
+        return;
+    }
+#if defined(__linux__)
+    if (is_mapped_) {
+        (void)munmap(allocated_, allocated_size_);
+    } else {
+        ::operator delete(allocated_);
+    }
+#else
+    ::operator delete(allocated_);
+#endif
+    allocated_ = nullptr;
+    allocated_size_ = 0;
+    is_mapped_ = false;
+    data_ = nullptr;
+    size_ = 0;
+}
+
+}  // namespace stat_bench::util
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of BufferedFileWriter class.
+ */
+#include "stat_bench/util/buffered_file_writer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "stat_bench/stat_bench_exception.h"
+
+#if defined(_WIN32)
+// Windows
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+// POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace stat_bench::util {
+
+namespace {
+
+/*!
+ * \brief Open a file to write.
+ *
+ * \param[in] file_path File path.
+ * \return File descriptor. (Negative value on errors.)
+ */
+[[nodiscard]] auto open_file_to_write(const std::string& file_path) -> int {
+#if defined(_WIN32)
+    int file_descriptor = -1;
+    (void)_sopen_s(&file_descriptor, file_path.c_str(),
+        _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _SH_DENYWR,
+        _S_IREAD | _S_IWRITE);
+    return file_descriptor;
+#else
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    return ::open(file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+        0644);  // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+#endif
+}
+
+/*!
+ * \brief Write data to a file.
+ *
+ * \param[in] file_descriptor File descriptor.
+ * \param[in] data Data.
+ * \param[in] size Size of the data.
+ * \return Number of bytes written. (Negative value on errors.)
+ */
+[[nodiscard]] auto write_some_to_file(
+    int file_descriptor, const char* data, std::size_t size) -> long long {
+#if defined(_WIN32)
+    constexpr std::size_t max_size_per_call = 1U << 30U;
+    return static_cast<long long>(_write(file_descriptor, data,
+        static_cast<unsigned int>(
+            size < max_size_per_call ? size : max_size_per_call)));
+#else
+    return static_cast<long long>(::write(file_descriptor, data, size));
+#endif
+}
+
+/*!
+ * \brief Close a file.
+ *
+ * \param[in] file_descriptor File descriptor.
+ * \return Zero on success.
+ */
+auto close_file(int file_descriptor) -> int {
+#if defined(_WIN32)
+    return _close(file_descriptor);
+#else
+    return ::close(file_descriptor);
+#endif
+}
+
+}  // namespace
+
+BufferedFileWriter::BufferedFileWriter(
+    std::string file_path, std::size_t buffer_size)
+    : file_path_(std::move(file_path)),
+      file_descriptor_(open_file_to_write(file_path_)) {
+    if (file_descriptor_ < 0) {
+        throw StatBenchException(
+            fmt::format(FMT_STRING("Failed to open {}."), file_path_));
+    }
+    if (buffer_size == 0U) {
+        (void)close_file(file_descriptor_);
+        throw StatBenchException("Size of buffers must be positive.");
+    }
+    buffer_.resize(buffer_size);
+}
+
+BufferedFileWriter::~BufferedFileWriter() noexcept {
+    try {
+        close();
+    } catch (...) {
+        // Errors are ignored in destructors.
+        if (file_descriptor_ >= 0) {
+            (void)close_file(file_descriptor_);
+            file_descriptor_ = -1;
+        }
+    }
+}
+
+void BufferedFileWriter::flush() {
+    if (used_size_ == 0U) {
+        return;
+    }
+    write_to_file(buffer_.data(), used_size_);
+    used_size_ = 0;
+}
+
+void BufferedFileWriter::close() {
+    if (file_descriptor_ < 0) {
+        return;
+    }
+    flush();
+    const int result = close_file(file_descriptor_);
+    file_descriptor_ = -1;
+    if (result != 0) {
+        throw StatBenchException(
+            fmt::format(FMT_STRING("Failed to close {}."), file_path_));
+    }
+}
+
+void BufferedFileWriter::write_slow(const char* data, std::size_t size) {
+    flush();
+    if (size < buffer_.size()) {
+        std::memcpy(buffer_.data(), data, size);
+        used_size_ = size;
+        return;
+    }
+    write_to_file(data, size);
+}
+
+void BufferedFileWriter::write_to_file(const char* data, std::size_t size) {
+    if (file_descriptor_ < 0) {
+        throw StatBenchException(
+            fmt::format(FMT_STRING("{} is already closed."), file_path_));
+    }
+    while (size > 0U) {
+        const long long written_size =
+            write_some_to_file(file_descriptor_, data, size);
+        if (written_size < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw StatBenchException(fmt::format(
+                FMT_STRING("Failed to write to {}: {}"), file_path_,
+                std::strerror(errno)));  // NOLINT(concurrency-mt-unsafe)
+        }
+        data += written_size;  // NOLINT
+        size -= static_cast<std::size_t>(written_size);
+    }
+}
+
+}  // namespace stat_bench::util
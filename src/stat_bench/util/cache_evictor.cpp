@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of CacheEvictor class.
+ */
+#include "stat_bench/util/cache_evictor.h"
+
+#include <cstdint>
+#include <utility>
+
+#include "stat_bench/do_not_optimize.h"
+#include "stat_bench/util/cache_sizes.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+    defined(_M_IX86)
+#define STAT_BENCH_IMPL_HAS_CLFLUSH 1
+#include <emmintrin.h>
+#endif
+
+namespace stat_bench::util {
+
+auto default_cache_eviction_size() -> std::size_t {
+    constexpr std::size_t fallback_size =
+        static_cast<std::size_t>(64) * 1024 * 1024;
+    const CacheSizes& sizes = detect_cache_sizes();
+    std::size_t last_level_size = sizes.l3;
+    if (last_level_size == 0U) {
+        last_level_size = sizes.l2;
+    }
+    if (last_level_size == 0U) {
+        return fallback_size;
+    }
+    return 2U * last_level_size;
+}
+
+CacheEvictor::CacheEvictor(
+    std::vector<MemoryRegion> flushed_regions, std::size_t eviction_size)
+    : method_(CacheEvictionMethod::stream),
+      flushed_regions_(std::move(flushed_regions)) {
+#ifdef STAT_BENCH_IMPL_HAS_CLFLUSH
+    if (!flushed_regions_.empty()) {
+        method_ = CacheEvictionMethod::flush;
+        return;
+    }
+#endif
+    BufferOptions options;
+    // Pages must be written, or all pages are mapped to the same zero page.
+    options.prefault = true;
+    eviction_buffer_ = AlignedBuffer(eviction_size, options);
+}
+
+void CacheEvictor::evict() const noexcept {
+#ifdef STAT_BENCH_IMPL_HAS_CLFLUSH
+    if (method_ == CacheEvictionMethod::flush) {
+        for (const auto& [data, size] : flushed_regions_) {
+            const auto address =
+                reinterpret_cast<std::uintptr_t>(data);  // NOLINT
+            const std::uintptr_t end = address + size;
+            for (std::uintptr_t line =
+                     address / cache_line_size * cache_line_size;
+                line < end; line += cache_line_size) {
+                _mm_clflush(reinterpret_cast<const void*>(line));  // NOLINT
+            }
+        }
+        _mm_mfence();
+        return;
+    }
+#endif
+    const auto* data = eviction_buffer_.as_array<const unsigned char>();
+    const std::size_t size = eviction_buffer_.size();
+    unsigned char sum = 0;
+    for (std::size_t i = 0; i < size; i += cache_line_size) {
+        sum = static_cast<unsigned char>(sum + data[i]);  // NOLINT
+    }
+    do_not_optimize(sum);
+}
+
+auto can_flush_cache_lines() noexcept -> bool {
+#ifdef STAT_BENCH_IMPL_HAS_CLFLUSH
+    return true;
+#else
+    return false;
+#endif
+}
+
+auto shared_streaming_cache_evictor() -> const CacheEvictor& {
+    static const CacheEvictor evictor{};
+    return evictor;
+}
+
+}  // namespace stat_bench::util
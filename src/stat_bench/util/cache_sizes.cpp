@@ -0,0 +1,178 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to detect sizes of CPU caches.
+ */
+#include "stat_bench/util/cache_sizes.h"
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#if defined(_WIN32)
+// Windows
+#include <Windows.h>
+
+#include <vector>
+#elif defined(__APPLE__)
+// macOS
+#include <sys/sysctl.h>
+#include <sys/types.h>
+#endif
+
+namespace stat_bench::util {
+
+namespace {
+
+/*!
+ * \brief Read the first line of a file.
+ *
+ * \param[in] file_path File path.
+ * \return First line. (Empty if the file cannot be read.)
+ */
+[[nodiscard]] auto read_first_line(const std::string& file_path)
+    -> std::string {
+    std::ifstream stream(file_path);
+    std::string line;
+    if (!stream || !std::getline(stream, line)) {
+        return {};
+    }
+    return line;
+}
+
+#if defined(__APPLE__)
+/*!
+ * \brief Read a size using sysctl.
+ *
+ * \param[in] name Name of the value.
+ * \return Size. (Zero if not available.)
+ */
+[[nodiscard]] auto read_sysctl_size(const char* name) -> std::size_t {
+    std::int64_t value = 0;
+    std::size_t length = sizeof(value);
+    if (sysctlbyname(name, &value, &length, nullptr, 0) != 0 || value < 0) {
+        return 0;
+    }
+    return static_cast<std::size_t>(value);
+}
+#endif
+
+/*!
+ * \brief Detect sizes of CPU caches.
+ *
+ * \return Sizes of caches.
+ */
+[[nodiscard]] auto detect_cache_sizes_impl() -> CacheSizes {
+#if defined(_WIN32)
+    DWORD length = 0;
+    GetLogicalProcessorInformation(nullptr, &length);
+    std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> infos(
+        length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+    if (infos.empty() ||
+        GetLogicalProcessorInformation(infos.data(), &length) == FALSE) {
+        return CacheSizes{};
+    }
+    CacheSizes sizes;
+    for (const auto& info : infos) {
+        if (info.Relationship != RelationCache) {
+            continue;
+        }
+        const auto& cache = info.Cache;
+        if (cache.Level == 1 && cache.Type == CacheData && sizes.l1d == 0) {
+            sizes.l1d = cache.Size;
+        } else if (cache.Level == 2 && sizes.l2 == 0) {
+            sizes.l2 = cache.Size;
+        } else if (cache.Level == 3 && sizes.l3 == 0) {
+            sizes.l3 = cache.Size;
+        }
+    }
+    return sizes;
+#elif defined(__APPLE__)
+    CacheSizes sizes;
+    sizes.l1d = read_sysctl_size("hw.l1dcachesize");
+    sizes.l2 = read_sysctl_size("hw.l2cachesize");
+    sizes.l3 = read_sysctl_size("hw.l3cachesize");
+    return sizes;
+#else
+    return read_cache_sizes_from_sysfs("/sys/devices/system/cpu/cpu0/cache");
+#endif
+}
+
+}  // namespace
+
+auto parse_cache_size(std::string_view str) -> std::size_t {
+    constexpr std::size_t decimal_base = 10;
+    std::size_t value = 0;
+    std::size_t pos = 0;
+    while (pos < str.size() &&
+        std::isdigit(static_cast<unsigned char>(str[pos])) != 0) {
+        value = value * decimal_base + static_cast<std::size_t>(str[pos] - '0');
+        ++pos;
+    }
+    if (pos == 0) {
+        return 0;
+    }
+    if (pos == str.size()) {
+        return value;
+    }
+    constexpr std::size_t kibi = 1024U;
+    switch (str[pos]) {
+    case 'K':
+        return value * kibi;
+    case 'M':
+        return value * kibi * kibi;
+    case 'G':
+        return value * kibi * kibi * kibi;
+    default:
+        return 0;
+    }
+}
+
+auto read_cache_sizes_from_sysfs(const std::string& directory) -> CacheSizes {
+    CacheSizes sizes;
+    // Linux has a small number of cache indices (index0, index1, ...).
+    constexpr std::size_t max_indices = 16;
+    for (std::size_t i = 0; i < max_indices; ++i) {
+        const std::string index_dir =
+            directory + "/index" + std::to_string(i) + "/";
+        const std::string level = read_first_line(index_dir + "level");
+        if (level.empty()) {
+            break;
+        }
+        const std::string type = read_first_line(index_dir + "type");
+        const std::size_t size =
+            parse_cache_size(read_first_line(index_dir + "size"));
+        if (level == "1" && type == "Data") {
+            sizes.l1d = size;
+        } else if (level == "2" && type != "Instruction") {
+            sizes.l2 = size;
+        } else if (level == "3" && type != "Instruction") {
+            sizes.l3 = size;
+        }
+    }
+    return sizes;
+}
+
+auto detect_cache_sizes() -> const CacheSizes& {
+    static const CacheSizes sizes = detect_cache_sizes_impl();
+    return sizes;
+}
+
+}  // namespace stat_bench::util
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to detect the topology of CPUs.
+ */
+#include "stat_bench/util/cpu_topology.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+
+#if defined(_WIN32)
+// Windows
+#include <Windows.h>
+
+#include <bitset>
+#include <climits>
+#include <vector>
+#elif defined(__APPLE__)
+// macOS
+#include <sys/sysctl.h>
+#include <sys/types.h>
+
+#include <cstdint>
+#endif
+
+namespace stat_bench::util {
+
+namespace {
+
+/*!
+ * \brief Read the first line of a file.
+ *
+ * \param[in] file_path File path.
+ * \return First line. (Empty if the file cannot be read.)
+ */
+[[nodiscard]] auto read_first_line(const std::string& file_path)
+    -> std::string {
+    std::ifstream stream(file_path);
+    std::string line;
+    if (!stream || !std::getline(stream, line)) {
+        return {};
+    }
+    return line;
+}
+
+#if defined(__APPLE__)
+/*!
+ * \brief Read a number using sysctl.
+ *
+ * \param[in] name Name of the value.
+ * \return Number. (Zero if not available.)
+ */
+[[nodiscard]] auto read_sysctl_number(const char* name) -> std::size_t {
+    std::int32_t value = 0;
+    std::size_t length = sizeof(value);
+    if (sysctlbyname(name, &value, &length, nullptr, 0) != 0 || value < 0) {
+        return 0;
+    }
+    return static_cast<std::size_t>(value);
+}
+#endif
+
+/*!
+ * \brief Detect the topology of CPUs.
+ *
+ * \return Topology of CPUs. (Zeros if not detected.)
+ */
+[[nodiscard]] auto detect_cpu_topology_impl() -> CpuTopology {
+#if defined(_WIN32)
+    DWORD length = 0;
+    GetLogicalProcessorInformation(nullptr, &length);
+    std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> infos(
+        length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+    if (infos.empty() ||
+        GetLogicalProcessorInformation(infos.data(), &length) == FALSE) {
+        return CpuTopology{0, 0, 0};
+    }
+    CpuTopology topology{0, 0, 0};
+    for (const auto& info : infos) {
+        if (info.Relationship == RelationProcessorCore) {
+            ++topology.physical_cores;
+            topology.logical_cpus +=
+                std::bitset<sizeof(ULONG_PTR) * CHAR_BIT>(info.ProcessorMask)
+                    .count();
+        } else if (info.Relationship == RelationProcessorPackage) {
+            ++topology.sockets;
+        }
+    }
+    return topology;
+#elif defined(__APPLE__)
+    CpuTopology topology;
+    topology.logical_cpus = read_sysctl_number("hw.logicalcpu");
+    topology.physical_cores = read_sysctl_number("hw.physicalcpu");
+    topology.sockets = read_sysctl_number("hw.packages");
+    return topology;
+#else
+    return read_cpu_topology_from_sysfs("/sys/devices/system/cpu");
+#endif
+}
+
+}  // namespace
+
+auto read_cpu_topology_from_sysfs(const std::string& directory)
+    -> CpuTopology {
+    std::size_t logical_cpus = 0;
+    std::set<std::pair<std::string, std::string>> cores;
+    std::set<std::string> sockets;
+    // Indices of CPUs can have holes when some CPUs are offline, so a fixed
+    // number of indices is checked.
+    constexpr std::size_t max_cpus = 4096;
+    for (std::size_t i = 0; i < max_cpus; ++i) {
+        const std::string topology_dir =
+            directory + "/cpu" + std::to_string(i) + "/topology/";
+        const std::string package_id =
+            read_first_line(topology_dir + "physical_package_id");
+        const std::string core_id = read_first_line(topology_dir + "core_id");
+        if (package_id.empty() || core_id.empty()) {
+            continue;
+        }
+        ++logical_cpus;
+        cores.emplace(package_id, core_id);
+        sockets.insert(package_id);
+    }
+    return CpuTopology{logical_cpus, cores.size(), sockets.size()};
+}
+
+auto detect_cpu_topology() -> const CpuTopology& {
+    static const CpuTopology topology = [] {
+        CpuTopology detected = detect_cpu_topology_impl();
+        if (detected.logical_cpus == 0 || detected.physical_cores == 0) {
+            const std::size_t hardware_concurrency =
+                std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+            detected.logical_cpus = hardware_concurrency;
+            detected.physical_cores = hardware_concurrency;
+        }
+        if (detected.sockets == 0) {
+            detected.sockets = 1;
+        }
+        return detected;
+    }();
+    return topology;
+}
+
+}  // namespace stat_bench::util
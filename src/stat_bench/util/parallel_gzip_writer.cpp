@@ -0,0 +1,262 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of ParallelGzipWriter class.
+ */
+#include "stat_bench/util/parallel_gzip_writer.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include <fmt/format.h>
+#include <zlib.h>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::util {
+
+namespace {
+
+//! Size of the window in deflate algorithm.
+constexpr std::size_t deflate_window_size = static_cast<std::size_t>(32768);
+
+//! Window bits to use raw deflate streams.
+constexpr int raw_deflate_window_bits = -15;
+
+//! Memory level of deflate algorithm. (Default in zlib.)
+constexpr int deflate_memory_level = 8;
+
+/*!
+ * \brief Compress a block.
+ *
+ * Blocks other than the last one are finished with a sync flush so that the
+ * compressed blocks can be concatenated into a single deflate stream.
+ *
+ * \param[in] input Input data.
+ * \param[in] dictionary Dictionary. (End of the previous block.)
+ * \param[in] compression_level Compression level.
+ * \param[in] is_last Whether the block is the last one.
+ * \return Compressed block.
+ */
+[[nodiscard]] auto compress_block(const std::vector<unsigned char>& input,
+    const std::vector<unsigned char>& dictionary, int compression_level,
+    bool is_last) -> CompressedGzipBlock {
+    z_stream stream{};
+    if (deflateInit2(&stream, compression_level, Z_DEFLATED,
+            raw_deflate_window_bits, deflate_memory_level,
+            Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw StatBenchException("Failed to initialize zlib.");
+    }
+    if (!dictionary.empty()) {
+        (void)deflateSetDictionary(&stream, dictionary.data(),
+            static_cast<uInt>(dictionary.size()));
+    }
+
+    CompressedGzipBlock block;
+    // Margin for markers of sync flush.
+    constexpr std::size_t margin = 64;
+    block.data.resize(
+        deflateBound(&stream, static_cast<uLong>(input.size())) + margin);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream.next_in = const_cast<unsigned char*>(input.data());
+    stream.avail_in = static_cast<uInt>(input.size());
+    stream.next_out = block.data.data();
+    stream.avail_out = static_cast<uInt>(block.data.size());
+    const int flush = is_last ? Z_FINISH : Z_SYNC_FLUSH;
+    const int result = deflate(&stream, flush);
+    const bool succeeded = is_last
+        ? (result == Z_STREAM_END)
+        : (result == Z_OK && stream.avail_in == 0U && stream.avail_out > 0U);
+    block.data.resize(static_cast<std::size_t>(stream.total_out));
+    (void)deflateEnd(&stream);
+    if (!succeeded) {
+        throw StatBenchException("Failed to compress data.");
+    }
+
+    block.crc = static_cast<std::uint32_t>(
+        crc32(0, input.data(), static_cast<uInt>(input.size())));
+    block.uncompressed_size = input.size();
+    return block;
+}
+
+/*!
+ * \brief Write a 32-bit integer in little endian.
+ *
+ * \param[in] file Writer of the file.
+ * \param[in] value Value.
+ */
+void write_uint32_le(BufferedFileWriter& file, std::uint32_t value) {
+    // NOLINTBEGIN(*-magic-numbers)
+    const std::array<char, 4> bytes{static_cast<char>(value & 0xFFU),
+        static_cast<char>((value >> 8U) & 0xFFU),
+        static_cast<char>((value >> 16U) & 0xFFU),
+        static_cast<char>((value >> 24U) & 0xFFU)};
+    // NOLINTEND(*-magic-numbers)
+    file.write(bytes.data(), bytes.size());
+}
+
+/*!
+ * \brief Validate a compression level.
+ *
+ * \param[in] compression_level Compression level.
+ * \return Compression level.
+ */
+[[nodiscard]] auto validate_compression_level(int compression_level) -> int {
+    if (compression_level < ParallelGzipWriter::min_compression_level ||
+        compression_level > ParallelGzipWriter::max_compression_level) {
+        throw StatBenchException(fmt::format(
+            FMT_STRING("Invalid compression level {}."), compression_level));
+    }
+    return compression_level;
+}
+
+/*!
+ * \brief Validate a size of blocks.
+ *
+ * \param[in] block_size Size of blocks.
+ * \return Size of blocks.
+ */
+[[nodiscard]] auto validate_block_size(std::size_t block_size)
+    -> std::size_t {
+    if (block_size == 0U) {
+        throw StatBenchException("Size of blocks must be positive.");
+    }
+    return block_size;
+}
+
+/*!
+ * \brief Get the number of threads to compress data.
+ *
+ * \param[in] num_threads Number of threads. (Zero specifies the number of
+ * hardware threads.)
+ * \return Number of threads.
+ */
+[[nodiscard]] auto resolve_num_threads(std::size_t num_threads)
+    -> std::size_t {
+    if (num_threads == 0U) {
+        return std::max<std::size_t>(
+            static_cast<std::size_t>(std::thread::hardware_concurrency()), 1U);
+    }
+    return num_threads;
+}
+
+}  // namespace
+
+ParallelGzipWriter::ParallelGzipWriter(std::string file_path,
+    int compression_level, std::size_t num_threads, std::size_t block_size)
+    : compression_level_(validate_compression_level(compression_level)),
+      max_pending_blocks_(resolve_num_threads(num_threads)),
+      block_size_(validate_block_size(block_size)),
+      file_(std::move(file_path)),
+      workers_(max_pending_blocks_, max_pending_blocks_),
+      crc_(static_cast<std::uint32_t>(crc32(0, nullptr, 0))) {
+    current_block_.reserve(block_size_);
+
+    // Header of gzip format without optional fields. (RFC 1952)
+    // NOLINTNEXTLINE(*-magic-numbers)
+    constexpr std::array<char, 10> header{'\x1F', '\x8B', '\x08', '\x00',
+        '\x00', '\x00', '\x00', '\x00', '\x00', '\xFF'};
+    file_.write(header.data(), header.size());
+}
+
+ParallelGzipWriter::~ParallelGzipWriter() noexcept {
+    try {
+        close();
+    } catch (...) {
+        // Errors are ignored in destructors.
+        // The worker pool waits for the remaining tasks in its destructor.
+    }
+}
+
+void ParallelGzipWriter::write(const unsigned char* data, std::size_t size) {
+    if (is_closed_) {
+        throw StatBenchException("Writing to a closed gzip file.");
+    }
+    while (size > 0U) {
+        const std::size_t copied_size =
+            std::min(size, block_size_ - current_block_.size());
+        current_block_.insert(current_block_.end(), data,
+            data + copied_size);  // NOLINT(*-pointer-arithmetic)
+        data += copied_size;      // NOLINT(*-pointer-arithmetic)
+        size -= copied_size;
+        if (current_block_.size() == block_size_) {
+            submit_block(false);
+        }
+    }
+}
+
+void ParallelGzipWriter::close() {
+    if (is_closed_) {
+        return;
+    }
+    is_closed_ = true;
+    submit_block(true);
+    while (!pending_blocks_.empty()) {
+        write_oldest_block();
+    }
+    write_uint32_le(file_, crc_);
+    // NOLINTNEXTLINE(*-magic-numbers)
+    write_uint32_le(file_, static_cast<std::uint32_t>(uncompressed_size_));
+    file_.close();
+}
+
+void ParallelGzipWriter::submit_block(bool is_last) {
+    while (pending_blocks_.size() >= max_pending_blocks_) {
+        write_oldest_block();
+    }
+
+    std::vector<unsigned char> next_dictionary;
+    if (!is_last) {
+        const std::size_t dictionary_size =
+            std::min(current_block_.size(), deflate_window_size);
+        next_dictionary.assign(current_block_.end() -
+                static_cast<std::ptrdiff_t>(dictionary_size),
+            current_block_.end());
+    }
+
+    // Errors in compression are rethrown from the future in
+    // write_oldest_block function.
+    auto task = std::make_shared<std::packaged_task<CompressedGzipBlock()>>(
+        [input = std::move(current_block_),
+            dictionary = std::move(dictionary_),
+            compression_level = compression_level_, is_last] {
+            return compress_block(
+                input, dictionary, compression_level, is_last);
+        });
+    pending_blocks_.push_back(task->get_future());
+    workers_.submit([task] { (*task)(); });
+
+    current_block_ = std::vector<unsigned char>();
+    current_block_.reserve(block_size_);
+    dictionary_ = std::move(next_dictionary);
+}
+
+void ParallelGzipWriter::write_oldest_block() {
+    const CompressedGzipBlock block = pending_blocks_.front().get();
+    pending_blocks_.pop_front();
+    file_.write(reinterpret_cast<const char*>(block.data.data()),  // NOLINT
+        block.data.size());
+    crc_ = static_cast<std::uint32_t>(crc32_combine(crc_, block.crc,
+        static_cast<z_off_t>(block.uncompressed_size)));
+    uncompressed_size_ += block.uncompressed_size;
+}
+
+}  // namespace stat_bench::util
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to set affinity of threads.
+ */
+#include "stat_bench/util/thread_affinity.h"
+
+#include <cstddef>
+#include <vector>
+
+#if defined(_WIN32)
+// Windows
+#include <Windows.h>
+#elif defined(__linux__)
+// Linux
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace stat_bench::util {
+
+auto pin_current_thread_to_cpu(std::size_t cpu_index) -> bool {
+    return restrict_current_thread_to_cpus({cpu_index});
+}
+
+auto restrict_current_thread_to_cpus(
+    const std::vector<std::size_t>& cpu_indices) -> bool {
+    if (cpu_indices.empty()) {
+        return false;
+    }
+#if defined(_WIN32)
+    constexpr std::size_t max_cpu_index = sizeof(DWORD_PTR) * 8U;
+    DWORD_PTR mask = 0;
+    for (const std::size_t cpu_index : cpu_indices) {
+        if (cpu_index >= max_cpu_index) {
+            return false;
+        }
+        mask |= static_cast<DWORD_PTR>(1) << cpu_index;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#elif defined(__linux__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const std::size_t cpu_index : cpu_indices) {
+        if (cpu_index >= static_cast<std::size_t>(CPU_SETSIZE)) {
+            return false;
+        }
+        CPU_SET(cpu_index, &cpu_set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) ==
+        0;
+#else
+    return false;
+#endif
+}
+
+}  // namespace stat_bench::util
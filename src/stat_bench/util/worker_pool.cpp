@@ -0,0 +1,135 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of WorkerPool class.
+ */
+#include "stat_bench/util/worker_pool.h"
+
+#include <utility>
+
+#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/thread_affinity.h"
+
+namespace stat_bench::util {
+
+WorkerPool::WorkerPool(std::size_t num_threads,
+    std::size_t max_pending_tasks, std::vector<std::size_t> cpu_indices)
+    : max_pending_tasks_(max_pending_tasks),
+      cpu_indices_(std::move(cpu_indices)) {
+    if (num_threads == 0) {
+        throw StatBenchException(
+            "Number of threads in a worker pool must be positive.");
+    }
+    if (max_pending_tasks == 0) {
+        throw StatBenchException(
+            "Maximum number of pending tasks must be positive.");
+    }
+    threads_.reserve(num_threads);
+    try {
+        for (std::size_t i = 0; i < num_threads; ++i) {
+            threads_.emplace_back([this] { process_tasks(); });
+        }
+    } catch (...) {
+        stop();
+        throw;
+    }
+}
+
+WorkerPool::~WorkerPool() { stop(); }
+
+void WorkerPool::submit(Task task) {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_finished_.wait(lock, [this] {
+            return tasks_.size() < max_pending_tasks_ || error_;
+        });
+        rethrow_if_failed();
+        tasks_.push_back(std::move(task));
+    }
+    task_submitted_.notify_one();
+}
+
+void WorkerPool::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_finished_.wait(
+        lock, [this] { return tasks_.empty() && num_running_tasks_ == 0; });
+    rethrow_if_failed();
+}
+
+void WorkerPool::process_tasks() {
+    if (!cpu_indices_.empty() &&
+        !restrict_current_thread_to_cpus(cpu_indices_)) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!error_) {
+            error_ = std::make_exception_ptr(StatBenchException(
+                "Failed to restrict worker threads to the specified CPUs."));
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        task_submitted_.wait(
+            lock, [this] { return !tasks_.empty() || is_stopping_; });
+        if (tasks_.empty()) {
+            // Stopping.
+            return;
+        }
+        Task task = std::move(tasks_.front());
+        tasks_.pop_front();
+        if (error_) {
+            // Tasks after errors are discarded.
+            task_finished_.notify_all();
+            continue;
+        }
+        ++num_running_tasks_;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            task();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        task = Task();
+
+        lock.lock();
+        --num_running_tasks_;
+        if (error && !error_) {
+            error_ = error;
+        }
+        task_finished_.notify_all();
+    }
+}
+
+void WorkerPool::stop() {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        is_stopping_ = true;
+    }
+    task_submitted_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+void WorkerPool::rethrow_if_failed() {
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+}
+
+}  // namespace stat_bench::util
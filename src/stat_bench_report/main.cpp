@@ -0,0 +1,190 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Main function of stat_bench_report.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <lyra/args.hpp>
+#include <lyra/cli.hpp>
+
+#include "report_config.h"
+#include "stat_bench/bench_impl/benchmark_group_config.h"
+#include "stat_bench/benchmark_group_name.h"
+#include "stat_bench/reporter/data_file_helper.h"
+#include "stat_bench/reporter/data_file_reader.h"
+#include "stat_bench/reporter/data_file_spec.h"
+#include "stat_bench/reporter/plot_reporter.h"
+#include "stat_bench/reporter/replay_measurements.h"
+#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/check_glob_pattern.h"
+
+namespace stat_bench::report {
+
+namespace {
+
+/*!
+ * \brief Struct of names of parameters and custom outputs in a group.
+ */
+struct GroupContents {
+    //! Parameter names.
+    std::unordered_set<std::string> parameters{};
+
+    //! Custom output names.
+    std::unordered_set<std::string> outputs{};
+};
+
+/*!
+ * \brief Collect names of parameters and custom outputs in groups.
+ *
+ * \param[in] data Data in data files.
+ * \return Names for each group name.
+ */
+[[nodiscard]] auto collect_group_contents(
+    const std::vector<reporter::data_file_spec::MeasurementData>& data)
+    -> std::unordered_map<std::string, GroupContents> {
+    std::unordered_map<std::string, GroupContents> contents;
+    for (const auto& measurement : data) {
+        auto& group = contents[measurement.group_name.str()];
+        for (const auto& [name, value] : measurement.params) {
+            group.parameters.insert(name.str());
+        }
+        for (const auto& output : measurement.custom_stat_outputs) {
+            group.outputs.insert(output.name.str());
+        }
+        for (const auto& output : measurement.custom_outputs) {
+            group.outputs.insert(output.name.str());
+        }
+    }
+    return contents;
+}
+
+/*!
+ * \brief Check whether a plot can be generated for a group.
+ *
+ * \param[in] plot Configuration of the plot.
+ * \param[in] group Names of parameters and custom outputs in the group.
+ * \retval true The plot can be generated.
+ * \retval false The plot can't be generated.
+ */
+[[nodiscard]] auto is_applicable(
+    const PlotConfig& plot, const GroupContents& group) -> bool {
+    const auto has_parameter = [&group](const std::string& name) {
+        return name.empty() || group.parameters.count(name) > 0;
+    };
+    return has_parameter(plot.parameter) &&
+        has_parameter(plot.subplot_column_parameter) &&
+        has_parameter(plot.subplot_row_parameter) &&
+        (plot.output.empty() || group.outputs.count(plot.output) > 0);
+}
+
+/*!
+ * \brief Generate plots.
+ *
+ * \param[in] config Configuration.
+ */
+void generate_plots(const ReportConfig& config) {
+    std::vector<reporter::data_file_spec::MeasurementData> data;
+    for (const auto& file_path : config.data_file_paths) {
+        auto root = reporter::read_data_file(file_path);
+        std::move(root.measurements.begin(), root.measurements.end(),
+            std::back_inserter(data));
+    }
+    const auto group_contents = collect_group_contents(data);
+    auto measurements = reporter::data_file_spec::restore(data);
+    data.clear();
+
+    // Plots are rendered in parallel in the worker threads of PlotReporter,
+    // and rendering of a group overlaps with that of other groups.
+    std::size_t num_threads = config.plot_threads;
+    if (num_threads == 0) {
+        num_threads =
+            std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    reporter::PlotReporter reporter(config.plot_prefix, config.plot_max_points,
+        num_threads, config.plot_cpus, config.plot_density_threshold);
+
+    reporter::replay_measurements(std::move(measurements), reporter,
+        [&config, &group_contents](const BenchmarkGroupName& group_name,
+            bench_impl::BenchmarkGroupConfig& group_config) {
+            const std::string& name = group_name.str().str();
+            const GroupContents& contents = group_contents.at(name);
+            for (const auto& group : config.groups) {
+                if (!util::check_glob_pattern(group.group_pattern, name)) {
+                    continue;
+                }
+                for (const auto& plot : group.plots) {
+                    if (!is_applicable(plot, contents)) {
+                        std::cerr << "Skipped " << plot.type << " by "
+                                  << plot.parameter << " in group " << name
+                                  << " due to missing parameters or outputs."
+                                  << "\n";
+                        continue;
+                    }
+                    group_config.add_plot(create_plot(plot));
+                }
+            }
+        });
+}
+
+}  // namespace
+
+}  // namespace stat_bench::report
+
+auto main(int argc, const char** argv) -> int {
+    try {
+        stat_bench::report::ReportConfig config;
+        auto cli = stat_bench::report::create_cli(config);
+        const auto result = cli.parse(lyra::args{argc, argv});
+        if (!result) {
+            throw std::runtime_error(result.message());
+        }
+        if (config.show_help) {
+            std::cout << cli << std::endl;  // NOLINT(performance-avoid-endl)
+            return EXIT_SUCCESS;
+        }
+        if (config.plot_prefix.empty()) {
+            throw stat_bench::StatBenchException("--plot option is required.");
+        }
+        if (config.data_file_paths.empty()) {
+            throw stat_bench::StatBenchException("No data file was given.");
+        }
+        stat_bench::report::add_plots_in_command_line(config);
+        if (!config.config_file_path.empty()) {
+            stat_bench::report::read_config_file(
+                config.config_file_path, config);
+        }
+        stat_bench::report::generate_plots(config);
+        return EXIT_SUCCESS;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what()
+                  << std::endl;  // NOLINT(performance-avoid-endl)
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,271 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of configuration of stat_bench_report.
+ */
+#include "report_config.h"
+
+#include <exception>
+#include <fstream>
+#include <utility>
+
+#include <fmt/format.h>
+#include <lyra/arg.hpp>
+#include <lyra/opt.hpp>
+#include <nlohmann/json.hpp>
+
+#include "stat_bench/custom_output_name.h"
+#include "stat_bench/param/parameter_name.h"
+#include "stat_bench/plot_options.h"
+#include "stat_bench/plots/density_plot.h"
+#include "stat_bench/plots/histogram_plot.h"
+#include "stat_bench/plots/parameter_to_output_line_plot.h"
+#include "stat_bench/plots/parameter_to_time_box_plot.h"
+#include "stat_bench/plots/parameter_to_time_line_plot.h"
+#include "stat_bench/plots/parameter_to_time_violin_plot.h"
+#include "stat_bench/plots/time_to_output_by_parameter_line_plot.h"
+#include "stat_bench/stat_bench_exception.h"
+
+namespace stat_bench::report {
+
+auto create_cli(ReportConfig& config) -> lyra::cli {
+    lyra::cli cli;
+
+    cli.add_argument(lyra::opt(config.show_help)
+            .name("-h")
+            .name("--help")
+            .optional()
+            .help("Show this help."));
+
+    cli.add_argument(lyra::arg(config.data_file_paths, "filepath")
+            .cardinality(0, 0)
+            .help("Data files written by benchmarks "
+                  "(JSON, MsgPack, or compressed MsgPack)."));
+
+    cli.add_argument(lyra::opt(config.plot_prefix, "prefix")
+            .name("--plot")
+            .optional()
+            .help("Generate plots of results. (Required.)"));
+
+    cli.add_argument(lyra::opt(config.config_file_path, "filepath")
+            .name("--config")
+            .optional()
+            .help("Configuration file of plots in JSON."));
+
+    cli.add_argument(lyra::opt(config.plot_max_points, "num")
+            .name("--plot_max_points")
+            .optional()
+            .help("Maximum number of points per trace in plots of samples. "
+                  "Zero specifies no limit."));
+
+    cli.add_argument(lyra::opt(config.plot_threads, "num")
+            .name("--plot_threads")
+            .optional()
+            .help("Number of threads to render plots. "
+                  "Zero specifies the number of CPU cores."));
+
+    cli.add_argument(lyra::opt(config.plot_cpus, "index")
+            .name("--plot_cpu")
+            .cardinality(0, 0)
+            .help("Index of a CPU core to run threads rendering plots. "
+                  "When omitted, the threads aren't restricted."));
+
+    cli.add_argument(lyra::opt(config.plot_density_threshold, "num")
+            .name("--plot_density_threshold")
+            .optional()
+            .help("Number of samples in a case above which a plot of "
+                  "probability density replaces the violin plot. "
+                  "Zero specifies no replacement."));
+
+    cli.add_argument(
+        lyra::opt(config.parameter_to_time_line_plots, "parameter")
+            .name("--parameter_to_time_line")
+            .cardinality(0, 0)
+            .help("Add a line plot of processing time by a parameter."));
+
+    cli.add_argument(
+        lyra::opt(config.parameter_to_time_violin_plots, "parameter")
+            .name("--parameter_to_time_violin")
+            .cardinality(0, 0)
+            .help("Add a violin plot of processing time by a parameter."));
+
+    cli.add_argument(
+        lyra::opt(config.parameter_to_time_box_plots, "parameter")
+            .name("--parameter_to_time_box")
+            .cardinality(0, 0)
+            .help("Add a box plot of processing time by a parameter."));
+
+    cli.add_argument(
+        lyra::opt(config.parameter_to_output_line_plots, "parameter,output")
+            .name("--parameter_to_output_line")
+            .cardinality(0, 0)
+            .help("Add a line plot of a custom output by a parameter."));
+
+    cli.add_argument(lyra::opt(config.time_to_output_by_parameter_line_plots,
+        "parameter,output")
+            .name("--time_to_output_by_parameter_line")
+            .cardinality(0, 0)
+            .help("Add a line plot of processing time to a custom output "
+                  "for each value of a parameter."));
+
+    cli.add_argument(lyra::opt(config.log_parameter)
+            .name("--log_parameter")
+            .optional()
+            .help("Plot parameters in the log scale "
+                  "in plots added by command line options."));
+
+    cli.add_argument(lyra::opt(config.log_output)
+            .name("--log_output")
+            .optional()
+            .help("Plot custom outputs in the log scale "
+                  "in plots added by command line options."));
+
+    return cli;
+}
+
+namespace {
+
+/*!
+ * \brief Create the configuration of a plot given in a command line.
+ *
+ * \param[in] type Type of the plot.
+ * \param[in] arg Argument. (Parameter name and optionally custom output name
+ * separated by a comma.)
+ * \param[in] config Configuration.
+ * \return Configuration of the plot.
+ */
+[[nodiscard]] auto create_plot_config(const std::string& type,
+    const std::string& arg, const ReportConfig& config) -> PlotConfig {
+    PlotConfig plot;
+    plot.type = type;
+    const std::size_t comma = arg.find(',');
+    plot.parameter = arg.substr(0, comma);
+    if (comma != std::string::npos) {
+        plot.output = arg.substr(comma + 1);
+    }
+    plot.log_parameter = config.log_parameter;
+    plot.log_output = config.log_output;
+    return plot;
+}
+
+}  // namespace
+
+void add_plots_in_command_line(ReportConfig& config) {
+    GroupPlotConfig group;
+    const auto add = [&group, &config](const std::string& type,
+                         const std::vector<std::string>& args) {
+        for (const auto& arg : args) {
+            group.plots.push_back(create_plot_config(type, arg, config));
+        }
+    };
+    add("parameter_to_time_line_plot", config.parameter_to_time_line_plots);
+    add("parameter_to_time_violin_plot",
+        config.parameter_to_time_violin_plots);
+    add("parameter_to_time_box_plot", config.parameter_to_time_box_plots);
+    add("parameter_to_output_line_plot",
+        config.parameter_to_output_line_plots);
+    add("time_to_output_by_parameter_line_plot",
+        config.time_to_output_by_parameter_line_plots);
+    if (!group.plots.empty()) {
+        config.groups.push_back(std::move(group));
+    }
+}
+
+void read_config_file(const std::string& file_path, ReportConfig& config) {
+    std::ifstream stream(file_path);
+    if (!stream) {
+        throw StatBenchException(fmt::format("Failed to open {}.", file_path));
+    }
+    try {
+        const auto data = nlohmann::json::parse(stream);
+        for (const auto& group_data : data.at("groups")) {
+            GroupPlotConfig group;
+            group.group_pattern = group_data.value("name", "*");
+            for (const auto& plot_data : group_data.at("plots")) {
+                PlotConfig plot;
+                plot.type = plot_data.at("type").get<std::string>();
+                plot.parameter = plot_data.value("parameter", "");
+                plot.output = plot_data.value("output", "");
+                plot.log_parameter = plot_data.value("log_parameter", false);
+                plot.log_output = plot_data.value("log_output", false);
+                plot.log_time = plot_data.value("log_time", true);
+                plot.subplot_column_parameter =
+                    plot_data.value("subplot_column_parameter", "");
+                plot.subplot_row_parameter =
+                    plot_data.value("subplot_row_parameter", "");
+                group.plots.push_back(std::move(plot));
+            }
+            config.groups.push_back(std::move(group));
+        }
+    } catch (const nlohmann::json::exception& e) {
+        throw StatBenchException(
+            fmt::format("Invalid configuration file {}: {}", file_path,
+                e.what()));
+    }
+}
+
+auto create_plot(const PlotConfig& config) -> std::shared_ptr<plots::IPlot> {
+    auto options = PlotOptions()
+                       .log_parameter(config.log_parameter)
+                       .log_output(config.log_output)
+                       .subplot_column_parameter_name(
+                           config.subplot_column_parameter)
+                       .subplot_row_parameter_name(
+                           config.subplot_row_parameter);
+    if (config.type == "histogram_plot") {
+        return std::make_shared<plots::HistogramPlot>(
+            plots::default_histogram_bins, config.log_time);
+    }
+    if (config.type == "density_plot") {
+        return std::make_shared<plots::DensityPlot>(
+            plots::default_density_points, config.log_time);
+    }
+    if (config.parameter.empty()) {
+        throw StatBenchException(fmt::format(
+            "Plot type {} requires the name of a parameter.", config.type));
+    }
+    auto parameter_name = param::ParameterName(config.parameter);
+    if (config.type == "parameter_to_time_line_plot") {
+        return std::make_shared<plots::ParameterToTimeLinePlot>(
+            std::move(parameter_name), options);
+    }
+    if (config.type == "parameter_to_time_violin_plot") {
+        return std::make_shared<plots::ParameterToTimeViolinPlot>(
+            std::move(parameter_name), options);
+    }
+    if (config.type == "parameter_to_time_box_plot") {
+        return std::make_shared<plots::ParameterToTimeBoxPlot>(
+            std::move(parameter_name), options);
+    }
+    if (config.output.empty()) {
+        throw StatBenchException(fmt::format(
+            "Plot type {} requires the name of a custom output.", config.type));
+    }
+    if (config.type == "parameter_to_output_line_plot") {
+        return std::make_shared<plots::ParameterToOutputLinePlot>(
+            std::move(parameter_name), CustomOutputName(config.output),
+            options);
+    }
+    if (config.type == "time_to_output_by_parameter_line_plot") {
+        return std::make_shared<plots::TimeToOutputByParameterLinePlot>(
+            std::move(parameter_name), CustomOutputName(config.output),
+            options);
+    }
+    throw StatBenchException(fmt::format("Invalid plot type {}.", config.type));
+}
+
+}  // namespace stat_bench::report
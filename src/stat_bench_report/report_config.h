@@ -0,0 +1,169 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of configuration of stat_bench_report.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <lyra/cli.hpp>
+
+#include "stat_bench/plots/i_plot.h"
+#include "stat_bench/runner/config.h"
+
+namespace stat_bench::report {
+
+/*!
+ * \brief Struct of configuration of a plot.
+ *
+ * Strings here are referred from plots, so objects of this struct must be
+ * kept alive while plots are used.
+ */
+struct PlotConfig {
+    //! Type of the plot. (Name of functions to add plots without "add_".)
+    std::string type{};
+
+    //! Parameter name. (Empty for plots without parameters.)
+    std::string parameter{};
+
+    //! Name of the custom output.
+    std::string output{};
+
+    //! Whether to plot parameters in the log scale.
+    bool log_parameter{false};
+
+    //! Whether to plot custom outputs in the log scale.
+    bool log_output{false};
+
+    //! Whether to use the log scale of processing time in histograms and
+    //! plots of probability density.
+    bool log_time{true};
+
+    //! Parameter name used for columns of subplots.
+    std::string subplot_column_parameter{};
+
+    //! Parameter name used for rows of subplots.
+    std::string subplot_row_parameter{};
+};
+
+/*!
+ * \brief Struct of configuration of plots in groups.
+ */
+struct GroupPlotConfig {
+    //! Glob pattern of group names.
+    std::string group_pattern{"*"};
+
+    //! Plots.
+    std::vector<PlotConfig> plots{};
+};
+
+/*!
+ * \brief Struct of configuration of stat_bench_report.
+ */
+struct ReportConfig {
+    //! Whether to show help.
+    bool show_help{false};
+
+    //! Paths of data files.
+    std::vector<std::string> data_file_paths{};
+
+    //! Prefix of filepaths to generate plots.
+    std::string plot_prefix{};
+
+    //! Path of the configuration file.
+    std::string config_file_path{};
+
+    //! Maximum number of points per trace in plots of samples.
+    std::size_t plot_max_points{runner::impl::default_plot_max_points};
+
+    //! Number of threads to render plots. (Zero for the number of CPU cores.)
+    std::size_t plot_threads{0};
+
+    //! Indices of CPU cores to run threads rendering plots.
+    std::vector<std::size_t> plot_cpus{};
+
+    //! Number of samples in a case above which a plot of probability density
+    //! replaces the violin plot. (Zero for no replacement.)
+    std::size_t plot_density_threshold{0};
+
+    //! Parameter names of line plots of processing time.
+    std::vector<std::string> parameter_to_time_line_plots{};
+
+    //! Parameter names of violin plots of processing time.
+    std::vector<std::string> parameter_to_time_violin_plots{};
+
+    //! Parameter names of box plots of processing time.
+    std::vector<std::string> parameter_to_time_box_plots{};
+
+    //! Parameter names and custom output names of line plots of custom
+    //! outputs. (Separated by commas.)
+    std::vector<std::string> parameter_to_output_line_plots{};
+
+    //! Parameter names and custom output names of line plots of processing
+    //! time to custom outputs. (Separated by commas.)
+    std::vector<std::string> time_to_output_by_parameter_line_plots{};
+
+    //! Whether to plot parameters in the log scale in plots of command lines.
+    bool log_parameter{false};
+
+    //! Whether to plot custom outputs in the log scale in plots of command
+    //! lines.
+    bool log_output{false};
+
+    //! Configuration of plots in groups.
+    std::vector<GroupPlotConfig> groups{};
+};
+
+/*!
+ * \brief Create the parser of command line arguments.
+ *
+ * \param[out] config Configuration to which parsed values are written.
+ * \return Parser.
+ */
+[[nodiscard]] auto create_cli(ReportConfig& config) -> lyra::cli;
+
+/*!
+ * \brief Add plots specified in command line arguments to groups.
+ *
+ * Plots specified in command line arguments are applied to all groups.
+ *
+ * \param[in,out] config Configuration.
+ */
+void add_plots_in_command_line(ReportConfig& config);
+
+/*!
+ * \brief Read a configuration file and add plots in it to groups.
+ *
+ * \param[in] file_path File path.
+ * \param[in,out] config Configuration.
+ */
+void read_config_file(const std::string& file_path, ReportConfig& config);
+
+/*!
+ * \brief Create a plot.
+ *
+ * \param[in] config Configuration of the plot.
+ * \return Plot.
+ */
+[[nodiscard]] auto create_plot(const PlotConfig& config)
+    -> std::shared_ptr<plots::IPlot>;
+
+}  // namespace stat_bench::report
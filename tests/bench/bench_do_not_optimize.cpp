@@ -15,8 +15,11 @@
  */
 /*!
  * \file
- * \brief Benchmark of do_not_optimize function.
+ * \brief Benchmark of do_not_optimize, clobber_memory, and escape functions.
  */
+#include <array>
+#include <cstddef>
+
 #include <stat_bench/benchmark_macros.h>
 #include <stat_bench/do_not_optimize.h>
 
@@ -34,4 +37,53 @@ STAT_BENCH_CASE("do_not_optimize", "empty") {
     };
 }
 
+STAT_BENCH_CASE("do_not_optimize", "do_not_optimize (double)") {
+    double value = 1.0;
+    STAT_BENCH_MEASURE() {
+        value += 1.0;
+        stat_bench::do_not_optimize(value);
+    };
+}
+
+STAT_BENCH_CASE("do_not_optimize", "do_not_optimize (large)") {
+    std::array<double, 8> values{};  // NOLINT
+    STAT_BENCH_MEASURE() { stat_bench::do_not_optimize(values); };
+}
+
+STAT_BENCH_CASE("do_not_optimize", "clobber_memory") {
+    STAT_BENCH_MEASURE() { stat_bench::clobber_memory(); };
+}
+
+STAT_BENCH_CASE("do_not_optimize", "escape") {
+    int value = 0;
+    STAT_BENCH_MEASURE() { stat_bench::escape(&value); };
+}
+
+// Batch measurement removes the overhead of calls per iteration, so barriers
+// in this group are compared without the overhead.
+STAT_BENCH_CASE("do_not_optimize_batch", "do_not_optimize") {
+    STAT_BENCH_MEASURE_BATCH(
+        /*thread_index*/, /*sample_index*/, iterations) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            stat_bench::do_not_optimize(i);
+        }
+    };
+}
+
+STAT_BENCH_CASE("do_not_optimize_batch", "clobber_memory") {
+    STAT_BENCH_MEASURE_BATCH(
+        /*thread_index*/, /*sample_index*/, iterations) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            stat_bench::clobber_memory();
+        }
+    };
+}
+
+STAT_BENCH_CASE("do_not_optimize_batch", "empty") {
+    STAT_BENCH_MEASURE_BATCH(
+        /*thread_index*/, /*sample_index*/, iterations) {
+        stat_bench::do_not_optimize(iterations);
+    };
+}
+
 STAT_BENCH_MAIN
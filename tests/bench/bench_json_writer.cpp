@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmark of writers of JSON data files.
+ */
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#include <nlohmann/json.hpp>
+#include <stat_bench/benchmark_macros.h>
+#include <stat_bench/fixture_base.h>
+#include <stat_bench/invocation_context.h>
+#include <stat_bench/param/parameter_value_vector.h>
+#include <stat_bench/plot_options.h>
+#include <stat_bench/reporter/data_file_spec.h>
+#include <stat_bench/reporter/json_data_file_helper.h>
+#include <stat_bench/reporter/json_reporter.h>
+#include <stat_bench/util/utf8_string.h>
+
+class JsonWriterFixture : public stat_bench::FixtureBase {
+public:
+    JsonWriterFixture() {
+        // NOLINTNEXTLINE
+        add_param<std::size_t>("measurements")->add(1)->add(10)->add(100);
+    }
+
+    void setup(stat_bench::InvocationContext& context) override {
+        using stat_bench::reporter::data_file_spec::MeasurementData;
+        using stat_bench::util::Utf8String;
+
+        const auto num_measurements =
+            context.get_param<std::size_t>("measurements");
+        constexpr std::size_t num_samples = 1000;
+
+        data_ = stat_bench::reporter::data_file_spec::RootData();
+        data_.started_at = Utf8String("2026-01-01T00:00:00.000000+0000");
+        data_.finished_at = Utf8String("2026-01-01T00:00:01.000000+0000");
+        for (std::size_t i = 0; i < num_measurements; ++i) {
+            MeasurementData measurement;
+            measurement.group_name = Utf8String("Group");
+            measurement.case_name = Utf8String("Case" + std::to_string(i));
+            measurement.params.emplace(
+                Utf8String("threads"), Utf8String("1"));
+            measurement.measurement_type = Utf8String("Processing Time");
+            measurement.iterations = 1;
+            measurement.samples = num_samples;
+            measurement.durations.values.emplace_back();
+            for (std::size_t j = 0; j < num_samples; ++j) {
+                measurement.durations.values.front().push_back(
+                    1e-3F + 1e-7F * static_cast<float>(j));  // NOLINT
+            }
+            data_.measurements.push_back(std::move(measurement));
+        }
+    }
+
+protected:
+    //! Data.
+    stat_bench::reporter::data_file_spec::RootData data_{};
+
+    //! File path.
+    std::string file_path_{"./bench_json_writer.json"};
+};
+
+STAT_BENCH_CASE_F(JsonWriterFixture, "json_writer", "nlohmann_dom") {
+    STAT_BENCH_MEASURE() {
+        // Implementation used before the streaming writer.
+        std::ofstream stream{file_path_};
+        auto json_data = nlohmann::json(data_);
+        json_data["$schema"] = "schema";
+        stream << json_data.dump(2, ' ', true);
+    };
+}
+
+STAT_BENCH_CASE_F(JsonWriterFixture, "json_writer", "stream_pretty") {
+    stat_bench::reporter::JsonReporter reporter{
+        file_path_, stat_bench::reporter::JsonFormat::pretty};
+    STAT_BENCH_MEASURE() { reporter.write_data_file(file_path_, data_); };
+}
+
+STAT_BENCH_CASE_F(JsonWriterFixture, "json_writer", "stream_compact") {
+    stat_bench::reporter::JsonReporter reporter{
+        file_path_, stat_bench::reporter::JsonFormat::compact};
+    STAT_BENCH_MEASURE() { reporter.write_data_file(file_path_, data_); };
+}
+
+STAT_BENCH_GROUP("json_writer")
+    .add_parameter_to_time_line_plot(
+        "measurements", stat_bench::PlotOptions().log_parameter(true));
+
+STAT_BENCH_MAIN
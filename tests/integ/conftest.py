@@ -97,3 +97,9 @@ def subplots(bin_dir: pathlib.Path) -> pathlib.Path:
 def custom_measurement(bin_dir: pathlib.Path) -> pathlib.Path:
     """Get the path of executable stat_bench_test_integ_custom_measurement."""
     return bin_dir / "stat_bench_test_integ_custom_measurement"
+
+
+@pytest.fixture
+def stat_bench_report(bin_dir: pathlib.Path) -> pathlib.Path:
+    """Get the path of executable stat_bench_report."""
+    return bin_dir / "stat_bench_report"
@@ -0,0 +1,105 @@
+"""Test of stat_bench_report tool."""
+
+import json
+import pathlib
+import subprocess
+
+import pytest
+
+from .bench_executor import BenchExecutor
+
+
+@pytest.mark.parametrize(
+    "data_file_option,data_file_name",
+    [
+        ("--json", "data.json"),
+        ("--msgpack", "data.data"),
+        ("--compressed-msgpack", "data.data.gz"),
+    ],
+)
+def test_plot_from_data_file(
+    bench_executor: BenchExecutor,
+    parametrized_benchmark: pathlib.Path,
+    stat_bench_report: pathlib.Path,
+    data_file_option: str,
+    data_file_name: str,
+) -> None:
+    """Test to generate plots from data files."""
+    test_dir = bench_executor.temp_test_dir / bench_executor.test_name
+    test_dir.mkdir(parents=True, exist_ok=True)
+    data_file_path = test_dir / data_file_name
+    result = bench_executor.execute(
+        parametrized_benchmark,
+        data_file_option,
+        str(data_file_path),
+        verify=False,
+    )
+    assert result.returncode == 0
+
+    config_file_path = test_dir / "config.json"
+    with open(str(config_file_path), mode="w", encoding="utf-8") as file:
+        json.dump(
+            {
+                "groups": [
+                    {
+                        "name": "Fibonacci*",
+                        "plots": [
+                            {
+                                "type": "parameter_to_output_line_plot",
+                                "parameter": "number",
+                                "output": "result",
+                                "log_output": True,
+                            }
+                        ],
+                    }
+                ]
+            },
+            file,
+        )
+
+    plot_dir = test_dir / "plots"
+    result = subprocess.run(
+        [
+            str(stat_bench_report),
+            str(data_file_path),
+            "--plot",
+            str(plot_dir),
+            "--config",
+            str(config_file_path),
+            "--parameter_to_time_line",
+            "number",
+        ],
+        check=False,
+        stdout=subprocess.PIPE,
+        stderr=subprocess.PIPE,
+        encoding="utf8",
+    )
+
+    assert result.returncode == 0, result.stderr
+    group_dir = plot_dir / "FibonacciParametrized"
+    assert (group_dir / "ProcessingTime_samples.html").exists()
+    assert (group_dir / "ProcessingTime_cdf.html").exists()
+    assert (group_dir / "ProcessingTime_violin.html").exists()
+    assert (group_dir / "ProcessingTime_box.html").exists()
+    assert (group_dir / "ProcessingTime_by_number.html").exists()
+    assert (group_dir / "ProcessingTime_result_by_number.html").exists()
+    assert (group_dir / "MeanProcessingTime_by_number.html").exists()
+    assert (group_dir / "MeanProcessingTime_result_by_number.html").exists()
+    # Plots by parameters which don't exist in groups are skipped.
+    assert (plot_dir / "VectorPushBackParametrized").exists()
+    assert not (
+        plot_dir / "VectorPushBackParametrized" / "ProcessingTime_by_number.html"
+    ).exists()
+
+
+def test_no_data_file(stat_bench_report: pathlib.Path) -> None:
+    """Test to execute without data files."""
+    result = subprocess.run(
+        [str(stat_bench_report), "--plot", "plots"],
+        check=False,
+        stdout=subprocess.PIPE,
+        stderr=subprocess.PIPE,
+        encoding="utf8",
+    )
+
+    assert result.returncode != 0
@@ -13,7 +13,7 @@ from .bench_executor import BenchExecutor
 
 THIS_DIR = pathlib.Path(__file__).absolute().parent
 SCHEMAS_DIR = THIS_DIR.parent.parent / "schemas"
-CURRENT_SCHEMA_FILE = SCHEMAS_DIR / "data_file_schema_v4.json"
+CURRENT_SCHEMA_FILE = SCHEMAS_DIR / "data_file_schema_v5.json"
 
 
 @pytest.fixture
@@ -406,6 +406,30 @@ class TestJson:
             data = json.load(data_file)
         data_file_schema_validate(data)
 
+    def test_json_compact(
+        self,
+        bench_executor: BenchExecutor,
+        parametrized_benchmark: pathlib.Path,
+        data_file_schema_validate: typing.Callable,
+    ) -> None:
+        """Test of JSON output in compact format."""
+        result = bench_executor.execute(
+            parametrized_benchmark,
+            "--json",
+            f"{bench_executor.test_name}.json",
+            "--json_compact",
+            verify=False,
+        )
+
+        assert result.returncode == 0
+        data_path = bench_executor.temp_test_dir / f"{bench_executor.test_name}.json"
+        assert data_path.exists()
+        with open(data_path, mode="r", encoding="utf-8") as data_file:
+            contents = data_file.read()
+        assert "\n" not in contents
+        data = json.loads(contents)
+        data_file_schema_validate(data)
+
 
 class TestMsgPack:
     """Test of MsgPack output."""
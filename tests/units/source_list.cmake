@@ -14,39 +14,69 @@ set(SOURCE_FILES
     stat_bench/filters/regex_filter_test.cpp
     stat_bench/fixture_base_test.cpp
     stat_bench/invocation_context_test.cpp
+    stat_bench/measurer/analyze_thread_scaling_test.cpp
+    stat_bench/measurer/fit_iteration_regression_test.cpp
     stat_bench/measurer/measurement_test.cpp
     stat_bench/measurer/measurer_test.cpp
     stat_bench/memory_barrier_test.cpp
+    stat_bench/param/adaptive_refinement_test.cpp
+    stat_bench/param/auto_num_threads_test.cpp
     stat_bench/param/parameter_config_test.cpp
     stat_bench/param/parameter_dict_test.cpp
     stat_bench/param/parameter_generator_test.cpp
+    stat_bench/param/parameter_sampling_test.cpp
     stat_bench/param/parameter_value_test.cpp
     stat_bench/param/parameter_value_vector_test.cpp
     stat_bench/plots/box_plot_test.cpp
     stat_bench/plots/cdf_line_plot_test.cpp
+    stat_bench/plots/decimate_samples_test.cpp
+    stat_bench/plots/density_plot_test.cpp
+    stat_bench/plots/histogram_plot_test.cpp
+    stat_bench/plots/iteration_regression_plot_test.cpp
     stat_bench/plots/parameter_to_output_line_plot_test.cpp
     stat_bench/plots/parameter_to_time_box_plot_test.cpp
     stat_bench/plots/parameter_to_time_line_plot_test.cpp
     stat_bench/plots/parameter_to_time_violin_plot_test.cpp
     stat_bench/plots/plot_utils_test.cpp
     stat_bench/plots/samples_line_plot_test.cpp
+    stat_bench/plots/thread_scaling_plot_test.cpp
     stat_bench/plots/time_to_output_by_parameter_line_plot_test.cpp
     stat_bench/plots/violin_plot_test.cpp
+    stat_bench/repeat_unrolled_test.cpp
+    stat_bench/reporter/async_reporter_test.cpp
     stat_bench/reporter/compressed_msgpack_reporter_test.cpp
     stat_bench/reporter/console_reporter_test.cpp
+    stat_bench/reporter/data_file_helper_test.cpp
+    stat_bench/reporter/data_file_reader_test.cpp
     stat_bench/reporter/json_data_file_helper_test.cpp
     stat_bench/reporter/json_reporter_test.cpp
     stat_bench/reporter/msgpack_reporter_test.cpp
     stat_bench/reporter/plot_reporter_test.cpp
+    stat_bench/reporter/replay_measurements_test.cpp
     stat_bench/runner/command_line_parser_test.cpp
+    stat_bench/runner/runner_test.cpp
     stat_bench/stat/calc_stat_test.cpp
+    stat_bench/stat/complexity_fit_test.cpp
     stat_bench/stat/custom_stat_output_test.cpp
+    stat_bench/stat/density_estimation_test.cpp
+    stat_bench/stat/drift_diagnostics_test.cpp
+    stat_bench/stat/linear_regression_test.cpp
+    stat_bench/stat/scalability_fit_test.cpp
+    stat_bench/stat/steady_state_test.cpp
+    stat_bench/util/aligned_buffer_test.cpp
+    stat_bench/util/buffered_file_writer_test.cpp
+    stat_bench/util/cache_evictor_test.cpp
+    stat_bench/util/cache_sizes_test.cpp
     stat_bench/util/check_glob_pattern_test.cpp
+    stat_bench/util/cpu_topology_test.cpp
     stat_bench/util/escape_for_file_name_test.cpp
     stat_bench/util/escape_for_html_test.cpp
     stat_bench/util/ordered_map_test.cpp
+    stat_bench/util/parallel_gzip_writer_test.cpp
     stat_bench/util/prepare_directory_test.cpp
+    stat_bench/util/spsc_queue_test.cpp
     stat_bench/util/sync_barrier_test.cpp
     stat_bench/util/utf8_string_test.cpp
+    stat_bench/util/worker_pool_test.cpp
     test_main.cpp
 )
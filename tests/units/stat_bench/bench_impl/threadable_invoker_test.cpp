@@ -19,12 +19,17 @@
  */
 #include "stat_bench/bench_impl/threadable_invoker.h"
 
+#include <chrono>
+#include <cstddef>
 #include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 #include <catch2/catch_message.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
 TEST_CASE("stat_bench::bench_impl::ThreadableInvoker") {
     SECTION("measure using single thread") {
@@ -127,6 +132,164 @@ TEST_CASE("stat_bench::bench_impl::ThreadableInvoker") {
             }));
     }
 
+    SECTION("measure batch functions") {
+        const std::size_t threads = GENERATE(1, 2);
+        constexpr std::size_t iterations = 7;
+        constexpr std::size_t samples = 13;
+        constexpr std::size_t warm_up_samples = 5;
+
+        const stat_bench::bench_impl::ThreadableInvoker invoker{
+            threads, iterations, samples, warm_up_samples};
+
+        std::vector<std::tuple<std::size_t, std::size_t, std::size_t>>
+            invocations;
+        std::mutex mutex;
+        const auto func = [&invocations, &mutex](std::size_t thread_index,
+                              std::size_t sample_index,
+                              std::size_t num_iterations) {
+            std::unique_lock<std::mutex> lock(mutex);
+            invocations.emplace_back(
+                thread_index, sample_index, num_iterations);
+        };
+        const auto durations = invoker.measure(
+            stat_bench::bench_impl::BatchFunction<decltype(func)>{func});
+
+        REQUIRE(invocations.size() == threads * samples);
+        for (const auto& [thread_index, sample_index, num_iterations] :
+            invocations) {
+            CHECK(thread_index < threads);
+            CHECK(sample_index < samples);
+            CHECK(num_iterations == iterations);
+        }
+        REQUIRE(durations.size() == threads);
+        REQUIRE(durations.at(0).size() == samples - warm_up_samples);
+    }
+
+    SECTION("measure with linearly increasing iterations") {
+        const std::size_t threads = GENERATE(1, 2);
+        constexpr std::size_t iterations = 3;
+        constexpr std::size_t samples = 7;
+        constexpr std::size_t warm_up_samples = 2;
+
+        const stat_bench::bench_impl::ThreadableInvoker invoker{
+            threads, iterations, samples, warm_up_samples, true};
+
+        std::vector<std::tuple<std::size_t, std::size_t, std::size_t>>
+            invocations;
+        std::mutex mutex;
+        const auto func = [&invocations, &mutex](std::size_t thread_index,
+                              std::size_t sample_index,
+                              std::size_t num_iterations) {
+            std::unique_lock<std::mutex> lock(mutex);
+            invocations.emplace_back(
+                thread_index, sample_index, num_iterations);
+        };
+        const auto durations = invoker.measure(
+            stat_bench::bench_impl::BatchFunction<decltype(func)>{func});
+
+        REQUIRE(invocations.size() == threads * samples);
+        for (const auto& [thread_index, sample_index, num_iterations] :
+            invocations) {
+            if (sample_index < warm_up_samples) {
+                CHECK(num_iterations == iterations);
+            } else {
+                CHECK(num_iterations ==
+                    (sample_index - warm_up_samples + 1) * iterations);
+            }
+        }
+        REQUIRE(durations.size() == threads);
+        REQUIRE(durations.at(0).size() == samples - warm_up_samples);
+    }
+
+    SECTION("setup threads before measurement") {
+        constexpr std::size_t threads = 3;
+        constexpr std::size_t iterations = 7;
+        constexpr std::size_t samples = 13;
+        constexpr std::size_t warm_up_samples = 5;
+
+        const stat_bench::bench_impl::ThreadableInvoker invoker{
+            threads, iterations, samples, warm_up_samples};
+
+        std::vector<std::thread::id> setup_thread_ids(threads);
+        std::vector<std::thread::id> measured_thread_ids(threads);
+        std::mutex mutex;
+        std::size_t num_invocations_before_setup = 0;
+        std::size_t num_setups = 0;
+        const auto durations = invoker.measure(
+            [&](std::size_t thread_index, std::size_t /*sample_index*/,
+                std::size_t /*iteration_index*/) {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (num_setups < threads) {
+                    ++num_invocations_before_setup;
+                }
+                measured_thread_ids.at(thread_index) =
+                    std::this_thread::get_id();
+            },
+            [&](std::size_t thread_index) {
+                std::unique_lock<std::mutex> lock(mutex);
+                ++num_setups;
+                setup_thread_ids.at(thread_index) = std::this_thread::get_id();
+            });
+
+        REQUIRE(num_setups == threads);
+        REQUIRE(num_invocations_before_setup == 0);
+        REQUIRE(setup_thread_ids == measured_thread_ids);
+        REQUIRE(durations.size() == threads);
+    }
+
+    SECTION("prepare samples") {
+        const std::size_t threads = GENERATE(1, 2);
+        constexpr std::size_t iterations = 1;
+        constexpr std::size_t samples = 5;
+        constexpr std::size_t warm_up_samples = 1;
+
+        const stat_bench::bench_impl::ThreadableInvoker invoker{
+            threads, iterations, samples, warm_up_samples};
+
+        std::vector<std::size_t> num_preparations(threads, 0);
+        const auto durations = invoker.measure(
+            [](std::size_t /*thread_index*/, std::size_t /*sample_index*/,
+                std::size_t /*iteration_index*/) {},
+            [](std::size_t /*thread_index*/) {},
+            [&num_preparations](std::size_t thread_index) {
+                ++num_preparations.at(thread_index);
+                std::this_thread::sleep_for(
+                    std::chrono::milliseconds(10));  // NOLINT
+            });
+
+        REQUIRE(durations.size() == threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            INFO("i = " << i);
+            CHECK(num_preparations.at(i) == samples);
+            REQUIRE(durations.at(i).size() == samples - warm_up_samples);
+            for (const auto& duration : durations.at(i)) {
+                // Time of preparation is excluded.
+                CHECK(duration.seconds() < 0.005);  // NOLINT
+            }
+        }
+    }
+
+    SECTION("error in setup of threads") {
+        const std::size_t threads = GENERATE(1, 3);
+        constexpr std::size_t iterations = 7;
+        constexpr std::size_t samples = 13;
+        constexpr std::size_t warm_up_samples = 5;
+
+        const stat_bench::bench_impl::ThreadableInvoker invoker{
+            threads, iterations, samples, warm_up_samples};
+
+        REQUIRE_THROWS_AS(
+            invoker.measure(
+                [](std::size_t /*thread_index*/, std::size_t /*sample_index*/,
+                    std::size_t /*iteration_index*/) {},
+                [](std::size_t thread_index) {
+                    if (thread_index == 0) {
+                        throw std::runtime_error("Test exception.");
+                    }
+                }),
+            std::runtime_error);
+    }
+
     SECTION("invalid arguments") {
         REQUIRE_THROWS(
             (void)stat_bench::bench_impl::ThreadableInvoker(0, 1, 1, 0));
@@ -50,6 +50,30 @@ TEST_CASE("stat_bench::clock::StopWatch", "[!mayfail]") {
         }
     }
 
+    SECTION("exclude time before restart of laps") {
+        constexpr unsigned int duration_ms = 10;
+        constexpr double duration_sec = 0.01;
+        constexpr std::size_t num_laps = 3;
+
+        stat_bench::clock::StopWatch watch;
+        watch.start(num_laps);
+        for (std::size_t i = 0; i < num_laps; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(duration_ms));
+            watch.restart_lap();
+            std::this_thread::sleep_for(std::chrono::milliseconds(duration_ms));
+            watch.lap();
+        }
+        const auto durations = watch.calc_durations();
+
+        REQUIRE(durations.size() == num_laps);
+        for (std::size_t i = 0; i < num_laps; ++i) {
+            INFO("i = " << i);
+            constexpr double tol = 0.9;
+            CHECK_THAT(durations.at(i).seconds(),
+                Catch::Matchers::WithinRel(duration_sec, tol));
+        }
+    }
+
     SECTION("lack of samples") {
         constexpr std::size_t num_laps = 7;
 
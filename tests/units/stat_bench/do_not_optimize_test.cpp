@@ -15,10 +15,13 @@
  */
 /*!
  * \file
- * \brief Test of do_not_optimize function.
+ * \brief Test of do_not_optimize, clobber_memory, and escape functions.
  */
 #include "stat_bench/do_not_optimize.h"
 
+#include <array>
+#include <string>
+
 #include <catch2/catch_test_macros.hpp>
 
 TEST_CASE("stat_bench::do_not_optimize") {
@@ -26,4 +29,67 @@ TEST_CASE("stat_bench::do_not_optimize") {
         int val = 0;
         REQUIRE_NOTHROW(stat_bench::do_not_optimize(val));
     }
+
+    SECTION("use values of various types") {
+        int val = 1;
+        stat_bench::do_not_optimize(val);
+        REQUIRE(val == 1);
+
+        const double const_val = 1.5;
+        stat_bench::do_not_optimize(const_val);
+
+        stat_bench::do_not_optimize(val + 1);
+
+        std::array<int, 16> large_val{};  // NOLINT
+        large_val[3] = 5;                 // NOLINT
+        stat_bench::do_not_optimize(large_val);
+        REQUIRE(large_val[3] == 5);  // NOLINT
+
+        std::string str = "abc";
+        stat_bench::do_not_optimize(str);
+        REQUIRE(str == "abc");
+
+        int* ptr = &val;
+        stat_bench::do_not_optimize(ptr);
+        REQUIRE(ptr == &val);
+    }
+
+    SECTION("use aggregates of sizes other than sizes of registers") {
+        std::array<char, 3> val3{'a', 'b', 'c'};
+        stat_bench::do_not_optimize(val3);
+        REQUIRE(val3[2] == 'c');
+
+        std::array<char, 5> val5{'a', 'b', 'c', 'd', 'e'};  // NOLINT
+        stat_bench::do_not_optimize(val5);
+        REQUIRE(val5[4] == 'e');  // NOLINT
+
+        std::array<char, 6> val6{};  // NOLINT
+        val6[5] = 'f';               // NOLINT
+        stat_bench::do_not_optimize(val6);
+        REQUIRE(val6[5] == 'f');  // NOLINT
+
+        struct Odd {
+            char c1;
+            char c2;
+            char c3;
+            char c4;
+            char c5;
+            char c6;
+            char c7;
+        };
+        Odd val7{'a', 'b', 'c', 'd', 'e', 'f', 'g'};  // NOLINT
+        stat_bench::do_not_optimize(val7);
+        REQUIRE(val7.c7 == 'g');
+
+        const std::array<char, 3> const_val3{'a', 'b', 'c'};
+        stat_bench::do_not_optimize(const_val3);
+    }
+}
+
+TEST_CASE("stat_bench::clobber_memory") {
+    int val = 1;
+    stat_bench::escape(&val);
+    val = 2;
+    stat_bench::clobber_memory();
+    REQUIRE(val == 2);
 }
@@ -21,6 +21,9 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <trompeloeil.hpp>
@@ -29,7 +32,74 @@
 #include "param/create_ordinary_parameter_dict.h"
 #include "stat_bench/bench_impl/i_benchmark_case.h"
 #include "stat_bench/bench_impl/invocation_context_registry.h"
+#include "stat_bench/benchmark_case_name.h"
 #include "stat_bench/benchmark_condition.h"
+#include "stat_bench/benchmark_full_name.h"
+#include "stat_bench/benchmark_group_name.h"
+#include "stat_bench/invocation_context.h"
+#include "stat_bench/param/num_threads_parameter_name.h"
+#include "stat_bench/param/parameter_dict.h"
+#include "stat_bench/param/parameter_name.h"
+#include "stat_bench/param/parameter_value.h"
+#include "stat_bench/util/ordered_map.h"
+
+namespace {
+
+class LifecycleFixture final : public stat_bench::FixtureBase {
+public:
+    LifecycleFixture() = default;
+
+    [[nodiscard]] auto info() const noexcept
+        -> const stat_bench::BenchmarkFullName& override {
+        return info_;
+    }
+
+    void setup_once(stat_bench::InvocationContext& context) override {
+        events.push_back("setup_once(size=" +
+            std::to_string(context.get_param<std::size_t>("size")) + ")");
+    }
+
+    void tear_down_once() override { events.emplace_back("tear_down_once"); }
+
+    void reset(stat_bench::InvocationContext& /*context*/) override {
+        events.emplace_back("reset");
+    }
+
+    void setup(stat_bench::InvocationContext& /*context*/) override {
+        events.emplace_back("setup");
+    }
+
+    void tear_down(stat_bench::InvocationContext& /*context*/) override {
+        events.emplace_back("tear_down");
+    }
+
+    void run() override { events.emplace_back("run"); }
+
+    std::vector<std::string> events{};  // NOLINT
+
+private:
+    stat_bench::BenchmarkFullName info_{stat_bench::BenchmarkGroupName("Group"),
+        stat_bench::BenchmarkCaseName("Case")};
+};
+
+void execute_with_size(
+    stat_bench::bench_impl::IBenchmarkCase& bench_case, std::size_t size) {
+    stat_bench::util::OrderedMap<stat_bench::param::ParameterName,
+        stat_bench::param::ParameterValue>
+        data;
+    data.try_emplace(stat_bench::param::num_threads_parameter_name(),
+        stat_bench::param::ParameterValue().emplace<std::size_t>(1));
+    data.try_emplace(stat_bench::param::ParameterName("size"),
+        stat_bench::param::ParameterValue().emplace<std::size_t>(size));
+    stat_bench::bench_impl::InvocationContextRegistry::instance().create(
+        stat_bench::BenchmarkCondition(
+            stat_bench::param::ParameterDict(std::move(data))),
+        1, 1, 0);
+    bench_case.execute();
+    stat_bench::bench_impl::InvocationContextRegistry::instance().clear();
+}
+
+}  // namespace
 
 TEST_CASE("stat_bench::FixtureBase") {
     stat_bench_test::MockFixture fixture;
@@ -73,3 +143,33 @@ TEST_CASE("stat_bench::FixtureBase") {
 
     stat_bench::bench_impl::InvocationContextRegistry::instance().clear();
 }
+
+TEST_CASE("stat_bench::FixtureBase (setup_once)") {
+    LifecycleFixture fixture;
+    stat_bench::bench_impl::IBenchmarkCase& fixture_as_case = fixture;
+
+    SECTION("reuse the state for the same condition") {
+        execute_with_size(fixture_as_case, 1);
+        execute_with_size(fixture_as_case, 1);
+        execute_with_size(fixture_as_case, 2);
+        fixture_as_case.release_cached_resources();
+        fixture_as_case.release_cached_resources();
+
+        CHECK(fixture.events ==
+            std::vector<std::string>{"setup_once(size=1)", "reset", "setup",
+                "run", "tear_down", "reset", "setup", "run", "tear_down",
+                "tear_down_once", "setup_once(size=2)", "reset", "setup", "run",
+                "tear_down", "tear_down_once"});
+    }
+
+    SECTION("setup again after releasing the state") {
+        execute_with_size(fixture_as_case, 1);
+        fixture_as_case.release_cached_resources();
+        execute_with_size(fixture_as_case, 1);
+
+        CHECK(fixture.events ==
+            std::vector<std::string>{"setup_once(size=1)", "reset", "setup",
+                "run", "tear_down", "tear_down_once", "setup_once(size=1)",
+                "reset", "setup", "run", "tear_down"});
+    }
+}
@@ -19,9 +19,11 @@
  */
 #include "stat_bench/invocation_context.h"
 
+#include <cstdint>
 #include <mutex>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <catch2/catch_message.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -29,6 +31,7 @@
 #include "param/create_ordinary_parameter_dict.h"
 #include "stat_bench/custom_output_name.h"
 #include "stat_bench/param/num_threads_parameter_name.h"
+#include "stat_bench/stat_bench_exception.h"
 
 TEST_CASE("stat_bench::InvocationContext") {
     SECTION("construct") {
@@ -121,6 +124,144 @@ TEST_CASE("stat_bench::InvocationContext") {
         REQUIRE(durations.at(0).size() == samples - warming_up_samples);
     }
 
+    SECTION("measure durations of batch functions") {
+        constexpr std::size_t threads = 1;
+        constexpr std::size_t iterations = 7;
+        constexpr std::size_t samples = 13;
+        constexpr std::size_t warming_up_samples = 1;
+        stat_bench::InvocationContext context{
+            stat_bench::BenchmarkCondition(threads,
+                stat_bench_test::param::create_ordinary_parameter_dict()),
+            iterations, samples, warming_up_samples};
+
+        std::size_t total_iterations = 0;
+        context.measure_batch([&total_iterations](std::size_t /*thread_index*/,
+                                  std::size_t /*sample_index*/,
+                                  std::size_t num_iterations) {
+            total_iterations += num_iterations;
+        });
+
+        REQUIRE(total_iterations == iterations * samples);
+        const auto durations = context.durations();
+        REQUIRE(durations.size() == threads);
+        REQUIRE(durations.at(0).size() == samples - warming_up_samples);
+    }
+
+    SECTION("setup threads with states") {
+        constexpr std::size_t threads = 2;
+        constexpr std::size_t iterations = 7;
+        constexpr std::size_t samples = 13;
+        constexpr std::size_t warming_up_samples = 1;
+        stat_bench::InvocationContext context{
+            stat_bench::BenchmarkCondition(threads,
+                stat_bench_test::param::create_ordinary_parameter_dict()),
+            iterations, samples, warming_up_samples};
+
+        CHECK_THROWS_AS(
+            context.thread_state<int>(0), stat_bench::StatBenchException);
+
+        context.set_thread_setup([&context](std::size_t thread_index) {
+            context.emplace_thread_state<int>(
+                thread_index, static_cast<int>(thread_index) + 1);
+        });
+        std::vector<int> sums(threads, 0);
+        context.measure([&context, &sums](std::size_t thread_index,
+                            std::size_t /*sample_index*/,
+                            std::size_t /*iteration_index*/) {
+            sums.at(thread_index) += context.thread_state<int>(thread_index);
+        });
+
+        REQUIRE(sums.at(0) == 1 * iterations * samples);
+        REQUIRE(sums.at(1) == 2 * iterations * samples);
+        REQUIRE(context.thread_state<int>(1) == 2);
+    }
+
+    SECTION("allocate buffers") {
+        constexpr std::size_t threads = 1;
+        constexpr std::size_t iterations = 7;
+        constexpr std::size_t samples = 13;
+        constexpr std::size_t warming_up_samples = 1;
+        stat_bench::InvocationContext context{
+            stat_bench::BenchmarkCondition(threads,
+                stat_bench_test::param::create_ordinary_parameter_dict()),
+            iterations, samples, warming_up_samples};
+
+        stat_bench::util::BufferOptions options;
+        options.alignment = 4096;  // NOLINT
+        options.offset = 8;        // NOLINT
+        options.prefault = true;
+        constexpr std::size_t size = 100;
+        auto* array = context.allocate_array<double>(size, options);
+
+        const auto address = reinterpret_cast<std::uintptr_t>(array);  // NOLINT
+        CHECK(address % options.alignment == options.offset);
+        CHECK(array[size - 1U] == 0.0);  // NOLINT
+
+        context.release_buffers();
+    }
+
+    SECTION("measure durations with cold caches") {
+        constexpr std::size_t threads = 1;
+        constexpr std::size_t iterations = 1;
+        constexpr std::size_t samples = 5;
+        constexpr std::size_t warming_up_samples = 1;
+        stat_bench::InvocationContext context{
+            stat_bench::BenchmarkCondition(threads,
+                stat_bench_test::param::create_ordinary_parameter_dict()),
+            iterations, samples, warming_up_samples};
+
+        std::vector<double> data(1000, 1.0);  // NOLINT
+        context.set_cold_cache(true);
+        context.add_buffer_to_flush(data.data(), data.size() * sizeof(double));
+        REQUIRE(context.cold_cache());
+        context.measure([&data](std::size_t /*thread_index*/,
+                            std::size_t /*sample_index*/,
+                            std::size_t /*iteration_index*/) {
+            return data.front();
+        });
+
+        const auto durations = context.durations();
+        REQUIRE(durations.size() == threads);
+        REQUIRE(durations.at(0).size() == samples - warming_up_samples);
+    }
+
+    SECTION("measure durations with cold caches without buffers") {
+        constexpr std::size_t threads = 1;
+        constexpr std::size_t iterations = 1;
+        constexpr std::size_t samples = 3;
+        constexpr std::size_t warming_up_samples = 1;
+        stat_bench::InvocationContext context{
+            stat_bench::BenchmarkCondition(threads,
+                stat_bench_test::param::create_ordinary_parameter_dict()),
+            iterations, samples, warming_up_samples};
+
+        context.set_cold_cache(true);
+        context.measure([](std::size_t /*thread_index*/,
+                            std::size_t /*sample_index*/,
+                            std::size_t /*iteration_index*/) { return 0; });
+
+        const auto durations = context.durations();
+        REQUIRE(durations.size() == threads);
+        REQUIRE(durations.at(0).size() == samples - warming_up_samples);
+    }
+
+    SECTION("reject cold caches in multiple threads") {
+        constexpr std::size_t threads = 2;
+        constexpr std::size_t iterations = 1;
+        constexpr std::size_t samples = 5;
+        constexpr std::size_t warming_up_samples = 1;
+        stat_bench::InvocationContext context{
+            stat_bench::BenchmarkCondition(threads,
+                stat_bench_test::param::create_ordinary_parameter_dict()),
+            iterations, samples, warming_up_samples};
+
+        context.set_cold_cache(true);
+        const auto func = [](std::size_t /*thread_index*/,
+                              std::size_t /*sample_index*/,
+                              std::size_t /*iteration_index*/) { return 0; };
+        CHECK_THROWS_AS(context.measure(func), stat_bench::StatBenchException);
+    }
+
     SECTION("add custom output with statistics") {
         constexpr std::size_t threads = 2;
         constexpr std::size_t iterations = 7;
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of analyze_thread_scaling function.
+ */
+#include "stat_bench/measurer/analyze_thread_scaling.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "stat_bench/benchmark_case_name.h"
+#include "stat_bench/benchmark_condition.h"
+#include "stat_bench/benchmark_full_name.h"
+#include "stat_bench/benchmark_group_name.h"
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/custom_output_name.h"
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/measurer/measurement_type.h"
+#include "stat_bench/param/auto_num_threads.h"
+#include "stat_bench/param/num_threads_parameter_name.h"
+#include "stat_bench/param/parameter_dict.h"
+#include "stat_bench/param/parameter_value.h"
+#include "stat_bench/stat/custom_stat_output.h"
+
+namespace {
+
+/*!
+ * \brief Create a measurement.
+ *
+ * \param[in] case_name Case name.
+ * \param[in] num_threads Number of threads.
+ * \param[in] placement Placement of threads.
+ * \param[in] time Duration in every sample.
+ * \return Measurement.
+ */
+[[nodiscard]] auto create_measurement(const std::string& case_name,
+    std::size_t num_threads, const std::string& placement, double time)
+    -> std::shared_ptr<const stat_bench::measurer::Measurement> {
+    using stat_bench::BenchmarkCaseName;
+    using stat_bench::BenchmarkCondition;
+    using stat_bench::BenchmarkFullName;
+    using stat_bench::BenchmarkGroupName;
+    using stat_bench::clock::Duration;
+    using stat_bench::measurer::Measurement;
+    using stat_bench::measurer::MeasurementType;
+    using stat_bench::param::num_threads_parameter_name;
+    using stat_bench::param::ParameterDict;
+    using stat_bench::param::ParameterValue;
+    using stat_bench::param::expected_placement_parameter_name;
+
+    const auto params = ParameterDict(
+        {{num_threads_parameter_name(),
+             ParameterValue().emplace<std::size_t>(num_threads)},
+            {expected_placement_parameter_name(),
+                ParameterValue().emplace<std::string>(placement)}});
+    constexpr std::size_t iterations = 1;
+    constexpr std::size_t samples = 2;
+    return std::make_shared<const Measurement>(
+        BenchmarkFullName(
+            BenchmarkGroupName("Group"), BenchmarkCaseName(case_name)),
+        BenchmarkCondition(params), MeasurementType("Measurer"), iterations,
+        samples,
+        std::vector<std::vector<Duration>>(
+            num_threads, std::vector<Duration>(samples, Duration(time))),
+        std::vector<std::shared_ptr<stat_bench::stat::CustomStatOutput>>{},
+        std::vector<std::pair<stat_bench::CustomOutputName, double>>{});
+}
+
+}  // namespace
+
+TEST_CASE("stat_bench::measurer::analyze_thread_scaling") {
+    using Catch::Matchers::WithinRel;
+    using stat_bench::measurer::analyze_thread_scaling;
+    using stat_bench::measurer::Measurement;
+
+    SECTION("analyze cases") {
+        const std::vector<std::shared_ptr<const Measurement>> measurements{
+            create_measurement("Case1", 4, "smt", 2.0),    // NOLINT
+            create_measurement("Case1", 1, "cores", 1.0),  // NOLINT
+            create_measurement("Case1", 2, "cores", 1.0),  // NOLINT
+            create_measurement("Case2", 2, "cores", 1.0),  // NOLINT
+        };
+
+        const auto results = analyze_thread_scaling(measurements);
+
+        REQUIRE(results.size() == 1);
+        const auto& result = results.front();
+        CHECK(result.case_name.str().str() == "Case1");
+        CHECK(result.params.empty());
+        REQUIRE(result.points.size() == 3);
+        CHECK(result.points.at(0).num_threads == 1);
+        CHECK_THAT(result.points.at(0).throughput, WithinRel(1.0));
+        CHECK_THAT(result.points.at(0).speedup, WithinRel(1.0));
+        CHECK_THAT(result.points.at(0).efficiency, WithinRel(1.0));
+        CHECK(result.points.at(1).num_threads == 2);
+        CHECK_THAT(result.points.at(1).throughput, WithinRel(2.0));
+        CHECK_THAT(result.points.at(1).speedup, WithinRel(2.0));
+        CHECK_THAT(result.points.at(1).efficiency, WithinRel(1.0));
+        CHECK(result.points.at(2).num_threads == 4);
+        CHECK_THAT(result.points.at(2).throughput, WithinRel(2.0));
+        CHECK_THAT(result.points.at(2).speedup, WithinRel(2.0));
+        CHECK_THAT(result.points.at(2).efficiency, WithinRel(0.5));
+        CHECK(result.usl.coherency > 0.0);
+    }
+
+    SECTION("analyze no measurement") {
+        const auto results = analyze_thread_scaling({});
+
+        CHECK(results.empty());
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of fit_iteration_regression function.
+ */
+#include "stat_bench/measurer/fit_iteration_regression.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/stat_bench_exception.h"
+
+TEST_CASE("stat_bench::measurer::fit_iteration_regression") {
+    using Catch::Matchers::WithinAbs;
+    using Catch::Matchers::WithinRel;
+    using stat_bench::clock::Duration;
+    using stat_bench::measurer::fit_iteration_regression;
+
+    SECTION("fit durations in threads") {
+        constexpr std::size_t base_iterations = 4;
+        constexpr std::size_t samples = 5;
+        constexpr double time_per_iteration = 1e-6;
+        constexpr double overhead = 2e-7;
+        constexpr double difference_of_threads = 1e-7;
+        std::vector<std::vector<Duration>> durations(2);
+        for (std::size_t i = 0; i < samples; ++i) {
+            const double base_time = time_per_iteration *
+                    static_cast<double>((i + 1) * base_iterations) +
+                overhead;
+            durations[0].emplace_back(base_time - difference_of_threads);
+            durations[1].emplace_back(base_time + difference_of_threads);
+        }
+
+        const auto result =
+            fit_iteration_regression(durations, base_iterations);
+
+        REQUIRE(result.iterations.size() == samples);
+        REQUIRE(result.durations.size() == samples);
+        CHECK_THAT(result.iterations.front(), WithinRel(4.0));
+        CHECK_THAT(result.iterations.back(), WithinRel(20.0));  // NOLINT
+        CHECK_THAT(result.durations.front(), WithinRel(4.2e-6));  // NOLINT
+        CHECK_THAT(result.ordinary_least_squares.slope,
+            WithinRel(time_per_iteration, 1e-6));  // NOLINT
+        CHECK_THAT(result.ordinary_least_squares.intercept,
+            WithinAbs(overhead, 1e-12));  // NOLINT
+        CHECK_THAT(
+            result.theil_sen.slope, WithinRel(time_per_iteration, 1e-6));
+        CHECK_THAT(result.theil_sen.intercept, WithinAbs(overhead, 1e-12));
+    }
+
+    SECTION("no duration") {
+        CHECK_THROWS_AS(
+            fit_iteration_regression({}, 1), stat_bench::StatBenchException);
+    }
+}
+
+TEST_CASE("stat_bench::measurer::normalize_linear_iteration_durations") {
+    using Catch::Matchers::WithinRel;
+    using stat_bench::clock::Duration;
+
+    std::vector<std::vector<Duration>> durations{
+        {Duration(1.0), Duration(4.0), Duration(9.0)}};  // NOLINT
+
+    stat_bench::measurer::normalize_linear_iteration_durations(durations);
+
+    REQUIRE(durations.size() == 1);
+    REQUIRE(durations[0].size() == 3);
+    CHECK_THAT(durations[0][0].seconds(), WithinRel(1.0));
+    CHECK_THAT(durations[0][1].seconds(), WithinRel(2.0));
+    CHECK_THAT(durations[0][2].seconds(), WithinRel(3.0));
+}
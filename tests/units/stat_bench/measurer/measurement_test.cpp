@@ -19,7 +19,9 @@
  */
 #include "stat_bench/measurer/measurement.h"
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -27,7 +29,9 @@
 #include "stat_bench/benchmark_case_name.h"
 #include "stat_bench/benchmark_group_name.h"
 #include "stat_bench/custom_output_name.h"
+#include "stat_bench/measurer/fit_iteration_regression.h"
 #include "stat_bench/measurer/measurement_type.h"
+#include "stat_bench/stat/calc_stat.h"
 
 TEST_CASE("stat_bench::measurer::Measurement") {
     using stat_bench::BenchmarkCaseName;
@@ -95,4 +99,46 @@ TEST_CASE("stat_bench::measurer::Measurement") {
             CustomOutputName("CustomOutput2"));
         REQUIRE(measurement.custom_outputs().at(0).second == 2.0);  // NOLINT
     }
+
+    SECTION("diagnose drifts") {
+        const auto info = stat_bench::BenchmarkFullName(
+            BenchmarkGroupName("group"), BenchmarkCaseName("case"));
+        const auto cond = stat_bench::BenchmarkCondition(
+            1, stat_bench_test::param::create_ordinary_parameter_dict());
+        const auto measurement_type = MeasurementType("measurer");
+        const std::size_t iterations = 1;
+        constexpr std::size_t samples = 20;
+        // Durations decrease as normalized durations of the linear regression
+        // on numbers of iterations with a fixed overhead.
+        std::vector<std::vector<Duration>> durations(1);
+        for (std::size_t i = 0; i < samples; ++i) {
+            durations.front().emplace_back(
+                1.0 + 10.0 / static_cast<double>(i + 1));  // NOLINT
+        }
+        const auto stat = stat_bench::stat::calc_stat(durations, iterations);
+
+        SECTION("for ordinary measurements") {
+            const auto measurement = stat_bench::measurer::Measurement(info,
+                cond, measurement_type, iterations, samples, durations, {},
+                {});
+
+            CHECK(measurement.drift_diagnostics().drifting);
+            CHECK(measurement.drift_diagnostics().effective_sample_size <
+                static_cast<double>(samples));
+            CHECK(measurement.durations_stat().standard_error() >
+                stat.standard_error());
+        }
+
+        SECTION("skip for measurements with linear regression") {
+            const auto measurement = stat_bench::measurer::Measurement(info,
+                cond, measurement_type, iterations, samples, durations, {},
+                {}, 0, stat_bench::measurer::IterationRegression{});
+
+            CHECK_FALSE(measurement.drift_diagnostics().drifting);
+            CHECK(measurement.drift_diagnostics().effective_sample_size ==
+                static_cast<double>(samples));
+            CHECK(measurement.durations_stat().standard_error() ==
+                stat.standard_error());
+        }
+    }
 }
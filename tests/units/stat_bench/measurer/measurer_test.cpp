@@ -27,6 +27,7 @@
 
 #include <catch2/catch_message.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <trompeloeil.hpp>
 
 #include "../mock_benchmark_case.h"
@@ -46,6 +47,7 @@ TEST_CASE("stat_bench::measurer::Measurer") {
     using stat_bench::BenchmarkCaseName;
     using stat_bench::BenchmarkGroupName;
     using stat_bench::MeasurementConfig;
+    using Catch::Matchers::WithinRel;
     using stat_bench::measurer::MeasurementType;
 
     constexpr double min_sample_duration_sec = 0.01;
@@ -169,4 +171,112 @@ TEST_CASE("stat_bench::measurer::Measurer") {
         REQUIRE(result.durations().size() == 1);
         REQUIRE(result.durations().at(0).size() == result.samples());
     }
+    SECTION("measure with linearly increasing numbers of iterations") {
+        stat_bench_test::bench_impl::MockBenchmarkCase bench_case;
+        const auto info = stat_bench::BenchmarkFullName(
+            BenchmarkGroupName("group"), BenchmarkCaseName("case"));
+        const auto cond = stat_bench::BenchmarkCondition(
+            1, stat_bench_test::param::create_ordinary_parameter_dict());
+        const auto measurement_type = MeasurementType("Processing Time");
+        constexpr std::size_t base_iterations = 2;
+        const auto measurement_config = MeasurementConfig()
+                                            .type(measurement_type.str().str())
+                                            .iterations(base_iterations)
+                                            .warming_up_samples(0)
+                                            .linear_iterations(true);
+        const auto measure = [] {
+            auto& context = stat_bench::current_invocation_context();
+            const auto output = context.add_custom_stat("count");
+            context.measure([&output](std::size_t thread_index,
+                                std::size_t sample_index,
+                                std::size_t /*iteration_index*/) {
+                output->add(thread_index, sample_index, 1.0);
+                // NOLINTNEXTLINE
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            });
+        };
+
+        // NOLINTNEXTLINE
+        ALLOW_CALL(bench_case, info()).RETURN(info);
+        REQUIRE_CALL(bench_case, execute())
+            .TIMES(AT_LEAST(1))
+            // NOLINTNEXTLINE
+            .SIDE_EFFECT(measure());
+
+        const auto result =
+            measurer->measure(&bench_case, cond, measurement_config);
+        REQUIRE(result.iterations() == base_iterations);
+        REQUIRE(result.samples() == samples);
+        REQUIRE(result.warming_up_samples() == 0);
+
+        // Numbers of iterations increase linearly in samples.
+        REQUIRE(result.iteration_regression().has_value());
+        const auto& regression = result.iteration_regression().value();
+        REQUIRE(regression.iterations.size() == samples);
+        CHECK_THAT(regression.iterations.at(0), WithinRel(2.0));
+        CHECK_THAT(regression.iterations.at(1), WithinRel(4.0));
+        CHECK_THAT(regression.iterations.at(2), WithinRel(6.0));
+        constexpr double min_time_per_iteration = 1e-3;
+        CHECK(regression.ordinary_least_squares.slope >
+            0.5 * min_time_per_iteration);  // NOLINT
+
+        // Durations are rescaled to base_iterations iterations.
+        REQUIRE(result.durations().size() == 1);
+        REQUIRE(result.durations().at(0).size() == samples);
+        const double first_duration = result.durations().at(0).at(0).seconds();
+        const double last_duration = result.durations().at(0).at(2).seconds();
+        CHECK(last_duration < 2.0 * first_duration);  // NOLINT
+
+        // Custom outputs are rescaled to one iteration.
+        REQUIRE(result.custom_stat().size() == 1);
+        CHECK_THAT(result.custom_stat().at(0).mean(), WithinRel(1.0));
+    }
+    SECTION("determine warming up samples by steady states") {
+        stat_bench_test::bench_impl::MockBenchmarkCase bench_case;
+        const auto info = stat_bench::BenchmarkFullName(
+            BenchmarkGroupName("group"), BenchmarkCaseName("case"));
+        const auto cond = stat_bench::BenchmarkCondition(
+            1, stat_bench_test::param::create_ordinary_parameter_dict());
+        const auto measurement_type = MeasurementType("Processing Time");
+        constexpr std::size_t max_warming_up_samples = 10;
+        const auto measurement_config =
+            MeasurementConfig()
+                .type(measurement_type.str().str())
+                .iterations(1)
+                .max_steady_state_warming_up_samples(max_warming_up_samples)
+                .cold_cache(true)
+                .linear_iterations(true);
+        std::size_t executions = 0;
+        bool same_config_in_executions = true;
+        const auto measure = [&executions, &same_config_in_executions] {
+            auto& context = stat_bench::current_invocation_context();
+            ++executions;
+            if (!context.cold_cache() || !context.linear_iterations()) {
+                same_config_in_executions = false;
+            }
+            context.measure([](std::size_t /*thread_index*/,
+                                std::size_t /*sample_index*/,
+                                std::size_t /*iteration_index*/) {
+                // NOLINTNEXTLINE
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            });
+        };
+
+        // NOLINTNEXTLINE
+        ALLOW_CALL(bench_case, info()).RETURN(info);
+        REQUIRE_CALL(bench_case, execute())
+            .TIMES(AT_LEAST(2))
+            // NOLINTNEXTLINE
+            .SIDE_EFFECT(measure());
+
+        const auto result =
+            measurer->measure(&bench_case, cond, measurement_config);
+        REQUIRE(result.samples() == samples);
+        CHECK(result.warming_up_samples() <= max_warming_up_samples);
+        CHECK(result.iteration_regression().has_value());
+
+        // Trials to detect steady states use the same configuration.
+        CHECK(executions >= 2);
+        CHECK(same_config_in_executions);
+    }
 }
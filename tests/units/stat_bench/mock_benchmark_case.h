@@ -37,6 +37,9 @@ public:
     // NOLINTNEXTLINE
     MAKE_MOCK0(execute, void(), override);
 
+    // NOLINTNEXTLINE
+    MAKE_MOCK0(release_cached_resources, void(), override);
+
     MockBenchmarkCase() = default;
     MockBenchmarkCase(const MockBenchmarkCase&) = delete;
     MockBenchmarkCase(MockBenchmarkCase&&) = delete;
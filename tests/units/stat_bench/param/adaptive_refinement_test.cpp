@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions for adaptive refinement of parameters.
+ */
+#include "stat_bench/param/adaptive_refinement.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+TEST_CASE("stat_bench::param::find_refinement_intervals") {
+    using stat_bench::param::find_refinement_intervals;
+
+    SECTION("find a jump of processing time per element") {
+        const std::vector<double> values{1.0, 2.0, 4.0, 8.0, 16.0};
+        // Time per element jumps from 1 to 3 between 4 and 8.
+        const std::vector<double> mean_times{1.0, 2.0, 4.0, 24.0, 48.0};
+
+        const auto intervals =
+            find_refinement_intervals(values, mean_times, 0.2);
+
+        REQUIRE(!intervals.empty());
+        CHECK(intervals.front().index == 2);
+        for (const auto& interval : intervals) {
+            CHECK(interval.index >= 1);
+            CHECK(interval.index <= 3);
+        }
+    }
+
+    SECTION("find nothing for linear processing time") {
+        const std::vector<double> values{1.0, 2.0, 4.0, 8.0, 16.0};
+        const std::vector<double> mean_times{1.0, 2.0, 4.0, 8.0, 16.0};
+
+        const auto intervals =
+            find_refinement_intervals(values, mean_times, 0.2);
+
+        CHECK(intervals.empty());
+    }
+
+    SECTION("find a change of slope") {
+        const std::vector<double> values{1.0, 2.0, 4.0, 8.0, 16.0};
+        // Time per element grows after 4.
+        const std::vector<double> mean_times{1.0, 2.0, 4.0, 9.0, 20.0};
+
+        const auto intervals =
+            find_refinement_intervals(values, mean_times, 0.1);
+
+        REQUIRE(intervals.size() == 3);
+        CHECK(intervals[0].index == 2);
+        CHECK(std::any_of(intervals.begin(), intervals.end(),
+            [](const auto& interval) { return interval.index == 1; }));
+    }
+
+    SECTION("use processing time for non-positive values") {
+        const std::vector<double> values{-1.0, 0.0, 1.0};
+        const std::vector<double> mean_times{1.0, 1.0, 2.0};
+
+        const auto intervals =
+            find_refinement_intervals(values, mean_times, 0.2);
+
+        REQUIRE(intervals.size() == 1);
+        CHECK(intervals.front().index == 1);
+    }
+
+    SECTION("find nothing for a single value") {
+        CHECK(find_refinement_intervals({1.0}, {1.0}, 0.2).empty());
+    }
+
+    SECTION("reject different sizes") {
+        CHECK_THROWS_AS(find_refinement_intervals({1.0, 2.0}, {1.0}, 0.2),
+            stat_bench::StatBenchException);
+    }
+}
+
+TEST_CASE("stat_bench::param::calc_refinement_point") {
+    using Catch::Matchers::WithinRel;
+    using stat_bench::param::calc_refinement_point;
+
+    CHECK_THAT(calc_refinement_point(4.0, 16.0), WithinRel(8.0));
+    CHECK_THAT(calc_refinement_point(-1.0, 3.0), WithinRel(1.0));
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to generate numbers of threads from the topology
+ * of CPUs.
+ */
+#include "stat_bench/param/auto_num_threads.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "stat_bench/util/cpu_topology.h"
+
+TEST_CASE("stat_bench::param::generate_auto_num_threads") {
+    using stat_bench::param::generate_auto_num_threads;
+    using stat_bench::util::CpuTopology;
+
+    SECTION("generate for a host with SMT in two sockets") {
+        const auto topology = CpuTopology{48, 24, 2};  // NOLINT
+
+        CHECK(generate_auto_num_threads(topology) ==
+            std::vector<std::size_t>{1, 2, 4, 8, 12, 16, 24, 48});  // NOLINT
+    }
+
+    SECTION("generate for a host without SMT") {
+        const auto topology = CpuTopology{8, 8, 1};  // NOLINT
+
+        CHECK(generate_auto_num_threads(topology) ==
+            std::vector<std::size_t>{1, 2, 4, 8});  // NOLINT
+    }
+
+    SECTION("generate for a host with one CPU") {
+        const auto topology = CpuTopology{1, 1, 1};
+
+        CHECK(generate_auto_num_threads(topology) ==
+            std::vector<std::size_t>{1});
+    }
+
+    SECTION("generate with a maximum") {
+        const auto topology = CpuTopology{48, 24, 2};  // NOLINT
+
+        CHECK(generate_auto_num_threads(topology, 10) ==  // NOLINT
+            std::vector<std::size_t>{1, 2, 4, 8, 10});    // NOLINT
+    }
+}
+
+TEST_CASE("stat_bench::param::describe_expected_thread_placement") {
+    using stat_bench::param::describe_expected_thread_placement;
+    using stat_bench::util::CpuTopology;
+
+    const auto topology = CpuTopology{48, 24, 2};  // NOLINT
+
+    CHECK(describe_expected_thread_placement(1, topology) == "cores");
+    CHECK(describe_expected_thread_placement(12, topology) ==  // NOLINT
+        "cores");
+    CHECK(describe_expected_thread_placement(16, topology) ==  // NOLINT
+        "cross_socket");
+    CHECK(describe_expected_thread_placement(24, topology) ==  // NOLINT
+        "cross_socket");
+    CHECK(describe_expected_thread_placement(48, topology) ==  // NOLINT
+        "cross_socket+smt");
+    CHECK(describe_expected_thread_placement(64, topology) ==  // NOLINT
+        "oversubscribed");
+
+    const auto single_socket = CpuTopology{16, 8, 1};  // NOLINT
+    CHECK(describe_expected_thread_placement(8, single_socket) == "cores");
+    CHECK(describe_expected_thread_placement(16, single_socket) ==  // NOLINT
+        "smt");
+}
@@ -19,12 +19,17 @@
  */
 #include "stat_bench/param/parameter_config.h"
 
+#include <cstddef>
 #include <string>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include "stat_bench/param/auto_num_threads.h"
+#include "stat_bench/param/num_threads_parameter_name.h"
 #include "stat_bench/param/parameter_dict.h"
 #include "stat_bench/param/parameter_name.h"
+#include "stat_bench/stat_bench_exception.h"
+#include "stat_bench/util/cpu_topology.h"
 
 TEST_CASE("stat_bench::param::ParameterConfig") {
     using stat_bench::param::ParameterName;
@@ -88,4 +93,101 @@ TEST_CASE("stat_bench::param::ParameterConfig") {
         REQUIRE(config.has(ParameterName("param1")));
         REQUIRE(!config.has(ParameterName("invalid")));
     }
+
+    SECTION("zip parameters") {
+        stat_bench::param::ParameterConfig config;
+
+        config.add<int>(ParameterName("param1"))->add(1)->add(2);
+        config.add<int>(ParameterName("param2"))->add(3)->add(4);
+        config.zip({ParameterName("param1"), ParameterName("param2")});
+
+        auto generator = config.create_generator();
+
+        auto dict = generator.generate();
+        REQUIRE(dict.get<int>(ParameterName("param1")) == 1);
+        REQUIRE(dict.get<int>(ParameterName("param2")) == 3);
+
+        REQUIRE(generator.iterate());
+        dict = generator.generate();
+        REQUIRE(dict.get<int>(ParameterName("param1")) == 2);
+        REQUIRE(dict.get<int>(ParameterName("param2")) == 4);
+
+        REQUIRE(!generator.iterate());
+    }
+
+    SECTION("zip non-existing parameters") {
+        stat_bench::param::ParameterConfig config;
+
+        (void)config.add<int>(ParameterName("param1"));
+
+        CHECK_THROWS_AS(
+            config.zip({ParameterName("param1"), ParameterName("invalid")}),
+            stat_bench::StatBenchException);
+    }
+
+    SECTION("add constraints") {
+        stat_bench::param::ParameterConfig config;
+
+        config.add<int>(ParameterName("param1"))->add(1)->add(2)->add(3);
+        config.add_constraint([](const stat_bench::param::ParameterDict& dict) {
+            return dict.get<int>(ParameterName("param1")) != 1;
+        });
+
+        auto generator = config.create_generator();
+        REQUIRE(!generator.empty());
+
+        auto dict = generator.generate();
+        REQUIRE(dict.get<int>(ParameterName("param1")) == 2);
+
+        REQUIRE(generator.iterate());
+        dict = generator.generate();
+        REQUIRE(dict.get<int>(ParameterName("param1")) == 3);
+
+        REQUIRE(!generator.iterate());
+    }
+
+    SECTION("set numbers of threads from topology") {
+        using stat_bench::param::num_threads_parameter_name;
+        using stat_bench::param::expected_placement_parameter_name;
+
+        stat_bench::param::ParameterConfig config;
+        const auto topology =
+            stat_bench::util::CpuTopology{16, 8, 1};  // NOLINT
+
+        (void)config.set_auto_threads({1, 16}, topology, true);  // NOLINT
+        CHECK(config.has_auto_threads());
+        CHECK(config.annotates_thread_placement());
+
+        auto generator = config.create_generator();
+        auto dict = generator.generate();
+        CHECK(dict.get<std::size_t>(num_threads_parameter_name()) == 1);
+        CHECK(dict.get<std::string>(expected_placement_parameter_name()) ==
+            "cores");
+        REQUIRE(generator.iterate());
+        dict = generator.generate();
+        CHECK(dict.get<std::size_t>(num_threads_parameter_name()) == 16);
+        CHECK(dict.get<std::string>(expected_placement_parameter_name()) ==
+            "smt");
+        CHECK(!generator.iterate());
+
+        // Replace the values.
+        (void)config.set_auto_threads({4}, topology, true);  // NOLINT
+        CHECK(config.params().size() == 2);
+        generator = config.create_generator();
+        dict = generator.generate();
+        CHECK(dict.get<std::size_t>(num_threads_parameter_name()) == 4);
+        CHECK(!generator.iterate());
+    }
+
+    SECTION("set numbers of threads without placement") {
+        stat_bench::param::ParameterConfig config;
+        const auto topology = stat_bench::util::CpuTopology{4, 4, 1};
+
+        (void)config.set_auto_threads({1, 2, 4}, topology, false);  // NOLINT
+
+        CHECK(config.params().size() == 1);
+        CHECK(!config.annotates_thread_placement());
+        CHECK_THROWS_AS(config.set_auto_threads({0}, topology, false),
+            stat_bench::StatBenchException);
+    }
 }
@@ -104,6 +104,26 @@ TEST_CASE("stat_bench::param::ParameterDict") {
         REQUIRE_THROWS((void)dict.get_as_variant(ParameterName("Invalid")));
     }
 
+    SECTION("clone with a parameter replaced") {
+        OrderedMap<ParameterName, ParameterValue> data;
+        data.try_emplace(ParameterName("Param1"),
+            ParameterValue().emplace<int>(5));  // NOLINT
+        data.try_emplace(ParameterName("Param2"),
+            ParameterValue().emplace<std::string>("Value2"));
+
+        const auto dict = stat_bench::param::ParameterDict(std::move(data));
+        constexpr int new_value = 7;
+        const auto cloned = dict.clone_with(
+            ParameterName("Param1"), ParameterValue().emplace<int>(new_value));
+
+        CHECK(cloned.get<int>(ParameterName("Param1")) == new_value);
+        CHECK(cloned.get<std::string>(ParameterName("Param2")) == "Value2");
+        CHECK(fmt::format("{}", cloned) == "Param1=7, Param2=Value2");
+        CHECK(dict.get<int>(ParameterName("Param1")) == 5);  // NOLINT
+        CHECK_THROWS((void)dict.clone_with(ParameterName("Invalid"),
+            ParameterValue().emplace<int>(new_value)));
+    }
+
     SECTION("calculate hash value") {
         OrderedMap<ParameterName, ParameterValue> data;
         data.try_emplace(ParameterName("Param1"),
@@ -21,12 +21,17 @@
 
 #include <functional>
 #include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
 #include <unordered_map>
 
 #include <catch2/catch_test_macros.hpp>
 
+#include "stat_bench/param/parameter_dict.h"
 #include "stat_bench/param/parameter_name.h"
 #include "stat_bench/param/parameter_value_vector.h"
+#include "stat_bench/stat_bench_exception.h"
 #include "stat_bench/util/utf8_string.h"
 
 TEST_CASE("stat_bench::param::ParameterGenerator") {
@@ -102,4 +107,140 @@ TEST_CASE("stat_bench::param::ParameterGenerator") {
 
         REQUIRE(!generator.iterate());
     }
+
+    SECTION("generate zipped parameters") {
+        std::vector<
+            std::pair<ParameterName, std::shared_ptr<IParameterValueVector>>>
+            params;
+
+        const auto param1 = std::make_shared<ParameterValueVector<int>>();
+        param1->add(1)->add(2)->add(3);
+        params.emplace_back(ParameterName("param1"), param1);
+
+        const auto param2 = std::make_shared<ParameterValueVector<int>>();
+        param2->add(4)->add(5);
+        params.emplace_back(ParameterName("param2"), param2);
+
+        const auto param3 = std::make_shared<ParameterValueVector<int>>();
+        param3->add(10)->add(20)->add(30);
+        params.emplace_back(ParameterName("param3"), param3);
+
+        stat_bench::param::ParameterGenerator generator{params,
+            {{ParameterName("param1"), ParameterName("param3")}}};
+        REQUIRE(!generator.empty());
+
+        std::vector<std::tuple<int, int, int>> generated;
+        do {
+            const auto dict = generator.generate();
+            generated.emplace_back(dict.get<int>(ParameterName("param1")),
+                dict.get<int>(ParameterName("param2")),
+                dict.get<int>(ParameterName("param3")));
+        } while (generator.iterate());
+
+        CHECK(generated ==
+            std::vector<std::tuple<int, int, int>>{{1, 4, 10}, {1, 5, 10},
+                {2, 4, 20}, {2, 5, 20}, {3, 4, 30}, {3, 5, 30}});
+    }
+
+    SECTION("reject zipped parameters with different sizes") {
+        std::vector<
+            std::pair<ParameterName, std::shared_ptr<IParameterValueVector>>>
+            params;
+
+        const auto param1 = std::make_shared<ParameterValueVector<int>>();
+        param1->add(1)->add(2)->add(3);
+        params.emplace_back(ParameterName("param1"), param1);
+
+        const auto param2 = std::make_shared<ParameterValueVector<int>>();
+        param2->add(4)->add(5);
+        params.emplace_back(ParameterName("param2"), param2);
+
+        CHECK_THROWS_AS(
+            stat_bench::param::ParameterGenerator(params,
+                {{ParameterName("param1"), ParameterName("param2")}}),
+            stat_bench::StatBenchException);
+    }
+
+    SECTION("skip parameters not satisfying constraints") {
+        std::vector<
+            std::pair<ParameterName, std::shared_ptr<IParameterValueVector>>>
+            params;
+
+        const auto param1 = std::make_shared<ParameterValueVector<int>>();
+        param1->add(1)->add(2)->add(3);
+        params.emplace_back(ParameterName("param1"), param1);
+
+        const auto param2 = std::make_shared<ParameterValueVector<int>>();
+        param2->add(1)->add(2)->add(3);
+        params.emplace_back(ParameterName("param2"), param2);
+
+        stat_bench::param::ParameterGenerator generator{params, {},
+            {[](const stat_bench::param::ParameterDict& dict) {
+                return dict.get<int>(ParameterName("param1")) >
+                    dict.get<int>(ParameterName("param2"));
+            }}};
+        REQUIRE(!generator.empty());
+
+        std::vector<std::pair<int, int>> generated;
+        do {
+            const auto dict = generator.generate();
+            generated.emplace_back(dict.get<int>(ParameterName("param1")),
+                dict.get<int>(ParameterName("param2")));
+        } while (generator.iterate());
+
+        CHECK(generated ==
+            std::vector<std::pair<int, int>>{{2, 1}, {3, 1}, {3, 2}});
+    }
+
+    SECTION("generate nothing when no parameters satisfy constraints") {
+        std::vector<
+            std::pair<ParameterName, std::shared_ptr<IParameterValueVector>>>
+            params;
+
+        const auto param1 = std::make_shared<ParameterValueVector<int>>();
+        param1->add(1)->add(2);
+        params.emplace_back(ParameterName("param1"), param1);
+
+        stat_bench::param::ParameterGenerator generator{params, {},
+            {[](const stat_bench::param::ParameterDict& /*dict*/) {
+                return false;
+            }}};
+
+        CHECK(generator.empty());
+    }
+
+    SECTION("generate sampled parameters") {
+        std::vector<
+            std::pair<ParameterName, std::shared_ptr<IParameterValueVector>>>
+            params;
+
+        const auto param1 = std::make_shared<ParameterValueVector<int>>();
+        param1->add(1)->add(2)->add(3);
+        params.emplace_back(ParameterName("param1"), param1);
+
+        const auto param2 = std::make_shared<ParameterValueVector<int>>();
+        param2->add(1)->add(2)->add(3);
+        params.emplace_back(ParameterName("param2"), param2);
+
+        stat_bench::param::ParameterGenerator generator{params, {},
+            {[](const stat_bench::param::ParameterDict& dict) {
+                return dict.get<int>(ParameterName("param1")) !=
+                    dict.get<int>(ParameterName("param2"));
+            }},
+            stat_bench::param::ParameterSamplingConfig{
+                stat_bench::param::ParameterSamplingMethod::random, 4, 0}};
+        REQUIRE(!generator.empty());
+
+        std::vector<std::pair<int, int>> generated;
+        do {
+            const auto dict = generator.generate();
+            generated.emplace_back(dict.get<int>(ParameterName("param1")),
+                dict.get<int>(ParameterName("param2")));
+        } while (generator.iterate());
+
+        CHECK(generated.size() == 4);
+        for (const auto& [value1, value2] : generated) {
+            CHECK(value1 != value2);
+        }
+    }
 }
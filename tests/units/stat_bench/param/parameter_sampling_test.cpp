@@ -0,0 +1,182 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to sample parameters.
+ */
+#include "stat_bench/param/parameter_sampling.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+TEST_CASE("stat_bench::param::parse_parameter_sampling_method") {
+    using stat_bench::param::parse_parameter_sampling_method;
+    using stat_bench::param::ParameterSamplingMethod;
+
+    CHECK(parse_parameter_sampling_method("full") ==
+        ParameterSamplingMethod::full);
+    CHECK(parse_parameter_sampling_method("random") ==
+        ParameterSamplingMethod::random);
+    CHECK(parse_parameter_sampling_method("latin_hypercube") ==
+        ParameterSamplingMethod::latin_hypercube);
+    CHECK(parse_parameter_sampling_method("fractional_factorial") ==
+        ParameterSamplingMethod::fractional_factorial);
+    CHECK_THROWS_AS(parse_parameter_sampling_method("invalid"),
+        stat_bench::StatBenchException);
+}
+
+TEST_CASE("stat_bench::param::sample_parameter_indices") {
+    using stat_bench::param::ParameterSamplingConfig;
+    using stat_bench::param::ParameterSamplingMethod;
+    using stat_bench::param::sample_parameter_indices;
+    using Indices = std::vector<std::size_t>;
+
+    const auto accept_all = [](const Indices& /*indices*/) { return true; };
+
+    SECTION("sample all combinations") {
+        const auto result = sample_parameter_indices({2, 3},
+            ParameterSamplingConfig{ParameterSamplingMethod::full, 0, 0},
+            accept_all);
+
+        CHECK(result ==
+            std::vector<Indices>{
+                {0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {1, 2}});
+    }
+
+    SECTION("limit the number of all combinations") {
+        const auto result = sample_parameter_indices({2, 3},
+            ParameterSamplingConfig{ParameterSamplingMethod::full, 4, 0},
+            accept_all);
+
+        CHECK(result ==
+            std::vector<Indices>{{0, 0}, {0, 1}, {0, 2}, {1, 0}});
+    }
+
+    SECTION("sample randomly") {
+        const ParameterSamplingConfig config{
+            ParameterSamplingMethod::random, 10, 1};
+        const Indices sizes{5, 6, 7};
+        const auto result = sample_parameter_indices(sizes, config, accept_all);
+
+        REQUIRE(result.size() == 10);
+        CHECK(std::set<Indices>(result.begin(), result.end()).size() == 10);
+        CHECK(std::is_sorted(result.begin(), result.end()));
+        for (const auto& indices : result) {
+            for (std::size_t i = 0; i < sizes.size(); ++i) {
+                CHECK(indices[i] < sizes[i]);
+            }
+        }
+
+        // Same seed gives the same result.
+        CHECK(sample_parameter_indices(sizes, config, accept_all) == result);
+    }
+
+    SECTION("sample randomly in the same way on all platforms") {
+        // Combinations depend only on the seed, not on implementations of
+        // the standard library.
+        const auto result = sample_parameter_indices({3, 4},
+            ParameterSamplingConfig{ParameterSamplingMethod::random, 4, 1},
+            accept_all);
+
+        CHECK(result ==
+            std::vector<Indices>{{0, 2}, {0, 3}, {1, 2}, {2, 3}});
+    }
+
+    SECTION("sample randomly with constraints") {
+        const auto result = sample_parameter_indices({10, 10},
+            ParameterSamplingConfig{ParameterSamplingMethod::random, 20, 0},
+            [](const Indices& indices) { return indices[0] < indices[1]; });
+
+        REQUIRE(result.size() == 20);
+        for (const auto& indices : result) {
+            CHECK(indices[0] < indices[1]);
+        }
+    }
+
+    SECTION("sample randomly in a large space") {
+        const Indices sizes(8, 100);
+        const auto result = sample_parameter_indices(sizes,
+            ParameterSamplingConfig{ParameterSamplingMethod::random, 30, 0},
+            accept_all);
+
+        REQUIRE(result.size() == 30);
+        CHECK(std::set<Indices>(result.begin(), result.end()).size() == 30);
+    }
+
+    SECTION("sample using Latin hypercube sampling") {
+        constexpr std::size_t num_samples = 8;
+        const auto result = sample_parameter_indices({8, 8, 16},
+            ParameterSamplingConfig{
+                ParameterSamplingMethod::latin_hypercube, num_samples, 0},
+            accept_all);
+
+        REQUIRE(result.size() == num_samples);
+        // Each value of the first two parameters is used exactly once.
+        for (std::size_t param = 0; param < 2; ++param) {
+            std::set<std::size_t> values;
+            for (const auto& indices : result) {
+                values.insert(indices[param]);
+            }
+            CHECK(values.size() == num_samples);
+        }
+    }
+
+    SECTION("sample using Latin hypercube sampling on all platforms") {
+        const auto result = sample_parameter_indices({4, 4},
+            ParameterSamplingConfig{
+                ParameterSamplingMethod::latin_hypercube, 4, 1},
+            accept_all);
+
+        CHECK(result ==
+            std::vector<Indices>{{0, 1}, {1, 3}, {2, 0}, {3, 2}});
+    }
+
+    SECTION("sample using a fractional factorial design") {
+        const auto result = sample_parameter_indices({3, 2, 3, 2},
+            ParameterSamplingConfig{
+                ParameterSamplingMethod::fractional_factorial, 8, 0},
+            accept_all);
+
+        CHECK(result ==
+            std::vector<Indices>{{0, 0, 0, 0}, {0, 0, 2, 1}, {0, 1, 0, 1},
+                {0, 1, 2, 0}, {2, 0, 0, 1}, {2, 0, 2, 0}, {2, 1, 0, 0},
+                {2, 1, 2, 1}});
+    }
+
+    SECTION("use all two-level combinations in fractional factorial design") {
+        const auto result = sample_parameter_indices({3, 1, 2},
+            ParameterSamplingConfig{
+                ParameterSamplingMethod::fractional_factorial, 0, 0},
+            accept_all);
+
+        CHECK(result ==
+            std::vector<Indices>{{0, 0, 0}, {0, 0, 1}, {2, 0, 0}, {2, 0, 1}});
+    }
+
+    SECTION("use all combinations when the limit is large") {
+        const auto result = sample_parameter_indices({2, 2},
+            ParameterSamplingConfig{ParameterSamplingMethod::random, 10, 0},
+            accept_all);
+
+        CHECK(result == std::vector<Indices>{{0, 0}, {0, 1}, {1, 0}, {1, 1}});
+    }
+}
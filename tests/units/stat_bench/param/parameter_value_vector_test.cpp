@@ -19,10 +19,29 @@
  */
 #include "stat_bench/param/parameter_value_vector.h"
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace {
+
+template <typename T>
+auto get_values(const stat_bench::param::ParameterValueVector<T>& vec)
+    -> std::vector<T> {
+    std::vector<T> values;
+    for (const auto& value : vec) {
+        values.push_back(value.template as<T>());
+    }
+    return values;
+}
+
+}  // namespace
 
 TEST_CASE("stat_bench::param::ParameterValueVector") {
     SECTION("add values") {
@@ -44,4 +63,119 @@ TEST_CASE("stat_bench::param::ParameterValueVector") {
         ++iter;
         REQUIRE(iter == end);
     }
+
+    SECTION("create values") {
+        const auto int_vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<std::size_t>>();
+        CHECK(int_vec->create_value(2.6).as<std::size_t>() == 3);
+
+        const auto double_vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<double>>();
+        CHECK(double_vec->create_value(2.5).as<double>() == 2.5);  // NOLINT
+
+        const auto string_vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<std::string>>();
+        CHECK_THROWS_AS((void)string_vec->create_value(1.0),
+            stat_bench::StatBenchException);
+        CHECK(string_vec->refinement() == nullptr);
+    }
+
+    SECTION("enable adaptive refinement") {
+        const auto vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<std::size_t>>();
+        CHECK(vec->refinement() == nullptr);
+
+        vec->add(1)->add(16)->refine_adaptively(10, 0.5);  // NOLINT
+
+        REQUIRE(vec->refinement() != nullptr);
+        CHECK(vec->refinement()->max_points == 10);
+        CHECK(vec->refinement()->threshold == 0.5);  // NOLINT
+    }
+
+    SECTION("add a linear range") {
+        const auto vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<std::size_t>>();
+
+        vec->add_range(2, 10, 3);  // NOLINT
+
+        CHECK(get_values(*vec) == std::vector<std::size_t>{2, 5, 8});
+    }
+
+    SECTION("add a linear range of floating-point numbers") {
+        const auto vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<double>>();
+
+        vec->add_range(0.0, 0.3, 0.1);  // NOLINT
+
+        const auto values = get_values(*vec);
+        REQUIRE(values.size() == 4);
+        CHECK_THAT(values.back(), Catch::Matchers::WithinRel(0.3));
+    }
+
+    SECTION("add a linear range with invalid arguments") {
+        const auto vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<int>>();
+
+        CHECK_THROWS_AS(vec->add_range(1, 10, 0),  // NOLINT
+            stat_bench::StatBenchException);
+        CHECK_THROWS_AS(vec->add_range(10, 1, 1),  // NOLINT
+            stat_bench::StatBenchException);
+    }
+
+    SECTION("add a geometric progression") {
+        const auto vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<std::size_t>>();
+
+        vec->add_geometric(1, 1000, 10.0);  // NOLINT
+
+        CHECK(get_values(*vec) == std::vector<std::size_t>{1, 10, 100, 1000});
+    }
+
+    SECTION("add a geometric progression with invalid arguments") {
+        const auto vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<double>>();
+
+        CHECK_THROWS_AS(vec->add_geometric(1.0, 10.0, 1.0),  // NOLINT
+            stat_bench::StatBenchException);
+        CHECK_THROWS_AS(vec->add_geometric(0.0, 10.0, 2.0),  // NOLINT
+            stat_bench::StatBenchException);
+    }
+
+    SECTION("add powers of two") {
+        const auto vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<std::size_t>>();
+
+        vec->add_powers_of_two(1, 64);  // NOLINT
+
+        CHECK(get_values(*vec) ==
+            std::vector<std::size_t>{1, 2, 4, 8, 16, 32, 64});  // NOLINT
+    }
+
+    SECTION("add powers of two with intermediate steps") {
+        const auto vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<std::size_t>>();
+
+        vec->add_powers_of_two(1, 8, 2);  // NOLINT
+
+        // 1.41 is rounded to 1, which is skipped as a duplicate.
+        CHECK(get_values(*vec) ==
+            std::vector<std::size_t>{1, 2, 3, 4, 6, 8});  // NOLINT
+    }
+
+    SECTION("add values around cache sizes") {
+        const auto vec = std::make_shared<
+            stat_bench::param::ParameterValueVector<std::size_t>>();
+
+        vec->add_cache_sizes(4, {1.0});  // NOLINT
+
+        const auto values = get_values(*vec);
+        REQUIRE(!values.empty());
+        for (std::size_t i = 1; i < values.size(); ++i) {
+            CHECK(values.at(i - 1) < values.at(i));
+        }
+        const auto& cache_sizes = stat_bench::util::detect_cache_sizes();
+        if (cache_sizes.l1d > 0) {
+            CHECK(values.front() == cache_sizes.l1d / 4);
+        }
+    }
 }
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to decimate samples for plots.
+ */
+#include "stat_bench/plots/decimate_samples.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("stat_bench::plots::decimate_min_max") {
+    using stat_bench::plots::decimate_min_max;
+
+    SECTION("keep all samples within the limit") {
+        const std::vector<double> samples{3.0, 1.0, 2.0};
+
+        const auto indices = decimate_min_max(samples, 3);
+
+        CHECK(indices == std::vector<std::size_t>{0, 1, 2});
+    }
+
+    SECTION("keep all samples without limit") {
+        const std::vector<double> samples{3.0, 1.0, 2.0};
+
+        const auto indices = decimate_min_max(samples, 0);
+
+        CHECK(indices == std::vector<std::size_t>{0, 1, 2});
+    }
+
+    SECTION("keep minimum and maximum in each bucket") {
+        const std::vector<double> samples{
+            5.0, 1.0, 9.0, 4.0, 3.0, 8.0, 2.0, 7.0};
+
+        const auto indices = decimate_min_max(samples, 4);
+
+        CHECK(indices == std::vector<std::size_t>{1, 2, 5, 6});
+    }
+
+    SECTION("keep a spike") {
+        constexpr std::size_t num_samples = 100000;
+        constexpr std::size_t spike_index = 12345;
+        std::vector<double> samples(num_samples, 1.0);
+        samples[spike_index] = 100.0;
+        constexpr std::size_t max_points = 1000;
+
+        const auto indices = decimate_min_max(samples, max_points);
+
+        CHECK(indices.size() <= max_points);
+        CHECK(std::is_sorted(indices.begin(), indices.end()));
+        CHECK(std::find(indices.begin(), indices.end(), spike_index) !=
+            indices.end());
+    }
+}
+
+TEST_CASE("stat_bench::plots::select_quantile_indices") {
+    using stat_bench::plots::select_quantile_indices;
+
+    SECTION("keep all samples within the limit") {
+        const auto indices = select_quantile_indices(3, 5);
+
+        CHECK(indices == std::vector<std::size_t>{0, 1, 2});
+    }
+
+    SECTION("select evenly spaced indices") {
+        const auto indices = select_quantile_indices(9, 5);
+
+        CHECK(indices == std::vector<std::size_t>{0, 2, 4, 6, 8});
+    }
+
+    SECTION("select first and last indices") {
+        constexpr std::size_t num_samples = 100000;
+        constexpr std::size_t max_points = 1000;
+
+        const auto indices = select_quantile_indices(num_samples, max_points);
+
+        CHECK(indices.size() == max_points);
+        CHECK(indices.front() == 0);
+        CHECK(indices.back() == num_samples - 1);
+        CHECK(std::adjacent_find(indices.begin(), indices.end(),
+                  [](std::size_t lhs, std::size_t rhs) {
+                      return lhs >= rhs;
+                  }) == indices.end());
+    }
+}
+
+TEST_CASE("stat_bench::plots::reduce_for_distribution") {
+    using stat_bench::plots::reduce_for_distribution;
+
+    SECTION("keep all samples within the limit") {
+        const std::vector<double> sorted_samples{1.0, 2.0, 3.0};
+
+        const auto result = reduce_for_distribution(sorted_samples, 3);
+
+        CHECK(result == sorted_samples);
+    }
+
+    SECTION("keep extremes and ends of whiskers") {
+        constexpr std::size_t num_samples = 10000;
+        std::vector<double> sorted_samples;
+        sorted_samples.reserve(num_samples);
+        for (std::size_t i = 0; i < num_samples; ++i) {
+            sorted_samples.push_back(static_cast<double>(i));
+        }
+        // Quartiles are 2499.75 and 7499.25, so samples within
+        // [-4999.5, 14998.5] are within whiskers.
+        sorted_samples[num_samples - 2] = 14998.0;
+        sorted_samples[num_samples - 1] = 20000.0;
+        constexpr std::size_t max_points = 100;
+
+        const auto result = reduce_for_distribution(sorted_samples, max_points);
+
+        CHECK(result.size() <= max_points);
+        CHECK(std::is_sorted(result.begin(), result.end()));
+        CHECK(result.front() == 0.0);  // NOLINT
+        CHECK(result.back() == 20000.0);  // NOLINT
+        CHECK(std::find(result.begin(), result.end(), 14998.0) !=  // NOLINT
+            result.end());
+    }
+}
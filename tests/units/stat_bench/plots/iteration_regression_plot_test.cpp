@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of IterationRegressionPlot class.
+ */
+#include "stat_bench/plots/iteration_regression_plot.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ApprovalTests.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../reporter/create_test_measurement.h"
+#include "../reporter/read_file.h"
+#include "share_measurements.h"
+#include "stat_bench/benchmark_group_name.h"
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/custom_output_name.h"
+#include "stat_bench/measurer/fit_iteration_regression.h"
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/measurer/measurement_type.h"
+#include "stat_bench/stat/custom_stat_output.h"
+
+TEST_CASE("stat_bench::plots::IterationRegressionPlot") {
+    using stat_bench::BenchmarkGroupName;
+    using stat_bench::CustomOutputName;
+    using stat_bench::clock::Duration;
+    using stat_bench::measurer::fit_iteration_regression;
+    using stat_bench::measurer::Measurement;
+    using stat_bench::measurer::MeasurementType;
+    using stat_bench::plots::IterationRegressionPlot;
+    using stat_bench::stat::CustomStatOutput;
+    using stat_bench_test::create_test_measurement;
+    using stat_bench_test::share_measurements;
+
+    constexpr std::size_t iterations = 1000;
+    const auto measurement_type = std::string("Measurement1");
+    const auto group_name = std::string("Group1");
+
+    const auto add_regression = [](const Measurement& measurement) {
+        return Measurement(measurement.case_info(), measurement.cond(),
+            measurement.measurement_type(), measurement.iterations(),
+            measurement.samples(), measurement.durations(),
+            std::vector<std::shared_ptr<CustomStatOutput>>(),
+            std::vector<std::pair<CustomOutputName, double>>(), 0,
+            fit_iteration_regression(
+                measurement.durations(), measurement.iterations()));
+    };
+
+    SECTION("write") {
+        // Durations of samples with 1000, 2000, ..., 5000 iterations.
+        const auto measurements = std::vector<Measurement>{
+            add_regression(create_test_measurement(group_name, "Case1",
+                measurement_type,
+                std::vector<std::vector<Duration>>{
+                    {Duration(1.2), Duration(2.1), Duration(3.3),
+                        Duration(4.1), Duration(5.2)}})),
+            add_regression(create_test_measurement(group_name, "Case2",
+                measurement_type,
+                std::vector<std::vector<Duration>>{
+                    {Duration(2.5), Duration(4.4), Duration(6.6),
+                        Duration(8.4), Duration(10.5)}})),
+            // Measurements without regression are skipped.
+            create_test_measurement(group_name, "Case3", measurement_type,
+                std::vector<std::vector<Duration>>{
+                    {Duration(1.0), Duration(2.0)}})};
+        REQUIRE(measurements.front().iterations() == iterations);
+
+        IterationRegressionPlot plot;
+        const auto file_path =
+            std::string("./plots/IterationRegressionPlot.html");
+        plot.write(MeasurementType(measurement_type),
+            BenchmarkGroupName(group_name), share_measurements(measurements),
+            file_path);
+
+        ApprovalTests::Approvals::verify(stat_bench_test::read_file(file_path),
+            ApprovalTests::Options().fileOptions().withFileExtension(".html"));
+    }
+
+    SECTION("skip measurements without regression") {
+        const auto measurements = std::vector<Measurement>{
+            create_test_measurement(group_name, "Case1", measurement_type,
+                std::vector<std::vector<Duration>>{
+                    {Duration(1.0), Duration(2.0)}})};
+
+        IterationRegressionPlot plot;
+        const auto file_path =
+            std::string("./plots/IterationRegressionPlotWithoutData.html");
+        std::filesystem::remove(file_path);
+        plot.write(MeasurementType(measurement_type),
+            BenchmarkGroupName(group_name), share_measurements(measurements),
+            file_path);
+
+        CHECK_FALSE(std::filesystem::exists(file_path));
+    }
+}
@@ -28,6 +28,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "../reporter/read_file.h"
+#include "share_measurements.h"
 #include "stat_bench/benchmark_case_name.h"
 #include "stat_bench/benchmark_condition.h"
 #include "stat_bench/benchmark_full_name.h"
@@ -59,6 +60,7 @@ TEST_CASE("stat_bench::plots::ParameterToOutputLinePlot") {
     using stat_bench::param::ParameterName;
     using stat_bench::param::ParameterValue;
     using stat_bench::plots::ParameterToOutputLinePlot;
+    using stat_bench_test::share_measurements;
 
     SECTION("write without statistics") {
         const auto target_parameter_name = ParameterName("Parameter1");
@@ -144,7 +146,8 @@ TEST_CASE("stat_bench::plots::ParameterToOutputLinePlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToOutputLinePlot.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -159,7 +162,8 @@ TEST_CASE("stat_bench::plots::ParameterToOutputLinePlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToOutputLinePlotLog.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -277,7 +281,8 @@ TEST_CASE("stat_bench::plots::ParameterToOutputLinePlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToOutputLinePlotStat.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -292,7 +297,8 @@ TEST_CASE("stat_bench::plots::ParameterToOutputLinePlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToOutputLinePlotStatLog.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -362,7 +368,8 @@ TEST_CASE("stat_bench::plots::ParameterToOutputLinePlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToOutputLinePlotColumn.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -377,7 +384,8 @@ TEST_CASE("stat_bench::plots::ParameterToOutputLinePlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToOutputLinePlotRow.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -28,6 +28,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "../reporter/read_file.h"
+#include "share_measurements.h"
 #include "stat_bench/benchmark_case_name.h"
 #include "stat_bench/benchmark_condition.h"
 #include "stat_bench/benchmark_full_name.h"
@@ -57,6 +58,7 @@ TEST_CASE("stat_bench::plots::ParameterToTimeBoxPlot") {
     using stat_bench::param::ParameterName;
     using stat_bench::param::ParameterValue;
     using stat_bench::plots::ParameterToTimeBoxPlot;
+    using stat_bench_test::share_measurements;
 
     SECTION("write") {
         const auto target_parameter_name = ParameterName("Parameter1");
@@ -151,7 +153,8 @@ TEST_CASE("stat_bench::plots::ParameterToTimeBoxPlot") {
 
         const auto file_path =
             std::string("./plots/ParameterToTimeBoxPlot.html");
-        plot.write(measurement_type, group_name, measurements, file_path);
+        plot.write(measurement_type, group_name,
+            share_measurements(measurements), file_path);
 
         ApprovalTests::Approvals::verify(stat_bench_test::read_file(file_path),
             ApprovalTests::Options().fileOptions().withFileExtension(".html"));
@@ -213,7 +216,8 @@ TEST_CASE("stat_bench::plots::ParameterToTimeBoxPlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToTimeBoxPlotColumns.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -228,7 +232,8 @@ TEST_CASE("stat_bench::plots::ParameterToTimeBoxPlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToTimeBoxPlotRows.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -28,6 +28,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "../reporter/read_file.h"
+#include "share_measurements.h"
 #include "stat_bench/benchmark_case_name.h"
 #include "stat_bench/benchmark_condition.h"
 #include "stat_bench/benchmark_full_name.h"
@@ -36,6 +37,7 @@
 #include "stat_bench/custom_output_name.h"
 #include "stat_bench/measurer/measurement.h"
 #include "stat_bench/measurer/measurement_type.h"
+#include "stat_bench/param/auto_num_threads.h"
 #include "stat_bench/param/num_threads_parameter_name.h"
 #include "stat_bench/param/parameter_dict.h"
 #include "stat_bench/param/parameter_name.h"
@@ -56,7 +58,9 @@ TEST_CASE("stat_bench::plots::ParameterToTimeLinePlot") {
     using stat_bench::param::ParameterDict;
     using stat_bench::param::ParameterName;
     using stat_bench::param::ParameterValue;
+    using stat_bench::param::expected_placement_parameter_name;
     using stat_bench::plots::ParameterToTimeLinePlot;
+    using stat_bench_test::share_measurements;
 
     SECTION("write") {
         const auto target_parameter_name = ParameterName("Parameter1");
@@ -133,7 +137,8 @@ TEST_CASE("stat_bench::plots::ParameterToTimeLinePlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToTimeLinePlot.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -147,7 +152,8 @@ TEST_CASE("stat_bench::plots::ParameterToTimeLinePlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToTimeLinePlotLog.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -212,7 +218,8 @@ TEST_CASE("stat_bench::plots::ParameterToTimeLinePlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToTimeLinePlotColumns.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -227,7 +234,8 @@ TEST_CASE("stat_bench::plots::ParameterToTimeLinePlot") {
 
             const auto file_path =
                 std::string("./plots/ParameterToTimeLinePlotRows.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -235,4 +243,53 @@ TEST_CASE("stat_bench::plots::ParameterToTimeLinePlot") {
                     ".html"));
         }
     }
+
+    SECTION("write with automatic numbers of threads") {
+        const auto group_name = BenchmarkGroupName("Group");
+        const auto case_name1 = BenchmarkCaseName("Case1");
+        const auto measurement_type = MeasurementType("Measurer");
+        constexpr std::size_t iterations = 1;
+        const auto measurements = std::vector<Measurement>{
+            Measurement(BenchmarkFullName(group_name, case_name1),
+                BenchmarkCondition(ParameterDict(
+                    {{num_threads_parameter_name(),
+                         ParameterValue().emplace<std::size_t>(1)},
+                        {expected_placement_parameter_name(),
+                            ParameterValue().emplace<std::string>("cores")}})),
+                measurement_type, iterations, 3,
+                {{Duration(1), Duration(2), Duration(3)}}, {}, {}),
+            Measurement(BenchmarkFullName(group_name, case_name1),
+                BenchmarkCondition(ParameterDict(
+                    {{num_threads_parameter_name(),
+                         ParameterValue().emplace<std::size_t>(2)},
+                        {expected_placement_parameter_name(),
+                            ParameterValue().emplace<std::string>("cores")}})),
+                measurement_type, iterations, 3,
+                {{Duration(2), Duration(3), Duration(4)},
+                    {Duration(3), Duration(4), Duration(5)}},
+                {}, {}),
+            Measurement(BenchmarkFullName(group_name, case_name1),
+                BenchmarkCondition(ParameterDict(
+                    {{num_threads_parameter_name(),
+                         ParameterValue().emplace<std::size_t>(4)},
+                        {expected_placement_parameter_name(),
+                            ParameterValue().emplace<std::string>("smt")}})),
+                measurement_type, iterations, 3,
+                {{Duration(4), Duration(5), Duration(6)},
+                    {Duration(5), Duration(6), Duration(7)},
+                    {Duration(4), Duration(6), Duration(8)},
+                    {Duration(5), Duration(5), Duration(5)}},
+                {}, {})};
+
+        ParameterToTimeLinePlot plot(
+            num_threads_parameter_name(), PlotOptions().log_parameter(false));
+
+        const auto file_path =
+            std::string("./plots/ParameterToTimeLinePlotThreads.html");
+        plot.write(measurement_type, group_name,
+            share_measurements(measurements), file_path);
+
+        ApprovalTests::Approvals::verify(stat_bench_test::read_file(file_path),
+            ApprovalTests::Options().fileOptions().withFileExtension(".html"));
+    }
 }
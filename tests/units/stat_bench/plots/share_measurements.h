@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of share_measurements function.
+ */
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "stat_bench/measurer/measurement.h"
+
+namespace stat_bench_test {
+
+/*!
+ * \brief Convert measurements to shared pointers as passed to plots.
+ *
+ * \param[in] measurements Measurements.
+ * \return Shared pointers of the measurements.
+ */
+[[nodiscard]] inline auto share_measurements(
+    std::vector<stat_bench::measurer::Measurement> measurements)
+    -> std::vector<std::shared_ptr<const stat_bench::measurer::Measurement>> {
+    std::vector<std::shared_ptr<const stat_bench::measurer::Measurement>>
+        result;
+    result.reserve(measurements.size());
+    for (auto& measurement : measurements) {
+        result.push_back(
+            std::make_shared<const stat_bench::measurer::Measurement>(
+                std::move(measurement)));
+    }
+    return result;
+}
+
+}  // namespace stat_bench_test
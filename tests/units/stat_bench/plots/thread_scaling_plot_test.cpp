@@ -0,0 +1,76 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of ThreadScalingPlot class.
+ */
+#include "stat_bench/plots/thread_scaling_plot.h"
+
+#include <string>
+#include <vector>
+
+#include <ApprovalTests.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../reporter/create_test_measurement.h"
+#include "../reporter/read_file.h"
+#include "share_measurements.h"
+#include "stat_bench/benchmark_group_name.h"
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/measurer/measurement_type.h"
+
+TEST_CASE("stat_bench::plots::ThreadScalingPlot") {
+    using stat_bench::BenchmarkGroupName;
+    using stat_bench::clock::Duration;
+    using stat_bench::measurer::Measurement;
+    using stat_bench::measurer::MeasurementType;
+    using stat_bench::plots::ThreadScalingPlot;
+    using stat_bench_test::create_test_measurement;
+    using stat_bench_test::share_measurements;
+
+    SECTION("write") {
+        const auto measurement_type = std::string("Measurement1");
+        const auto group_name = std::string("Group1");
+        const auto measurements = std::vector<Measurement>{
+            create_test_measurement(group_name, "Case1", measurement_type,
+                std::vector<std::vector<Duration>>{
+                    {Duration(0.9), Duration(1.1)}}),
+            create_test_measurement(group_name, "Case1", measurement_type,
+                std::vector<std::vector<Duration>>{
+                    {Duration(1.2), Duration(1.3)},
+                    {Duration(1.25), Duration(1.25)}}),
+            create_test_measurement(group_name, "Case1", measurement_type,
+                std::vector<std::vector<Duration>>{
+                    {Duration(1.9), Duration(2.1)},
+                    {Duration(2.0), Duration(2.0)},
+                    {Duration(2.1), Duration(1.9)},
+                    {Duration(2.0), Duration(2.0)}}),
+            // Cases without measurements with multiple threads are skipped.
+            create_test_measurement(group_name, "Case2", measurement_type,
+                std::vector<std::vector<Duration>>{
+                    {Duration(1.0), Duration(2.0)}})};
+
+        ThreadScalingPlot plot;
+        const auto file_path = std::string("./plots/ThreadScalingPlot.html");
+        plot.write(MeasurementType(measurement_type),
+            BenchmarkGroupName(group_name), share_measurements(measurements),
+            file_path);
+
+        ApprovalTests::Approvals::verify(stat_bench_test::read_file(file_path),
+            ApprovalTests::Options().fileOptions().withFileExtension(".html"));
+    }
+}
@@ -28,6 +28,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "../reporter/read_file.h"
+#include "share_measurements.h"
 #include "stat_bench/benchmark_case_name.h"
 #include "stat_bench/benchmark_condition.h"
 #include "stat_bench/benchmark_full_name.h"
@@ -59,6 +60,7 @@ TEST_CASE("stat_bench::plots::TimeToOutputByParameterLinePlot") {
     using stat_bench::param::ParameterName;
     using stat_bench::param::ParameterValue;
     using stat_bench::plots::TimeToOutputByParameterLinePlot;
+    using stat_bench_test::share_measurements;
 
     SECTION("write without statistics") {
         const auto target_parameter_name = ParameterName("Parameter1");
@@ -143,7 +145,8 @@ TEST_CASE("stat_bench::plots::TimeToOutputByParameterLinePlot") {
 
             const auto file_path =
                 std::string("./plots/TimeToOutputByParameterLinePlot.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -157,7 +160,8 @@ TEST_CASE("stat_bench::plots::TimeToOutputByParameterLinePlot") {
 
             const auto file_path =
                 std::string("./plots/TimeToOutputByParameterLinePlotLog.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -274,7 +278,8 @@ TEST_CASE("stat_bench::plots::TimeToOutputByParameterLinePlot") {
 
             const auto file_path =
                 std::string("./plots/TimeToOutputByParameterLinePlotStat.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -288,7 +293,8 @@ TEST_CASE("stat_bench::plots::TimeToOutputByParameterLinePlot") {
 
             const auto file_path = std::string(
                 "./plots/TimeToOutputByParameterLinePlotStatLog.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -359,7 +365,8 @@ TEST_CASE("stat_bench::plots::TimeToOutputByParameterLinePlot") {
 
             const auto file_path = std::string(
                 "./plots/TimeToOutputByParameterLinePlotColumn.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -375,7 +382,8 @@ TEST_CASE("stat_bench::plots::TimeToOutputByParameterLinePlot") {
 
             const auto file_path =
                 std::string("./plots/TimeToOutputByParameterLinePlotRow.html");
-            plot.write(measurement_type, group_name, measurements, file_path);
+            plot.write(measurement_type, group_name,
+                share_measurements(measurements), file_path);
 
             ApprovalTests::Approvals::verify(
                 stat_bench_test::read_file(file_path),
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "../reporter/create_test_measurement.h"
+#include "share_measurements.h"
 #include "stat_bench/benchmark_group_name.h"
 #include "stat_bench/clock/duration.h"
 #include "stat_bench/measurer/measurement.h"
@@ -50,7 +51,8 @@ inline void use_plot_for_test(
                 Duration(800.0), Duration(900.0), Duration(1000.0)}})};
 
     plot->write(MeasurementType(measurement_type),
-        BenchmarkGroupName(group_name), measurements, file_path);
+        BenchmarkGroupName(group_name), share_measurements(measurements),
+        file_path);
 }
 
 }  // namespace stat_bench_test
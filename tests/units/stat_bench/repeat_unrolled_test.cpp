@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of repeat_unrolled function.
+ */
+#include "stat_bench/repeat_unrolled.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+TEST_CASE("stat_bench::repeat_unrolled") {
+    SECTION("call a function for all indices") {
+        const std::size_t iterations = GENERATE(0, 1, 3, 4, 9);
+
+        std::vector<std::size_t> indices;
+        stat_bench::repeat_unrolled<4>(iterations,
+            [&indices](std::size_t index) { indices.push_back(index); });
+
+        REQUIRE(indices.size() == iterations);
+        for (std::size_t i = 0; i < iterations; ++i) {
+            CHECK(indices.at(i) == i);
+        }
+    }
+
+    SECTION("call a function returning values") {
+        constexpr std::size_t iterations = 5;
+
+        std::size_t num_calls = 0;
+        stat_bench::repeat_unrolled<2>(iterations, [&num_calls](std::size_t) {
+            ++num_calls;
+            return num_calls;
+        });
+
+        REQUIRE(num_calls == iterations);
+    }
+}
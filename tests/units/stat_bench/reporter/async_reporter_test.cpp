@@ -0,0 +1,153 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of AsyncReporter class.
+ */
+#include "stat_bench/reporter/async_reporter.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <trompeloeil.hpp>
+
+#include "create_test_measurement.h"
+#include "mock_reporter.h"
+#include "stat_bench/bench_impl/benchmark_group_config.h"
+#include "stat_bench/benchmark_group_name.h"
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/clock/system_clock.h"
+#include "stat_bench/measurer/measurement_type.h"
+
+TEST_CASE("stat_bench::reporter::AsyncReporter") {
+    using stat_bench::BenchmarkGroupName;
+    using stat_bench::bench_impl::BenchmarkGroupConfig;
+    using stat_bench::clock::Duration;
+    using stat_bench::clock::SystemClock;
+    using stat_bench::measurer::Measurement;
+    using stat_bench::measurer::MeasurementType;
+    using stat_bench::reporter::AsyncReporter;
+    using stat_bench_test::reporter::MockReporter;
+
+    const auto mock_reporter1 = std::make_shared<MockReporter>();
+    const auto mock_reporter2 = std::make_shared<MockReporter>();
+
+    const std::string group_name = "Group1";
+    const std::string measurement_type = "Measurement1";
+    const auto measurement = stat_bench_test::create_test_measurement(
+        group_name, "Case1", measurement_type,
+        std::vector<std::vector<Duration>>{
+            std::vector<Duration>{Duration(1.0), Duration(2.0)}});
+
+    SECTION("forward events in order") {
+        trompeloeil::sequence seq;
+        REQUIRE_CALL(*mock_reporter1, experiment_starts(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter2, experiment_starts(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(
+            *mock_reporter1, group_starts(trompeloeil::_, trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(
+            *mock_reporter2, group_starts(trompeloeil::_, trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter1, measurement_type_starts(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter2, measurement_type_starts(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter1, case_starts(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter2, case_starts(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter1, measurement_succeeded(trompeloeil::_))
+            .WITH(_1->case_info().case_name().str() == "Case1")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter2, measurement_succeeded(trompeloeil::_))
+            .WITH(_1->case_info().case_name().str() == "Case1")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter1,
+            measurement_failed(trompeloeil::_, trompeloeil::_, trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter2,
+            measurement_failed(trompeloeil::_, trompeloeil::_, trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter1, case_finished(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter2, case_finished(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(
+            *mock_reporter1, measurement_type_finished(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(
+            *mock_reporter2, measurement_type_finished(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter1, group_finished(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter2, group_finished(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter1, experiment_finished(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(*mock_reporter2, experiment_finished(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+
+        AsyncReporter reporter{{mock_reporter1}};
+        reporter.add(mock_reporter2);
+        reporter.experiment_starts(SystemClock::now());
+        reporter.group_starts(
+            BenchmarkGroupName(group_name), BenchmarkGroupConfig());
+        reporter.measurement_type_starts(MeasurementType(measurement_type));
+        reporter.case_starts(measurement.case_info());
+        reporter.measurement_succeeded(
+            std::make_shared<const Measurement>(measurement));
+        reporter.measurement_failed(measurement.case_info(),
+            measurement.cond(),
+            std::make_exception_ptr(std::runtime_error("Test exception.")));
+        reporter.case_finished(measurement.case_info());
+        reporter.measurement_type_finished(MeasurementType(measurement_type));
+        reporter.group_finished(BenchmarkGroupName(group_name));
+        REQUIRE_NOTHROW(reporter.experiment_finished(SystemClock::now()));
+    }
+
+    SECTION("forward events with a small queue") {
+        constexpr std::size_t num_cases = 100;
+        REQUIRE_CALL(*mock_reporter1, case_starts(trompeloeil::_))
+            .TIMES(num_cases);
+        REQUIRE_CALL(*mock_reporter1, experiment_finished(trompeloeil::_))
+            .TIMES(1);
+
+        AsyncReporter reporter{{mock_reporter1}, std::nullopt, 2};
+        for (std::size_t i = 0; i < num_cases; ++i) {
+            reporter.case_starts(measurement.case_info());
+        }
+        REQUIRE_NOTHROW(reporter.experiment_finished(SystemClock::now()));
+    }
+
+    SECTION("rethrow exceptions in reporters") {
+        REQUIRE_CALL(*mock_reporter1, measurement_type_starts(trompeloeil::_))
+            .THROW(std::runtime_error("Test exception."));
+
+        AsyncReporter reporter{{mock_reporter1, mock_reporter2}};
+        reporter.measurement_type_starts(MeasurementType(measurement_type));
+        // Events after the exception are discarded.
+        REQUIRE_THROWS_AS(reporter.experiment_finished(SystemClock::now()),
+            std::runtime_error);
+        REQUIRE_THROWS_AS(reporter.case_starts(measurement.case_info()),
+            std::runtime_error);
+    }
+}
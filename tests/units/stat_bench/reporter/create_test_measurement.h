@@ -73,4 +73,35 @@ namespace stat_bench_test {
         std::vector<std::pair<CustomOutputName, double>>());
 }
 
+[[nodiscard]] inline auto create_test_measurement_with_size(
+    const std::string& group_name, const std::string& case_name,
+    const std::string& measurement_type, std::size_t size,
+    const std::vector<std::vector<stat_bench::clock::Duration>>& durations) {
+    using stat_bench::BenchmarkCaseName;
+    using stat_bench::BenchmarkCondition;
+    using stat_bench::BenchmarkFullName;
+    using stat_bench::BenchmarkGroupName;
+    using stat_bench::CustomOutputName;
+    using stat_bench::measurer::Measurement;
+    using stat_bench::measurer::MeasurementType;
+    using stat_bench::param::ParameterDict;
+    using stat_bench::param::ParameterName;
+    using stat_bench::param::ParameterValue;
+    using stat_bench::stat::CustomStatOutput;
+
+    constexpr std::size_t iterations = 1000;
+    const std::size_t samples = durations.front().size();
+    const std::size_t threads = durations.size();
+    return Measurement(BenchmarkFullName(BenchmarkGroupName(group_name),
+                           BenchmarkCaseName(case_name)),
+        BenchmarkCondition(
+            ParameterDict({{stat_bench::param::num_threads_parameter_name(),
+                               ParameterValue().emplace<std::size_t>(threads)},
+                {ParameterName("size"),
+                    ParameterValue().emplace<std::size_t>(size)}})),
+        MeasurementType(measurement_type), iterations, samples, durations,
+        std::vector<std::shared_ptr<CustomStatOutput>>(),
+        std::vector<std::pair<CustomOutputName, double>>());
+}
+
 }  // namespace stat_bench_test
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to help input and output of data files.
+ */
+#include "stat_bench/reporter/data_file_helper.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <fmt/format.h>
+
+#include "create_test_measurement.h"
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/measurer/fit_iteration_regression.h"
+#include "stat_bench/measurer/measurement.h"
+#include "stat_bench/param/parameter_name.h"
+#include "stat_bench/reporter/data_file_spec.h"
+#include "stat_bench/util/utf8_string.h"
+
+TEST_CASE("stat_bench::reporter::data_file_spec::restore") {
+    using stat_bench::param::ParameterName;
+    using stat_bench::reporter::data_file_spec::CustomOutputData;
+    using stat_bench::reporter::data_file_spec::CustomStatOutputData;
+    using stat_bench::reporter::data_file_spec::MeasurementData;
+    using stat_bench::reporter::data_file_spec::restore;
+    using stat_bench::util::Utf8String;
+
+    const auto create_data =
+        [](std::unordered_map<Utf8String, Utf8String> params) {
+            MeasurementData data;
+            data.group_name = Utf8String("Group");
+            data.case_name = Utf8String("Case");
+            data.params = std::move(params);
+            data.measurement_type = Utf8String("Processing Time");
+            data.iterations = 2;  // NOLINT
+            data.samples = 3;     // NOLINT
+            data.warming_up_samples = 4;  // NOLINT
+            data.durations.values = {{1.0F, 2.0F, 3.0F}, {4.0F, 5.0F, 6.0F}};
+            data.custom_stat_outputs = {CustomStatOutputData{
+                Utf8String("error"), {},
+                {{1.0F, 2.0F, 3.0F}, {4.0F, 5.0F, 6.0F}}}};
+            data.custom_outputs = {CustomOutputData{Utf8String("size"), 7.0F}};
+            return data;
+        };
+
+    SECTION("restore measurements") {
+        const std::vector<MeasurementData> data{
+            create_data({{Utf8String("threads"), Utf8String("2")},
+                {Utf8String("bool"), Utf8String("true")},
+                {Utf8String("int"), Utf8String("3")},
+                {Utf8String("float"), Utf8String("1")},
+                {Utf8String("str"), Utf8String("abc")}}),
+            create_data({{Utf8String("threads"), Utf8String("2")},
+                {Utf8String("bool"), Utf8String("false")},
+                {Utf8String("int"), Utf8String("-3")},
+                {Utf8String("float"), Utf8String("0.5")},
+                {Utf8String("str"), Utf8String("1")}})};
+
+        const auto measurements = restore(data);
+
+        REQUIRE(measurements.size() == 2);
+        const auto& measurement = measurements.at(1);
+        CHECK(measurement.case_info().group_name().str().str() == "Group");
+        CHECK(measurement.case_info().case_name().str().str() == "Case");
+        CHECK(measurement.measurement_type().str().str() == "Processing Time");
+        CHECK(measurement.iterations() == 2);
+        CHECK(measurement.samples() == 3);
+        CHECK(measurement.warming_up_samples() == 4);
+        CHECK(measurement.cond().threads() == 2);
+
+        const auto& params = measurement.cond().params();
+        CHECK(params.get<std::size_t>(ParameterName("threads")) == 2);
+        CHECK(params.get<bool>(ParameterName("bool")) == false);
+        CHECK(params.get<std::intmax_t>(ParameterName("int")) == -3);
+        CHECK(params.get<double>(ParameterName("float")) == 0.5);  // NOLINT
+        CHECK(params.get<std::string>(ParameterName("str")) == "1");
+        CHECK(fmt::format("{}", params) ==
+            "threads=2, bool=false, float=0.5, int=-3, str=1");
+
+        REQUIRE(measurement.durations().size() == 2);
+        REQUIRE(measurement.durations().at(1).size() == 3);
+        CHECK_THAT(measurement.durations().at(1).at(2).seconds(),
+            Catch::Matchers::WithinRel(6.0));
+
+        REQUIRE(measurement.custom_stat_outputs().size() == 1);
+        CHECK(measurement.custom_stat_outputs().at(0)->name().str().str() ==
+            "error");
+        CHECK_THAT(measurement.custom_stat().at(0).mean(),
+            Catch::Matchers::WithinRel(3.5));
+
+        REQUIRE(measurement.custom_outputs().size() == 1);
+        CHECK(measurement.custom_outputs().at(0).first.str().str() == "size");
+        CHECK_THAT(measurement.custom_outputs().at(0).second,
+            Catch::Matchers::WithinRel(7.0));
+    }
+}
+
+TEST_CASE("stat_bench::reporter::data_file_spec::convert") {
+    using stat_bench::clock::Duration;
+    using stat_bench::measurer::Measurement;
+    using stat_bench::reporter::data_file_spec::convert;
+
+    SECTION("convert results of linear regression on numbers of iterations") {
+        const auto original = stat_bench_test::create_test_measurement(
+            "Group", "Case", "Regression Processing Time",
+            std::vector<std::vector<Duration>>{
+                {Duration(1.0), Duration(2.5), Duration(2.5)}});  // NOLINT
+        constexpr std::size_t base_iterations = 2;
+        const auto regression = stat_bench::measurer::fit_iteration_regression(
+            original.durations(), base_iterations);
+        const Measurement measurement(original.case_info(), original.cond(),
+            original.measurement_type(), original.iterations(),
+            original.samples(), original.durations(),
+            original.custom_stat_outputs(), original.custom_outputs(), 0,
+            regression);
+
+        const auto data =
+            convert(measurement, *measurement.iteration_regression());
+
+        CHECK(data.group_name.str() == "Group");
+        CHECK(data.case_name.str() == "Case");
+        CHECK(data.measurement_type.str() == "Regression Processing Time");
+        CHECK(data.params == convert(measurement.cond().params()));
+        CHECK_THAT(data.ordinary_least_squares.slope,
+            Catch::Matchers::WithinRel(0.375F));  // NOLINT
+        CHECK_THAT(data.ordinary_least_squares.intercept,
+            Catch::Matchers::WithinRel(0.5F));  // NOLINT
+        CHECK(data.ordinary_least_squares.slope_lower <
+            data.ordinary_least_squares.slope);
+        CHECK(data.ordinary_least_squares.slope_upper >
+            data.ordinary_least_squares.slope);
+        CHECK_THAT(data.theil_sen.slope,
+            Catch::Matchers::WithinRel(0.375F));  // NOLINT
+    }
+}
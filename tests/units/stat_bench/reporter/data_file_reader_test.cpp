@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of read_data_file function.
+ */
+#include "stat_bench/reporter/data_file_reader.h"
+
+#include <memory>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "stat_bench/reporter/compressed_msgpack_reporter.h"
+#include "stat_bench/reporter/data_file_reporter_base.h"
+#include "stat_bench/reporter/json_reporter.h"
+#include "stat_bench/reporter/msgpack_reporter.h"
+#include "stat_bench/stat_bench_exception.h"
+#include "use_reporter_for_test.h"
+
+TEST_CASE("stat_bench::reporter::read_data_file") {
+    using stat_bench::reporter::read_data_file;
+
+    const auto check_data =
+        [](const stat_bench::reporter::data_file_spec::RootData& data) {
+            REQUIRE(data.measurements.size() == 9);
+            const auto& measurement1 = data.measurements.at(0);
+            CHECK(measurement1.group_name.str() == "Group1");
+            CHECK(measurement1.case_name.str() == "Case1");
+            CHECK(measurement1.measurement_type.str() == "Measurement1");
+            CHECK(measurement1.params.at(stat_bench::util::Utf8String("param"))
+                      .str() == "value");
+            REQUIRE(measurement1.durations.values.size() == 1);
+            REQUIRE(measurement1.durations.values.at(0).size() == 2);
+            CHECK_THAT(measurement1.durations.values.at(0).at(1),
+                Catch::Matchers::WithinRel(2.0F));
+
+            const auto& measurement2 = data.measurements.at(1);
+            CHECK(measurement2.case_name.str() == "Case2");
+            REQUIRE(measurement2.durations.values.size() == 1);
+            CHECK(measurement2.durations.values.at(0).size() == 3);
+
+            const auto& measurement3 = data.measurements.at(2);
+            CHECK(measurement3.case_name.str() == "Case4");
+            CHECK(measurement3.durations.drift.drifting);
+
+            const auto& measurement6 = data.measurements.at(5);
+            CHECK(measurement6.group_name.str() == "Group2");
+            CHECK(measurement6.durations.values.size() == 4);
+
+            REQUIRE(data.complexity_fits.size() == 1);
+            const auto& fit = data.complexity_fits.at(0);
+            CHECK(fit.group_name.str() == "Group3");
+            CHECK(fit.parameter_name.str() == "size");
+            CHECK(fit.model.str() == "O(n)");
+        };
+
+    SECTION("read a JSON file") {
+        const auto file_path = std::string("./DataFileReaderTest.json");
+        const auto reporter =
+            std::make_shared<stat_bench::reporter::JsonReporter>(file_path);
+        stat_bench_test::use_reporter_for_test(reporter.get());
+
+        check_data(read_data_file(file_path));
+    }
+
+    SECTION("read a MsgPack file") {
+        const auto file_path = std::string("./DataFileReaderTest.data");
+        const auto reporter =
+            std::make_shared<stat_bench::reporter::MsgPackReporter>(file_path);
+        stat_bench_test::use_reporter_for_test(reporter.get());
+
+        check_data(read_data_file(file_path));
+    }
+
+    SECTION("read a compressed MsgPack file") {
+        const auto file_path = std::string("./DataFileReaderTest.data.gz");
+        const auto reporter =
+            std::make_shared<stat_bench::reporter::CompressedMsgPackReporter>(
+                file_path);
+        stat_bench_test::use_reporter_for_test(reporter.get());
+
+        check_data(read_data_file(file_path));
+    }
+
+    SECTION("read a non-existing file") {
+        CHECK_THROWS_AS(read_data_file("./DataFileReaderTest.non_existing"),
+            stat_bench::StatBenchException);
+    }
+}
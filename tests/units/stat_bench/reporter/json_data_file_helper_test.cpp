@@ -29,9 +29,11 @@
 #include "stat_bench/util/utf8_string.h"
 
 TEST_CASE("NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE definitions") {
+    using stat_bench::reporter::data_file_spec::ComplexityFitData;
     using stat_bench::reporter::data_file_spec::CustomOutputData;
     using stat_bench::reporter::data_file_spec::CustomStatOutputData;
     using stat_bench::reporter::data_file_spec::DurationData;
+    using stat_bench::reporter::data_file_spec::IterationRegressionData;
     using stat_bench::reporter::data_file_spec::MeasurementData;
     using stat_bench::reporter::data_file_spec::RootData;
     using stat_bench::reporter::data_file_spec::StatData;
@@ -41,6 +43,9 @@ TEST_CASE("NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE definitions") {
         RootData data;
         data.started_at = Utf8String("2021-12-28T21:27:01");
         data.finished_at = Utf8String("2021-12-28T21:27:07");
+        data.cache_sizes.l1d = 49152;      // NOLINT
+        data.cache_sizes.l2 = 2097152;     // NOLINT
+        data.cache_sizes.l3 = 110100480;  // NOLINT
 
         MeasurementData measurement{};
         measurement.group_name = Utf8String("Group");
@@ -49,6 +54,7 @@ TEST_CASE("NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE definitions") {
         measurement.measurement_type = Utf8String("Measurer");
         measurement.iterations = 123;  // NOLINT
         measurement.samples = 12345;   // NOLINT
+        measurement.warming_up_samples = 67;  // NOLINT
 
         measurement.durations.stat.mean = 1.234F;                 // NOLINT
         measurement.durations.stat.max = 2.345F;                  // NOLINT
@@ -57,6 +63,11 @@ TEST_CASE("NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE definitions") {
         measurement.durations.stat.standard_deviation = 0.0123F;  // NOLINT
         measurement.durations.values = std::vector<std::vector<float>>{
             {1.0F, 2.0F, 3.0F}, {4.0F, 5.0F, 6.0F}};  // NOLINT
+        measurement.durations.drift.lag1_autocorrelation = 0.25F;   // NOLINT
+        measurement.durations.drift.mann_kendall_z = 3.5F;          // NOLINT
+        measurement.durations.drift.mann_kendall_p_value = 0.001F;  // NOLINT
+        measurement.durations.drift.effective_sample_size = 3.6F;   // NOLINT
+        measurement.durations.drift.drifting = true;
 
         CustomStatOutputData stat_output{};
         stat_output.name = Utf8String("Stat");
@@ -74,12 +85,44 @@ TEST_CASE("NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE definitions") {
 
         data.measurements.push_back(measurement);
 
+        ComplexityFitData complexity_fit{};
+        complexity_fit.group_name = Utf8String("Group");
+        complexity_fit.case_name = Utf8String("Case");
+        complexity_fit.measurement_type = Utf8String("Measurer");
+        complexity_fit.params[Utf8String("Param")] = Utf8String("Value");
+        complexity_fit.parameter_name = Utf8String("Size");
+        complexity_fit.model = Utf8String("O(n^1.52)");
+        complexity_fit.coefficient = 1.234e-9F;  // NOLINT
+        complexity_fit.exponent = 1.52F;         // NOLINT
+        complexity_fit.r_squared = 0.998F;       // NOLINT
+        data.complexity_fits.push_back(complexity_fit);
+
+        IterationRegressionData regression{};
+        regression.group_name = Utf8String("Group");
+        regression.case_name = Utf8String("Case");
+        regression.measurement_type = Utf8String("Measurer");
+        regression.params[Utf8String("Param")] = Utf8String("Value");
+        regression.ordinary_least_squares.slope = 1.5e-9F;        // NOLINT
+        regression.ordinary_least_squares.intercept = 2.0e-8F;    // NOLINT
+        regression.ordinary_least_squares.slope_lower = 1.4e-9F;  // NOLINT
+        regression.ordinary_least_squares.slope_upper = 1.6e-9F;  // NOLINT
+        regression.ordinary_least_squares.r_squared = 0.99F;      // NOLINT
+        regression.theil_sen.slope = 1.45e-9F;                    // NOLINT
+        regression.theil_sen.intercept = 2.5e-8F;                 // NOLINT
+        regression.theil_sen.slope_lower = 1.42e-9F;              // NOLINT
+        regression.theil_sen.slope_upper = 1.48e-9F;              // NOLINT
+        regression.theil_sen.r_squared = 0.98F;                   // NOLINT
+        data.iteration_regressions.push_back(regression);
+
         const std::string serialized = nlohmann::json(data).dump();
         const auto deserialized =
             nlohmann::json::parse(serialized).get<RootData>();
 
         REQUIRE(deserialized.started_at == data.started_at);
         REQUIRE(deserialized.finished_at == data.finished_at);
+        REQUIRE(deserialized.cache_sizes.l1d == data.cache_sizes.l1d);
+        REQUIRE(deserialized.cache_sizes.l2 == data.cache_sizes.l2);
+        REQUIRE(deserialized.cache_sizes.l3 == data.cache_sizes.l3);
         REQUIRE(deserialized.measurements.size() == data.measurements.size());
 
         const auto& deserialized_measurement = deserialized.measurements.at(0);
@@ -90,6 +133,8 @@ TEST_CASE("NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE definitions") {
             measurement.measurement_type);
         REQUIRE(deserialized_measurement.iterations == measurement.iterations);
         REQUIRE(deserialized_measurement.samples == measurement.samples);
+        REQUIRE(deserialized_measurement.warming_up_samples ==
+            measurement.warming_up_samples);
 
         REQUIRE(deserialized_measurement.durations.stat.mean ==
             measurement.durations.stat.mean);
@@ -103,6 +148,17 @@ TEST_CASE("NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE definitions") {
             measurement.durations.stat.standard_deviation);
         REQUIRE(deserialized_measurement.durations.values ==
             measurement.durations.values);
+        REQUIRE(deserialized_measurement.durations.drift.lag1_autocorrelation ==
+            measurement.durations.drift.lag1_autocorrelation);
+        REQUIRE(deserialized_measurement.durations.drift.mann_kendall_z ==
+            measurement.durations.drift.mann_kendall_z);
+        REQUIRE(deserialized_measurement.durations.drift.mann_kendall_p_value ==
+            measurement.durations.drift.mann_kendall_p_value);
+        REQUIRE(
+            deserialized_measurement.durations.drift.effective_sample_size ==
+            measurement.durations.drift.effective_sample_size);
+        REQUIRE(deserialized_measurement.durations.drift.drifting ==
+            measurement.durations.drift.drifting);
 
         REQUIRE(deserialized_measurement.custom_stat_outputs.size() ==
             measurement.custom_stat_outputs.size());
@@ -124,5 +180,61 @@ TEST_CASE("NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE definitions") {
             measurement.custom_outputs.at(0).name);
         REQUIRE(deserialized_measurement.custom_outputs.at(0).value ==
             measurement.custom_outputs.at(0).value);
+
+        REQUIRE(deserialized.complexity_fits.size() == 1);
+        const auto& deserialized_fit = deserialized.complexity_fits.at(0);
+        REQUIRE(deserialized_fit.group_name == complexity_fit.group_name);
+        REQUIRE(deserialized_fit.case_name == complexity_fit.case_name);
+        REQUIRE(deserialized_fit.measurement_type ==
+            complexity_fit.measurement_type);
+        REQUIRE(deserialized_fit.params == complexity_fit.params);
+        REQUIRE(
+            deserialized_fit.parameter_name == complexity_fit.parameter_name);
+        REQUIRE(deserialized_fit.model == complexity_fit.model);
+        REQUIRE(deserialized_fit.coefficient == complexity_fit.coefficient);
+        REQUIRE(deserialized_fit.exponent == complexity_fit.exponent);
+        REQUIRE(deserialized_fit.r_squared == complexity_fit.r_squared);
+
+        REQUIRE(deserialized.iteration_regressions.size() == 1);
+        const auto& deserialized_regression =
+            deserialized.iteration_regressions.at(0);
+        REQUIRE(deserialized_regression.group_name == regression.group_name);
+        REQUIRE(deserialized_regression.case_name == regression.case_name);
+        REQUIRE(deserialized_regression.measurement_type ==
+            regression.measurement_type);
+        REQUIRE(deserialized_regression.params == regression.params);
+        const auto& deserialized_ols =
+            deserialized_regression.ordinary_least_squares;
+        const auto& ols = regression.ordinary_least_squares;
+        REQUIRE(deserialized_ols.slope == ols.slope);
+        REQUIRE(deserialized_ols.intercept == ols.intercept);
+        REQUIRE(deserialized_ols.slope_lower == ols.slope_lower);
+        REQUIRE(deserialized_ols.slope_upper == ols.slope_upper);
+        REQUIRE(deserialized_ols.r_squared == ols.r_squared);
+        const auto& deserialized_theil_sen = deserialized_regression.theil_sen;
+        const auto& theil_sen = regression.theil_sen;
+        REQUIRE(deserialized_theil_sen.slope == theil_sen.slope);
+        REQUIRE(deserialized_theil_sen.intercept == theil_sen.intercept);
+        REQUIRE(deserialized_theil_sen.slope_lower == theil_sen.slope_lower);
+        REQUIRE(deserialized_theil_sen.slope_upper == theil_sen.slope_upper);
+        REQUIRE(deserialized_theil_sen.r_squared == theil_sen.r_squared);
+    }
+
+    SECTION("deserialize data without cache sizes and complexity fits") {
+        const auto json = nlohmann::json::parse(R"({
+            "started_at": "2021-12-28T21:27:01",
+            "finished_at": "2021-12-28T21:27:07",
+            "measurements": []
+        })");
+
+        const auto deserialized = json.get<RootData>();
+
+        REQUIRE(deserialized.started_at.str() == "2021-12-28T21:27:01");
+        REQUIRE(deserialized.cache_sizes.l1d == 0);
+        REQUIRE(deserialized.cache_sizes.l2 == 0);
+        REQUIRE(deserialized.cache_sizes.l3 == 0);
+        REQUIRE(deserialized.measurements.empty());
+        REQUIRE(deserialized.complexity_fits.empty());
+        REQUIRE(deserialized.iteration_regressions.empty());
     }
 }
@@ -54,6 +54,10 @@ TEST_CASE("stat_bench::reporter::JsonReporter") {
                     [time_scrubber = ApprovalTests::Scrubbers::createRegexScrubber(
                          R"(\d\d\d\d-\d\d-\d\dT\d\d:\d\d:\d\d\.\d\d\d\d\d\d[+-]\d\d\d\d)",
                          "<time>"),
+                        cache_sizes_scrubber =
+                            ApprovalTests::Scrubbers::createRegexScrubber(
+                                R"("cache_sizes": \{[^}]*\})",
+                                R"("cache_sizes": <cache_sizes>)"),
                         float3_scrubber =
                             ApprovalTests::Scrubbers::createRegexScrubber(
                                 std::regex(
@@ -68,9 +72,50 @@ TEST_CASE("stat_bench::reporter::JsonReporter") {
                                     return fmt::format(
                                         "{:.3e}", val.get<double>());
                                 })](const std::string& contents) {
-                        return float3_scrubber(time_scrubber(contents));
+                        return float3_scrubber(
+                            cache_sizes_scrubber(time_scrubber(contents)));
                     })
                 .fileOptions()
                 .withFileExtension(".json"));
     }
+
+    SECTION("write in compact format") {
+        const auto pretty_filepath =
+            std::string("./JsonReporterTestPretty.json");
+        const auto compact_filepath =
+            std::string("./JsonReporterTestCompact.json");
+
+        const auto pretty_reporter =
+            std::make_shared<stat_bench::reporter::JsonReporter>(
+                pretty_filepath, stat_bench::reporter::JsonFormat::pretty);
+        REQUIRE_NOTHROW(
+            stat_bench_test::use_reporter_for_test(pretty_reporter.get()));
+        const auto compact_reporter =
+            std::make_shared<stat_bench::reporter::JsonReporter>(
+                compact_filepath, stat_bench::reporter::JsonFormat::compact);
+        REQUIRE_NOTHROW(
+            stat_bench_test::use_reporter_for_test(compact_reporter.get()));
+
+        const auto pretty_contents =
+            stat_bench_test::read_file(pretty_filepath);
+        const auto compact_contents =
+            stat_bench_test::read_file(compact_filepath);
+        CHECK(compact_contents.find('\n') == std::string::npos);
+        CHECK(compact_contents.find("  ") == std::string::npos);
+        CHECK(compact_contents.find("{ ") == std::string::npos);
+        CHECK(compact_contents.find("\": ") == std::string::npos);
+        CHECK(compact_contents.find(", ") == std::string::npos);
+        CHECK(compact_contents.size() < pretty_contents.size());
+
+        // Times differ because the reporters are used at different times.
+        auto pretty_data = nlohmann::json::parse(pretty_contents);
+        auto compact_data = nlohmann::json::parse(compact_contents);
+        for (const auto* key : {"started_at", "finished_at"}) {
+            REQUIRE(pretty_data.contains(key));
+            REQUIRE(compact_data.contains(key));
+            pretty_data.erase(key);
+            compact_data.erase(key);
+        }
+        CHECK(compact_data == pretty_data);
+    }
 }
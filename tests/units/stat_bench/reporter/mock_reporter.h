@@ -20,6 +20,7 @@
 #pragma once
 
 #include <exception>
+#include <memory>
 
 #include "../../trompeloeil.h"
 #include "stat_bench/bench_impl/benchmark_group_config.h"
@@ -71,7 +72,8 @@ public:
 
     // NOLINTNEXTLINE
     MAKE_MOCK1(measurement_succeeded,
-        void(const stat_bench::measurer::Measurement&), override);
+        void(const std::shared_ptr<const stat_bench::measurer::Measurement>&),
+        override);
 
     // NOLINTNEXTLINE
     MAKE_MOCK3(measurement_failed,
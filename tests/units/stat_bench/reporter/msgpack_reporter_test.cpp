@@ -55,6 +55,10 @@ TEST_CASE("stat_bench::reporter::MsgPackReporter") {
                     [time_scrubber = ApprovalTests::Scrubbers::createRegexScrubber(
                          R"(\d\d\d\d-\d\d-\d\dT\d\d:\d\d:\d\d\.\d\d\d\d\d\d[+-]\d\d\d\d)",
                          "<time>"),
+                        cache_sizes_scrubber =
+                            ApprovalTests::Scrubbers::createRegexScrubber(
+                                R"("cache_sizes": \{[^}]*\})",
+                                R"("cache_sizes": <cache_sizes>)"),
                         float3_scrubber =
                             ApprovalTests::Scrubbers::createRegexScrubber(
                                 std::regex(
@@ -69,7 +73,8 @@ TEST_CASE("stat_bench::reporter::MsgPackReporter") {
                                     return fmt::format(
                                         "{:.3e}", val.get<double>());
                                 })](const std::string& contents) {
-                        return float3_scrubber(time_scrubber(contents));
+                        return float3_scrubber(
+                            cache_sizes_scrubber(time_scrubber(contents)));
                     })
                 .fileOptions()
                 .withFileExtension(".json"));
@@ -19,12 +19,15 @@
  */
 #include "stat_bench/reporter/plot_reporter.h"
 
+#include <cstddef>
 #include <filesystem>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <fmt/format.h>
 
 #include "remove_directory.h"
+#include "stat_bench/plots/decimate_samples.h"
 #include "use_reporter_for_test.h"
 
 TEST_CASE("stat_bench::reporter::PlotReporter") {
@@ -43,4 +46,23 @@ TEST_CASE("stat_bench::reporter::PlotReporter") {
         CHECK(std::filesystem::exists(
             fmt::format("{}/Group1/Measurement1_violin.html", prefix)));
     }
+
+    SECTION("write density plots instead of violin plots for many samples") {
+        const auto prefix = std::string("./PlotReporterDensity");
+        remove_directory(prefix);
+
+        // A case in use_reporter_for_test has three samples.
+        constexpr std::size_t density_plot_threshold = 2;
+        const auto reporter =
+            std::make_shared<stat_bench::reporter::PlotReporter>(prefix,
+                stat_bench::plots::default_max_points_per_trace,
+                stat_bench::reporter::PlotReporter::default_num_threads,
+                std::vector<std::size_t>{}, density_plot_threshold);
+        REQUIRE_NOTHROW(stat_bench_test::use_reporter_for_test(reporter.get()));
+
+        CHECK(std::filesystem::exists(
+            fmt::format("{}/Group1/Measurement1_density.html", prefix)));
+        CHECK_FALSE(std::filesystem::exists(
+            fmt::format("{}/Group1/Measurement1_violin.html", prefix)));
+    }
 }
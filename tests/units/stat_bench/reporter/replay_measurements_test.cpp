@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of replay_measurements function.
+ */
+#include "stat_bench/reporter/replay_measurements.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <trompeloeil.hpp>
+
+#include "create_test_measurement.h"
+#include "mock_reporter.h"
+#include "stat_bench/bench_impl/benchmark_group_config.h"
+#include "stat_bench/benchmark_group_name.h"
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/measurer/measurement.h"
+
+TEST_CASE("stat_bench::reporter::replay_measurements") {
+    using stat_bench::BenchmarkGroupName;
+    using stat_bench::bench_impl::BenchmarkGroupConfig;
+    using stat_bench::clock::Duration;
+    using stat_bench::measurer::Measurement;
+    using stat_bench::reporter::replay_measurements;
+    using stat_bench_test::reporter::MockReporter;
+
+    const auto create_measurement = [](const std::string& group_name,
+                                        const std::string& case_name,
+                                        const std::string& measurement_type) {
+        return stat_bench_test::create_test_measurement(group_name, case_name,
+            measurement_type,
+            std::vector<std::vector<Duration>>{
+                std::vector<Duration>{Duration(1.0), Duration(2.0)}});
+    };
+
+    SECTION("report measurements by groups and measurement types") {
+        std::vector<Measurement> measurements;
+        measurements.push_back(create_measurement("Group1", "Case1", "Type1"));
+        measurements.push_back(create_measurement("Group2", "Case1", "Type1"));
+        measurements.push_back(create_measurement("Group1", "Case1", "Type2"));
+        measurements.push_back(create_measurement("Group1", "Case2", "Type1"));
+
+        MockReporter reporter;
+        std::vector<std::string> configured_groups;
+        trompeloeil::sequence seq;
+        REQUIRE_CALL(reporter, experiment_starts(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, group_starts(trompeloeil::_, trompeloeil::_))
+            .WITH(_1.str() == "Group1" && _2.plots().size() == 1)
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, measurement_type_starts(trompeloeil::_))
+            .WITH(_1.str() == "Type1")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, case_starts(trompeloeil::_))
+            .WITH(_1.case_name().str() == "Case1")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, measurement_succeeded(trompeloeil::_))
+            .WITH(_1->case_info().case_name().str() == "Case1")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, case_finished(trompeloeil::_))
+            .WITH(_1.case_name().str() == "Case1")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, case_starts(trompeloeil::_))
+            .WITH(_1.case_name().str() == "Case2")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, measurement_succeeded(trompeloeil::_))
+            .WITH(_1->case_info().case_name().str() == "Case2")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, case_finished(trompeloeil::_))
+            .WITH(_1.case_name().str() == "Case2")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, measurement_type_finished(trompeloeil::_))
+            .WITH(_1.str() == "Type1")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, measurement_type_starts(trompeloeil::_))
+            .WITH(_1.str() == "Type2")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, case_starts(trompeloeil::_)).IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, measurement_succeeded(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, case_finished(trompeloeil::_)).IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, measurement_type_finished(trompeloeil::_))
+            .WITH(_1.str() == "Type2")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, group_finished(trompeloeil::_))
+            .WITH(_1.str() == "Group1")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, group_starts(trompeloeil::_, trompeloeil::_))
+            .WITH(_1.str() == "Group2" && _2.plots().size() == 1)
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, measurement_type_starts(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, case_starts(trompeloeil::_)).IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, measurement_succeeded(trompeloeil::_))
+            .WITH(_1->case_info().group_name().str() == "Group2")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, case_finished(trompeloeil::_)).IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, measurement_type_finished(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, group_finished(trompeloeil::_))
+            .WITH(_1.str() == "Group2")
+            .IN_SEQUENCE(seq);
+        REQUIRE_CALL(reporter, experiment_finished(trompeloeil::_))
+            .IN_SEQUENCE(seq);
+
+        replay_measurements(std::move(measurements), reporter,
+            [&configured_groups](const BenchmarkGroupName& group_name,
+                BenchmarkGroupConfig& config) {
+                configured_groups.push_back(group_name.str().str());
+                config.add_plot(nullptr);
+            });
+
+        CHECK(configured_groups ==
+            std::vector<std::string>{"Group1", "Group2"});
+    }
+}
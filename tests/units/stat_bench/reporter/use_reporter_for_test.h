@@ -19,7 +19,9 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <exception>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -31,6 +33,7 @@
 #include "stat_bench/clock/system_clock.h"
 #include "stat_bench/measurer/measurement.h"
 #include "stat_bench/measurer/measurement_type.h"
+#include "stat_bench/param/parameter_name.h"
 #include "stat_bench/reporter/i_reporter.h"
 
 namespace stat_bench_test {
@@ -47,6 +50,7 @@ inline void use_reporter_for_test(stat_bench::reporter::IReporter* reporter) {
     using stat_bench::clock::SystemClock;
     using stat_bench::measurer::Measurement;
     using stat_bench::measurer::MeasurementType;
+    using stat_bench::param::ParameterName;
 
     reporter->experiment_starts(SystemClock::now());
     const std::string measurement_type = "Measurement1";
@@ -60,7 +64,8 @@ inline void use_reporter_for_test(stat_bench::reporter::IReporter* reporter) {
         std::vector<std::vector<Duration>>{
             std::vector<Duration>{create_duration(1.0), create_duration(2.0)}});
     reporter->case_starts(measurement1.case_info());
-    reporter->measurement_succeeded(measurement1);
+    reporter->measurement_succeeded(
+        std::make_shared<const Measurement>(measurement1));
     reporter->case_finished(measurement1.case_info());
 
     const auto measurement2 = stat_bench_test::create_test_measurement(
@@ -68,7 +73,8 @@ inline void use_reporter_for_test(stat_bench::reporter::IReporter* reporter) {
         std::vector<std::vector<Duration>>{std::vector<Duration>{
             create_duration(3.0), create_duration(4.0), create_duration(5.0)}});
     reporter->case_starts(measurement2.case_info());
-    reporter->measurement_succeeded(measurement2);
+    reporter->measurement_succeeded(
+        std::make_shared<const Measurement>(measurement2));
     reporter->case_finished(measurement2.case_info());
 
     const auto measurement3 = stat_bench_test::create_test_measurement(
@@ -79,8 +85,86 @@ inline void use_reporter_for_test(stat_bench::reporter::IReporter* reporter) {
         std::make_exception_ptr(std::runtime_error("Test exception.")));
     reporter->case_finished(measurement3.case_info());
 
+    // Durations increasing monotonically in samples are diagnosed as drifts.
+    std::vector<Duration> drifting_durations;
+    constexpr std::size_t drifting_samples = 10;
+    for (std::size_t i = 0; i < drifting_samples; ++i) {
+        drifting_durations.push_back(
+            create_duration(1.0 + 0.1 * static_cast<double>(i)));  // NOLINT
+    }
+    const auto measurement4 = stat_bench_test::create_test_measurement(
+        group1_name, "Case4", measurement_type,
+        std::vector<std::vector<Duration>>{drifting_durations});
+    reporter->case_starts(measurement4.case_info());
+    reporter->measurement_succeeded(
+        std::make_shared<const Measurement>(measurement4));
+    reporter->case_finished(measurement4.case_info());
+
     reporter->measurement_type_finished(MeasurementType(measurement_type));
     reporter->group_finished(BenchmarkGroupName(group1_name));
+
+    // Group with numbers of threads to analyze scaling with threads.
+    const std::string group2_name = "Group2";
+    reporter->group_starts(
+        BenchmarkGroupName(group2_name), BenchmarkGroupConfig());
+    reporter->measurement_type_starts(MeasurementType(measurement_type));
+
+    const auto thread_measurements = std::vector<Measurement>{
+        stat_bench_test::create_test_measurement(group2_name, "Case1",
+            measurement_type,
+            std::vector<std::vector<Duration>>{
+                {create_duration(0.9), create_duration(1.1)}}),
+        stat_bench_test::create_test_measurement(group2_name, "Case1",
+            measurement_type,
+            std::vector<std::vector<Duration>>{
+                {create_duration(1.2), create_duration(1.3)},
+                {create_duration(1.25), create_duration(1.25)}}),
+        stat_bench_test::create_test_measurement(group2_name, "Case1",
+            measurement_type,
+            std::vector<std::vector<Duration>>{
+                {create_duration(1.9), create_duration(2.1)},
+                {create_duration(2.0), create_duration(2.0)},
+                {create_duration(2.1), create_duration(1.9)},
+                {create_duration(2.0), create_duration(2.0)}})};
+    for (const auto& measurement : thread_measurements) {
+        reporter->case_starts(measurement.case_info());
+        reporter->measurement_succeeded(
+            std::make_shared<const Measurement>(measurement));
+        reporter->case_finished(measurement.case_info());
+    }
+
+    reporter->measurement_type_finished(MeasurementType(measurement_type));
+    reporter->group_finished(BenchmarkGroupName(group2_name));
+
+    // Group with sizes to fit models of asymptotic complexity.
+    const std::string group3_name = "Group3";
+    BenchmarkGroupConfig group3_config;
+    group3_config.add_complexity_parameter(ParameterName("size"));
+    reporter->group_starts(BenchmarkGroupName(group3_name), group3_config);
+    reporter->measurement_type_starts(MeasurementType(measurement_type));
+
+    const auto size_measurements = std::vector<Measurement>{
+        stat_bench_test::create_test_measurement_with_size(group3_name,
+            "Case1", measurement_type, 10,  // NOLINT
+            std::vector<std::vector<Duration>>{
+                {create_duration(0.009), create_duration(0.011)}}),
+        stat_bench_test::create_test_measurement_with_size(group3_name,
+            "Case1", measurement_type, 100,  // NOLINT
+            std::vector<std::vector<Duration>>{
+                {create_duration(0.09), create_duration(0.11)}}),
+        stat_bench_test::create_test_measurement_with_size(group3_name,
+            "Case1", measurement_type, 1000,  // NOLINT
+            std::vector<std::vector<Duration>>{
+                {create_duration(0.9), create_duration(1.1)}})};
+    for (const auto& measurement : size_measurements) {
+        reporter->case_starts(measurement.case_info());
+        reporter->measurement_succeeded(
+            std::make_shared<const Measurement>(measurement));
+        reporter->case_finished(measurement.case_info());
+    }
+
+    reporter->measurement_type_finished(MeasurementType(measurement_type));
+    reporter->group_finished(BenchmarkGroupName(group3_name));
     reporter->experiment_finished(SystemClock::now());
 }
 
@@ -19,6 +19,7 @@
  */
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -57,7 +58,8 @@ inline void use_reporter_for_test_wide_range(
         std::vector<std::vector<Duration>>{
             std::vector<Duration>{create_duration(1.2345e-3)}});
     reporter->case_starts(measurement1.case_info());
-    reporter->measurement_succeeded(measurement1);
+    reporter->measurement_succeeded(
+        std::make_shared<const Measurement>(measurement1));
     reporter->case_finished(measurement1.case_info());
 
     const auto measurement2 = stat_bench_test::create_test_measurement(
@@ -65,7 +67,8 @@ inline void use_reporter_for_test_wide_range(
         std::vector<std::vector<Duration>>{
             std::vector<Duration>{create_duration(1.234567)}});
     reporter->case_starts(measurement2.case_info());
-    reporter->measurement_succeeded(measurement2);
+    reporter->measurement_succeeded(
+        std::make_shared<const Measurement>(measurement2));
     reporter->case_finished(measurement2.case_info());
 
     const auto measurement3 = stat_bench_test::create_test_measurement(
@@ -73,7 +76,8 @@ inline void use_reporter_for_test_wide_range(
         std::vector<std::vector<Duration>>{
             std::vector<Duration>{create_duration(1234.56789)}});
     reporter->case_starts(measurement3.case_info());
-    reporter->measurement_succeeded(measurement3);
+    reporter->measurement_succeeded(
+        std::make_shared<const Measurement>(measurement3));
     reporter->case_finished(measurement3.case_info());
 
     reporter->measurement_type_finished(MeasurementType(measurement_type));
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of Runner class.
+ */
+#include "stat_bench/runner/runner.h"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+#include <trompeloeil.hpp>
+
+#include "../mock_benchmark_case.h"
+#include "../reporter/mock_reporter.h"
+#include "stat_bench/bench_impl/benchmark_case_registry.h"
+#include "stat_bench/benchmark_case_name.h"
+#include "stat_bench/benchmark_full_name.h"
+#include "stat_bench/benchmark_group_name.h"
+#include "stat_bench/param/num_threads_parameter_name.h"
+#include "stat_bench/param/parameter_config.h"
+#include "stat_bench/runner/config.h"
+#include "stat_bench/stat_bench_exception.h"
+
+TEST_CASE("stat_bench::runner::Runner") {
+    using stat_bench::bench_impl::BenchmarkCaseRegistry;
+    using stat_bench::runner::Config;
+    using stat_bench::runner::Runner;
+
+    BenchmarkCaseRegistry registry;
+    Config config;
+    config.sync_reporters = true;
+
+    SECTION("create with a method to sample parameters") {
+        config.param_sampling = "random";
+        config.max_conditions = 10;  // NOLINT
+        config.param_sampling_seed = 1;
+
+        std::optional<Runner> runner;
+        CHECK_NOTHROW(runner.emplace(config, registry));
+    }
+
+    SECTION("reject the maximum number of conditions without a method") {
+        config.max_conditions = 10;  // NOLINT
+
+        std::optional<Runner> runner;
+        CHECK_THROWS_AS(
+            runner.emplace(config, registry), stat_bench::StatBenchException);
+    }
+
+    SECTION("reject a seed without a method") {
+        config.param_sampling_seed = 1;
+
+        std::optional<Runner> runner;
+        CHECK_THROWS_AS(
+            runner.emplace(config, registry), stat_bench::StatBenchException);
+    }
+
+    SECTION("release cached resources when a reporter throws an exception") {
+        const auto bench_case = std::make_shared<
+            stat_bench_test::bench_impl::MockBenchmarkCase>();
+        const auto info = stat_bench::BenchmarkFullName(
+            stat_bench::BenchmarkGroupName("group"),
+            stat_bench::BenchmarkCaseName("case"));
+        stat_bench::param::ParameterConfig params;
+        params
+            .add<std::size_t>(
+                stat_bench::param::num_threads_parameter_name())
+            ->add(1);
+        // NOLINTNEXTLINE
+        ALLOW_CALL(*bench_case, info()).RETURN(info);
+        // NOLINTNEXTLINE
+        ALLOW_CALL(*bench_case, params()).RETURN(params);
+        // NOLINTNEXTLINE
+        ALLOW_CALL(*bench_case, execute())
+            .THROW(std::runtime_error("Test exception."));
+        // NOLINTNEXTLINE
+        REQUIRE_CALL(*bench_case, release_cached_resources()).TIMES(1);
+        registry.add(bench_case);
+
+        const auto reporter =
+            std::make_shared<stat_bench_test::reporter::MockReporter>();
+        // NOLINTNEXTLINE
+        ALLOW_CALL(*reporter, experiment_starts(trompeloeil::_));
+        // NOLINTNEXTLINE
+        ALLOW_CALL(*reporter, group_starts(trompeloeil::_, trompeloeil::_));
+        // NOLINTNEXTLINE
+        ALLOW_CALL(*reporter, measurement_type_starts(trompeloeil::_));
+        // NOLINTNEXTLINE
+        ALLOW_CALL(*reporter, case_starts(trompeloeil::_));
+        // NOLINTNEXTLINE
+        REQUIRE_CALL(*reporter,
+            measurement_failed(trompeloeil::_, trompeloeil::_, trompeloeil::_))
+            .THROW(std::runtime_error("Test exception in a reporter."));
+
+        Runner runner(config, registry);
+        runner.add(reporter);
+        CHECK_THROWS_AS(runner.run(), std::runtime_error);
+    }
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to fit models of asymptotic complexity.
+ */
+#include "stat_bench/stat/complexity_fit.h"
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace {
+
+/*!
+ * \brief Struct of data to fit.
+ */
+struct ComplexityData {
+    //! Values of the parameter.
+    std::vector<double> sizes;
+
+    //! Mean times.
+    std::vector<double> times;
+
+    //! Standard errors of times.
+    std::vector<double> errors;
+};
+
+/*!
+ * \brief Generate data with small deterministic noise.
+ *
+ * \param[in] function Function of the parameter to generate times.
+ * \return Data.
+ */
+[[nodiscard]] auto generate_data(const std::function<double(double)>& function)
+    -> ComplexityData {
+    constexpr double relative_error = 0.01;
+    ComplexityData data;
+    for (double size = 16.0; size <= 65536.0; size *= 2.0) {  // NOLINT
+        const double sign = (data.sizes.size() % 2 == 0) ? 1.0 : -1.0;
+        const double time = function(size);
+        data.sizes.push_back(size);
+        data.times.push_back(time * (1.0 + 0.5 * relative_error * sign));
+        data.errors.push_back(time * relative_error);
+    }
+    return data;
+}
+
+}  // namespace
+
+TEST_CASE("stat_bench::stat::to_string(ComplexityModel)") {
+    using stat_bench::stat::ComplexityModel;
+    using stat_bench::stat::to_string;
+
+    CHECK(to_string(ComplexityModel::constant) == "O(1)");
+    CHECK(to_string(ComplexityModel::logarithmic) == "O(log n)");
+    CHECK(to_string(ComplexityModel::linear) == "O(n)");
+    CHECK(to_string(ComplexityModel::linearithmic) == "O(n log n)");
+    CHECK(to_string(ComplexityModel::quadratic) == "O(n^2)");
+    CHECK(to_string(ComplexityModel::power) == "O(n^k)");
+}
+
+TEST_CASE("stat_bench::stat::format_complexity") {
+    using stat_bench::stat::ComplexityFitResult;
+    using stat_bench::stat::ComplexityModel;
+    using stat_bench::stat::format_complexity;
+
+    SECTION("fixed model") {
+        ComplexityFitResult result;
+        result.model = ComplexityModel::linearithmic;
+        CHECK(format_complexity(result) == "O(n log n)");
+    }
+
+    SECTION("power model") {
+        ComplexityFitResult result;
+        result.model = ComplexityModel::power;
+        result.exponent = 1.5234;  // NOLINT
+        CHECK(format_complexity(result) == "O(n^1.52)");
+    }
+}
+
+TEST_CASE("stat_bench::stat::fit_complexity_model") {
+    using Catch::Matchers::WithinRel;
+    using stat_bench::stat::ComplexityModel;
+    using stat_bench::stat::fit_complexity_model;
+
+    SECTION("fit a fixed model") {
+        const auto data =
+            generate_data([](double n) { return 2e-9 * n; });  // NOLINT
+
+        const auto result = fit_complexity_model(
+            ComplexityModel::linear, data.sizes, data.times, data.errors);
+
+        CHECK(result.model == ComplexityModel::linear);
+        CHECK_THAT(result.coefficient, WithinRel(2e-9, 0.01));  // NOLINT
+        CHECK(result.exponent == 1.0);
+        CHECK(result.r_squared > 0.99);  // NOLINT
+    }
+
+    SECTION("fit the power model") {
+        const auto data = generate_data(
+            [](double n) { return 3e-9 * std::pow(n, 1.5); });  // NOLINT
+
+        const auto result = fit_complexity_model(
+            ComplexityModel::power, data.sizes, data.times, data.errors);
+
+        CHECK(result.model == ComplexityModel::power);
+        CHECK_THAT(result.exponent, WithinRel(1.5, 0.01));       // NOLINT
+        CHECK_THAT(result.coefficient, WithinRel(3e-9, 0.05));  // NOLINT
+        CHECK(result.r_squared > 0.99);                          // NOLINT
+    }
+
+    SECTION("fit without standard errors") {
+        auto data =
+            generate_data([](double n) { return 2e-9 * n * n; });  // NOLINT
+        data.errors.assign(data.errors.size(), 0.0);
+
+        const auto result = fit_complexity_model(
+            ComplexityModel::quadratic, data.sizes, data.times, data.errors);
+
+        CHECK_THAT(result.coefficient, WithinRel(2e-9, 0.01));  // NOLINT
+    }
+
+    SECTION("invalid inputs") {
+        CHECK_THROWS_AS(fit_complexity_model(ComplexityModel::linear,
+                            {1.0, 2.0}, {1.0}, {1.0, 1.0}),
+            stat_bench::StatBenchException);
+        CHECK_THROWS_AS(fit_complexity_model(ComplexityModel::linear,
+                            {0.0, 2.0}, {1.0, 2.0}, {1.0, 1.0}),
+            stat_bench::StatBenchException);
+    }
+}
+
+TEST_CASE("stat_bench::stat::fit_complexity") {
+    using stat_bench::stat::ComplexityModel;
+    using stat_bench::stat::fit_complexity;
+    using stat_bench::stat::to_string;
+
+    SECTION("select models") {
+        struct TestCase {
+            ComplexityModel expected;
+            std::function<double(double)> function;
+        };
+        const std::vector<TestCase> test_cases{
+            {ComplexityModel::constant, [](double /*n*/) { return 1e-6; }},
+            {ComplexityModel::logarithmic,
+                [](double n) { return 1e-7 * std::log(n); }},
+            {ComplexityModel::linear, [](double n) { return 1e-9 * n; }},
+            {ComplexityModel::linearithmic,
+                [](double n) { return 1e-9 * n * std::log(n); }},
+            {ComplexityModel::quadratic,
+                [](double n) { return 1e-9 * n * n; }},
+            {ComplexityModel::power,
+                [](double n) { return 1e-9 * std::pow(n, 2.7); }}};  // NOLINT
+
+        for (const auto& test_case : test_cases) {
+            INFO("expected: " << to_string(test_case.expected));
+            const auto data = generate_data(test_case.function);
+
+            const auto result =
+                fit_complexity(data.sizes, data.times, data.errors);
+
+            REQUIRE(result.has_value());
+            CHECK(result->model == test_case.expected);
+        }
+    }
+
+    SECTION("skip invalid points") {
+        auto data = generate_data([](double n) { return 1e-9 * n; });  // NOLINT
+        data.sizes.front() = 0.0;
+        data.times.back() = std::nan("");
+
+        const auto result = fit_complexity(data.sizes, data.times, data.errors);
+
+        REQUIRE(result.has_value());
+        CHECK(result->model == ComplexityModel::linear);
+    }
+
+    SECTION("too few points") {
+        const auto result =
+            fit_complexity({0.0, 1.0, 2.0}, {1.0, 2.0, 3.0}, {0.1, 0.1, 0.1});
+
+        CHECK_FALSE(result.has_value());
+    }
+}
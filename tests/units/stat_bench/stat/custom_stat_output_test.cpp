@@ -21,6 +21,8 @@
 
 #include <cmath>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_tostring.hpp>
@@ -30,6 +32,7 @@
 
 #include "stat_bench/clock/duration.h"
 #include "stat_bench/custom_output_name.h"
+#include "stat_bench/stat_bench_exception.h"
 
 TEST_CASE("stat_bench::stat::CustomStatOutput") {
     using stat_bench::CustomOutputName;
@@ -94,6 +97,113 @@ TEST_CASE("stat_bench::stat::CustomStatOutput") {
                 std::vector<double>{2.0, 3.0, 6.0, 7.0}));  // NOLINT
     }
 
+    SECTION("calculate statistics using accumulators") {
+        const auto name = CustomOutputName("CustomStat");
+        constexpr std::size_t threads = 2;
+        constexpr std::size_t samples = 3;
+        constexpr std::size_t warming_up_samples = 1;
+        constexpr std::size_t iterations = 2;
+
+        stat_bench::stat::CustomStatOutput output{name, threads, samples,
+            warming_up_samples, iterations,
+            stat_bench::stat::CustomOutputAnalysisType::mean};
+        const auto accumulator0 = output.accumulator(0);
+        const auto accumulator1 = output.accumulator(1);
+        accumulator0.add(0, 1.0);  // NOLINT
+        accumulator0.add(1, 1.0);  // NOLINT
+        accumulator0.add(1, 3.0);  // NOLINT
+        accumulator0.add(2, 3.0);  // NOLINT
+        accumulator0.add(2, 3.0);  // NOLINT
+        accumulator1.add(0, 5.0);  // NOLINT
+        accumulator1.add(1, 5.0);  // NOLINT
+        accumulator1.add(1, 5.0);  // NOLINT
+        accumulator1.add(2, 7.0);  // NOLINT
+        // Values added using add function are also used.
+        output.add(1, 2, 7.0);  // NOLINT
+
+        std::vector<std::vector<stat_bench::clock::Duration>> durations{
+            {stat_bench::clock::Duration(2.0),
+                stat_bench::clock::Duration(1.0)}};
+        output.preprocess(durations);
+        REQUIRE_THAT(output.data().at(0),
+            Catch::Matchers::Approx(std::vector<double>{2.0, 3.0}));  // NOLINT
+        REQUIRE_THAT(output.data().at(1),
+            Catch::Matchers::Approx(std::vector<double>{5.0, 7.0}));  // NOLINT
+    }
+
+    SECTION("get accumulators in threads") {
+        const auto name = CustomOutputName("CustomStat");
+        constexpr std::size_t threads = 4;
+        constexpr std::size_t samples = 2;
+        constexpr std::size_t warming_up_samples = 0;
+        constexpr std::size_t iterations = 1;
+
+        stat_bench::stat::CustomStatOutput output{name, threads, samples,
+            warming_up_samples, iterations,
+            stat_bench::stat::CustomOutputAnalysisType::mean};
+        std::vector<std::thread> workers;
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers.emplace_back([&output, i] {
+                const auto accumulator = output.accumulator(i);
+                accumulator.add(0, static_cast<double>(i));
+                accumulator.add(1, 1.0);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        std::vector<std::vector<stat_bench::clock::Duration>> durations(
+            threads,
+            std::vector<stat_bench::clock::Duration>(
+                samples, stat_bench::clock::Duration(1.0)));
+        output.preprocess(durations);
+        for (std::size_t i = 0; i < threads; ++i) {
+            REQUIRE_THAT(output.data().at(i),
+                Catch::Matchers::Approx(
+                    std::vector<double>{static_cast<double>(i), 1.0}));
+        }
+    }
+
+    SECTION("divide values in samples") {
+        const auto name = CustomOutputName("CustomStat");
+        constexpr std::size_t threads = 1;
+        constexpr std::size_t samples = 3;
+        constexpr std::size_t warming_up_samples = 1;
+        constexpr std::size_t iterations = 2;
+
+        stat_bench::stat::CustomStatOutput output{name, threads, samples,
+            warming_up_samples, iterations,
+            stat_bench::stat::CustomOutputAnalysisType::mean};
+        output.accumulator(0).add(1, 4.0);  // NOLINT
+        output.add(0, 2, 12.0);             // NOLINT
+
+        CHECK_THROWS_AS(output.divide_samples({1.0}),
+            stat_bench::StatBenchException);
+        output.divide_samples({1.0, 2.0});  // NOLINT
+
+        std::vector<std::vector<stat_bench::clock::Duration>> durations{
+            {stat_bench::clock::Duration(2.0),
+                stat_bench::clock::Duration(1.0)}};
+        output.preprocess(durations);
+        REQUIRE_THAT(output.data().at(0),
+            Catch::Matchers::Approx(std::vector<double>{2.0, 3.0}));  // NOLINT
+    }
+
+    SECTION("get accumulators of invalid threads") {
+        const auto name = CustomOutputName("CustomStat");
+        constexpr std::size_t threads = 2;
+        constexpr std::size_t samples = 3;
+        constexpr std::size_t warming_up_samples = 1;
+        constexpr std::size_t iterations = 2;
+
+        const stat_bench::stat::CustomStatOutput output{name, threads, samples,
+            warming_up_samples, iterations,
+            stat_bench::stat::CustomOutputAnalysisType::mean};
+        CHECK_THROWS_AS((void)output.accumulator(threads),
+            stat_bench::StatBenchException);
+    }
+
     SECTION("calculate statistics using rate per seconds") {
         const auto name = CustomOutputName("CustomStat");
         constexpr std::size_t threads = 1;
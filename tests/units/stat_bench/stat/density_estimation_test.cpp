@@ -0,0 +1,199 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to estimate probability density.
+ */
+#include "stat_bench/stat/density_estimation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+/*!
+ * \brief Integrate a function given at points using the trapezoidal rule.
+ *
+ * \param[in] points Points.
+ * \param[in] values Values at the points.
+ * \return Integral.
+ */
+[[nodiscard]] auto integrate(const std::vector<double>& points,
+    const std::vector<double>& values) -> double {
+    double integral = 0.0;
+    for (std::size_t i = 1; i < points.size(); ++i) {
+        integral +=
+            0.5 * (values[i] + values[i - 1]) * (points[i] - points[i - 1]);
+    }
+    return integral;
+}
+
+/*!
+ * \brief Generate sorted samples from the standard normal distribution.
+ *
+ * \param[in] num_samples Number of samples.
+ * \return Samples.
+ */
+[[nodiscard]] auto generate_normal_samples(std::size_t num_samples)
+    -> std::vector<double> {
+    std::mt19937 engine;  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::normal_distribution<double> distribution;
+    std::vector<double> samples;
+    samples.reserve(num_samples);
+    for (std::size_t i = 0; i < num_samples; ++i) {
+        samples.push_back(distribution(engine));
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples;
+}
+
+}  // namespace
+
+TEST_CASE("stat_bench::stat::calc_silverman_bandwidth") {
+    using stat_bench::stat::calc_silverman_bandwidth;
+
+    SECTION("calculate bandwidth for normal distribution") {
+        constexpr std::size_t num_samples = 10000;
+        const auto samples = generate_normal_samples(num_samples);
+
+        const double bandwidth = calc_silverman_bandwidth(samples);
+
+        // 0.9 * 1.0 * 10000^(-1/5)
+        constexpr double expected = 0.142;
+        constexpr double tolerance = 0.01;
+        CHECK_THAT(bandwidth, Catch::Matchers::WithinAbs(expected, tolerance));
+    }
+
+    SECTION("return zero for constant values") {
+        const std::vector<double> samples{1.0, 1.0, 1.0};
+
+        CHECK(calc_silverman_bandwidth(samples) == 0.0);
+    }
+}
+
+TEST_CASE("stat_bench::stat::estimate_density") {
+    using stat_bench::stat::estimate_density;
+
+    SECTION("estimate density of normal distribution") {
+        constexpr std::size_t num_samples = 10000;
+        const auto samples = generate_normal_samples(num_samples);
+        constexpr std::size_t num_points = 256;
+
+        const auto curve = estimate_density(samples, num_points, false);
+
+        REQUIRE(curve.points.size() == num_points);
+        REQUIRE(curve.densities.size() == num_points);
+        CHECK(std::is_sorted(curve.points.begin(), curve.points.end()));
+        CHECK_THAT(integrate(curve.points, curve.densities),
+            Catch::Matchers::WithinAbs(1.0, 0.01));
+        const auto peak = static_cast<std::size_t>(
+            std::max_element(curve.densities.begin(), curve.densities.end()) -
+            curve.densities.begin());
+        CHECK_THAT(curve.points[peak], Catch::Matchers::WithinAbs(0.0, 0.2));
+        // 1 / sqrt(2 pi)
+        constexpr double expected_peak = 0.399;
+        CHECK_THAT(curve.densities[peak],
+            Catch::Matchers::WithinAbs(expected_peak, 0.02));
+    }
+
+    SECTION("estimate density in the log scale") {
+        constexpr std::size_t num_samples = 1000;
+        auto samples = generate_normal_samples(num_samples);
+        for (auto& sample : samples) {
+            sample = std::pow(10.0, sample);  // NOLINT
+        }
+        constexpr std::size_t num_points = 128;
+
+        const auto curve = estimate_density(samples, num_points, true);
+
+        REQUIRE(curve.points.size() == num_points);
+        std::vector<double> log_points;
+        for (const double point : curve.points) {
+            log_points.push_back(std::log10(point));
+        }
+        CHECK_THAT(integrate(log_points, curve.densities),
+            Catch::Matchers::WithinAbs(1.0, 0.01));
+    }
+
+    SECTION("ignore non-positive values in the log scale") {
+        const std::vector<double> samples{0.0, 1.0, 2.0, 3.0};
+
+        const auto curve = estimate_density(samples, 16, true);
+
+        REQUIRE(curve.points.size() == 16);
+        CHECK(curve.points.front() > 0.0);
+    }
+
+    SECTION("estimate density of constant values") {
+        const std::vector<double> samples{2.0, 2.0, 2.0};
+
+        const auto curve = estimate_density(samples, 16, false);
+
+        REQUIRE(curve.points.size() == 16);
+        CHECK(curve.points.front() < 2.0);
+        CHECK(curve.points.back() > 2.0);
+    }
+
+    SECTION("return an empty curve for no values") {
+        const auto curve = estimate_density({}, 16, false);
+
+        CHECK(curve.points.empty());
+        CHECK(curve.densities.empty());
+    }
+}
+
+TEST_CASE("stat_bench::stat::calc_histogram") {
+    using stat_bench::stat::calc_histogram;
+
+    SECTION("calculate a histogram") {
+        const std::vector<double> samples{0.0, 0.5, 1.5, 2.5, 3.0};
+
+        const auto histogram = calc_histogram(samples, 3, false);
+
+        REQUIRE(histogram.edges.size() == 4);
+        CHECK_THAT(histogram.edges[0], Catch::Matchers::WithinAbs(0.0, 1e-10));
+        CHECK_THAT(histogram.edges[3], Catch::Matchers::WithinAbs(3.0, 1e-10));
+        REQUIRE(histogram.densities.size() == 3);
+        CHECK_THAT(histogram.densities[0], Catch::Matchers::WithinRel(0.4));
+        CHECK_THAT(histogram.densities[1], Catch::Matchers::WithinRel(0.2));
+        CHECK_THAT(histogram.densities[2], Catch::Matchers::WithinRel(0.4));
+    }
+
+    SECTION("calculate a histogram with log-spaced bins") {
+        const std::vector<double> samples{1.0, 5.0, 10.0, 100.0};
+
+        const auto histogram = calc_histogram(samples, 2, true);
+
+        REQUIRE(histogram.edges.size() == 3);
+        CHECK_THAT(histogram.edges[1], Catch::Matchers::WithinRel(10.0));
+        REQUIRE(histogram.densities.size() == 2);
+        CHECK_THAT(histogram.densities[0], Catch::Matchers::WithinRel(0.5));
+        CHECK_THAT(histogram.densities[1], Catch::Matchers::WithinRel(0.5));
+    }
+
+    SECTION("return an empty histogram for no values") {
+        const auto histogram = calc_histogram({}, 3, false);
+
+        CHECK(histogram.edges.empty());
+        CHECK(histogram.densities.empty());
+    }
+}
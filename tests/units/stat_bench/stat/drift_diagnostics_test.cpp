@@ -0,0 +1,162 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to diagnose drifts of samples.
+ */
+#include "stat_bench/stat/drift_diagnostics.h"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "stat_bench/clock/duration.h"
+#include "stat_bench/stat/calc_stat.h"
+#include "stat_bench/stat_bench_exception.h"
+
+namespace {
+
+auto to_durations(const std::vector<double>& values)
+    -> std::vector<std::vector<stat_bench::clock::Duration>> {
+    std::vector<std::vector<stat_bench::clock::Duration>> durations(1);
+    for (const double value : values) {
+        durations.front().emplace_back(value);
+    }
+    return durations;
+}
+
+}  // namespace
+
+TEST_CASE("stat_bench::stat::diagnose_drift") {
+    using Catch::Matchers::WithinRel;
+    using stat_bench::stat::diagnose_drift;
+
+    SECTION("detect an increasing trend") {
+        constexpr std::size_t num_values = 30;
+        std::vector<double> values;
+        for (std::size_t i = 0; i < num_values; ++i) {
+            const double noise = (i % 2 == 0) ? 0.0 : 0.005;  // NOLINT
+            values.push_back(1.0 + 0.01 * static_cast<double>(i) +  // NOLINT
+                noise);
+        }
+
+        const auto result = diagnose_drift(to_durations(values));
+
+        CHECK(result.drifting);
+        CHECK_THAT(result.mann_kendall_z, WithinRel(7.743007, 1e-4));
+        CHECK(result.mann_kendall_p_value < 1e-10);  // NOLINT
+        CHECK_THAT(result.lag1_autocorrelation, WithinRel(0.8953475, 1e-4));
+        CHECK_THAT(result.effective_sample_size, WithinRel(1.656463, 1e-4));
+    }
+
+    SECTION("keep the sample size for negative autocorrelation") {
+        std::vector<double> values;
+        constexpr std::size_t num_values = 20;
+        for (std::size_t i = 0; i < num_values; ++i) {
+            values.push_back(i % 2 == 0 ? 1.0 : 2.0);  // NOLINT
+        }
+
+        const auto result = diagnose_drift(to_durations(values));
+
+        CHECK_FALSE(result.drifting);
+        CHECK_THAT(result.lag1_autocorrelation, WithinRel(-0.95, 1e-6));
+        CHECK_THAT(result.mann_kendall_p_value, WithinRel(0.7337300, 1e-4));
+        CHECK_THAT(result.effective_sample_size, WithinRel(20.0));  // NOLINT
+    }
+
+    SECTION("reduce the effective sample size for positive autocorrelation") {
+        const std::vector<double> values{1.0, 1.0, 1.0, 1.0, 2.0, 2.0, 2.0,
+            2.0, 1.0, 1.0, 1.0, 1.0, 2.0, 2.0, 2.0, 2.0};  // NOLINT
+
+        const auto result = diagnose_drift(to_durations(values));
+
+        CHECK_FALSE(result.drifting);
+        CHECK_THAT(result.lag1_autocorrelation, WithinRel(0.5625, 1e-6));
+        CHECK_THAT(result.mann_kendall_z, WithinRel(1.627826, 1e-4));
+        CHECK_THAT(result.effective_sample_size, WithinRel(4.48, 1e-6));
+    }
+
+    SECTION("detect a decreasing trend in many samples with ties") {
+        constexpr std::size_t num_values = 200000;
+        std::vector<double> values;
+        for (std::size_t i = 0; i < num_values; ++i) {
+            values.push_back(static_cast<double>(num_values / 2 - i / 2));
+        }
+
+        const auto result = diagnose_drift(to_durations(values));
+
+        CHECK(result.drifting);
+        CHECK_THAT(result.mann_kendall_z, WithinRel(-670.8112, 1e-6));
+    }
+
+    SECTION("count durations in all threads") {
+        auto durations = to_durations({1.0, 2.0, 3.0});  // NOLINT
+        durations.push_back(durations.front());
+
+        const auto result = diagnose_drift(durations);
+
+        CHECK_THAT(result.effective_sample_size, WithinRel(6.0));  // NOLINT
+    }
+
+    SECTION("skip tests for too few samples") {
+        const auto result = diagnose_drift(to_durations({1.0, 2.0}));
+
+        CHECK_FALSE(result.drifting);
+        CHECK(result.lag1_autocorrelation == 0.0);  // NOLINT
+        CHECK(result.mann_kendall_p_value == 1.0);  // NOLINT
+        CHECK_THAT(result.effective_sample_size, WithinRel(2.0));
+    }
+
+    SECTION("throw for no sample") {
+        CHECK_THROWS_AS(diagnose_drift(to_durations({})),
+            stat_bench::StatBenchException);
+    }
+}
+
+TEST_CASE("stat_bench::stat::adjust_standard_error") {
+    using Catch::Matchers::WithinRel;
+    using stat_bench::stat::adjust_standard_error;
+    using stat_bench::stat::calc_stat;
+    using stat_bench::stat::DriftDiagnostics;
+
+    const auto stat =
+        calc_stat(std::vector<std::vector<double>>{{1.0, 2.0, 3.0, 4.0}});
+
+    SECTION("scale the standard error") {
+        DriftDiagnostics diagnostics;
+        diagnostics.effective_sample_size = 1.0;
+
+        const auto result = adjust_standard_error(stat, diagnostics);
+
+        CHECK_THAT(
+            result.standard_error(), WithinRel(2.0 * stat.standard_error()));
+        CHECK_THAT(result.mean(), WithinRel(stat.mean()));
+        CHECK_THAT(result.variance(), WithinRel(stat.variance()));
+        CHECK(result.unsorted_samples() == stat.unsorted_samples());
+    }
+
+    SECTION("keep the standard error for independent samples") {
+        DriftDiagnostics diagnostics;
+        diagnostics.effective_sample_size = 4.0;  // NOLINT
+
+        const auto result = adjust_standard_error(stat, diagnostics);
+
+        CHECK_THAT(result.standard_error(), WithinRel(stat.standard_error()));
+    }
+}
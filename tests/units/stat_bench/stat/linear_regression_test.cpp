@@ -0,0 +1,185 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions of linear regression.
+ */
+#include "stat_bench/stat/linear_regression.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+TEST_CASE("stat_bench::stat::fit_ordinary_least_squares") {
+    using Catch::Matchers::WithinAbs;
+    using Catch::Matchers::WithinRel;
+    using stat_bench::stat::fit_ordinary_least_squares;
+
+    SECTION("fit data on a line") {
+        const std::vector<double> x{1.0, 2.0, 3.0, 4.0, 5.0};
+        std::vector<double> y;
+        for (const double val : x) {
+            y.push_back(2.0 * val + 0.5);  // NOLINT
+        }
+
+        const auto result = fit_ordinary_least_squares(x, y);
+
+        CHECK_THAT(result.slope, WithinRel(2.0));
+        CHECK_THAT(result.intercept, WithinRel(0.5));
+        CHECK_THAT(result.slope_lower, WithinRel(2.0));
+        CHECK_THAT(result.slope_upper, WithinRel(2.0));
+        CHECK_THAT(result.r_squared, WithinAbs(1.0, 1e-10));  // NOLINT
+    }
+
+    SECTION("fit data with errors") {
+        const std::vector<double> x{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+        const std::vector<double> y{
+            3.1, 4.9, 7.2, 8.8, 11.1, 12.9};  // NOLINT
+
+        const auto result = fit_ordinary_least_squares(x, y);
+
+        // Bounds are calculated with the exact quantile of t-distribution.
+        CHECK_THAT(result.slope, WithinRel(1.977143, 1e-6));      // NOLINT
+        CHECK_THAT(result.intercept, WithinRel(1.08, 1e-6));      // NOLINT
+        CHECK_THAT(result.slope_lower, WithinRel(1.866653, 1e-3));  // NOLINT
+        CHECK_THAT(result.slope_upper, WithinRel(2.087633, 1e-3));  // NOLINT
+        CHECK(result.r_squared > 0.99);                            // NOLINT
+        CHECK(result.r_squared < 1.0);
+    }
+
+    SECTION("fit data with one degree of freedom") {
+        const std::vector<double> x{1.0, 2.0, 3.0};
+        const std::vector<double> y{1.0, 3.0, 2.5};
+
+        const auto result = fit_ordinary_least_squares(x, y);
+
+        // The quantile of t-distribution is 12.706.
+        CHECK_THAT(result.slope, WithinRel(0.75, 1e-6));            // NOLINT
+        CHECK_THAT(result.slope_lower, WithinRel(-8.419913, 1e-6));  // NOLINT
+        CHECK_THAT(result.slope_upper, WithinRel(9.919913, 1e-6));   // NOLINT
+    }
+
+    SECTION("invalid inputs") {
+        CHECK_THROWS_AS(fit_ordinary_least_squares({1.0, 2.0}, {1.0}),
+            stat_bench::StatBenchException);
+        CHECK_THROWS_AS(fit_ordinary_least_squares({1.0}, {1.0}),
+            stat_bench::StatBenchException);
+        CHECK_THROWS_AS(fit_ordinary_least_squares({1.0, 1.0}, {1.0, 2.0}),
+            stat_bench::StatBenchException);
+    }
+}
+
+TEST_CASE("stat_bench::stat::fit_theil_sen") {
+    using Catch::Matchers::WithinAbs;
+    using Catch::Matchers::WithinRel;
+    using stat_bench::stat::fit_theil_sen;
+
+    SECTION("fit data on a line") {
+        const std::vector<double> x{1.0, 2.0, 3.0, 4.0, 5.0};
+        std::vector<double> y;
+        for (const double val : x) {
+            y.push_back(2.0 * val + 0.5);  // NOLINT
+        }
+
+        const auto result = fit_theil_sen(x, y);
+
+        CHECK_THAT(result.slope, WithinRel(2.0));
+        CHECK_THAT(result.intercept, WithinRel(0.5));
+        CHECK_THAT(result.slope_lower, WithinRel(2.0));
+        CHECK_THAT(result.slope_upper, WithinRel(2.0));
+        CHECK_THAT(result.r_squared, WithinAbs(1.0, 1e-10));  // NOLINT
+    }
+
+    SECTION("fit data with an outlier") {
+        std::vector<double> x;
+        std::vector<double> y;
+        constexpr std::size_t num_points = 10;
+        for (std::size_t i = 0; i < num_points; ++i) {
+            x.push_back(static_cast<double>(i + 1));
+            y.push_back(3.0 * x.back() + 1.0);  // NOLINT
+        }
+        y.back() = 1000.0;  // NOLINT
+
+        const auto result = fit_theil_sen(x, y);
+
+        CHECK_THAT(result.slope, WithinRel(3.0));
+        CHECK_THAT(result.intercept, WithinRel(1.0));
+        CHECK(result.slope_lower <= result.slope);
+        CHECK(result.slope_upper >= result.slope);
+        CHECK(stat_bench::stat::fit_ordinary_least_squares(x, y).slope >
+            10.0);  // NOLINT
+    }
+
+    SECTION("calculate the confidence interval") {
+        const std::vector<double> x{
+            1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0};  // NOLINT
+        const std::vector<double> y{
+            1.3, 1.9, 3.4, 3.7, 5.3, 5.8, 7.4, 7.9, 9.2, 10.4};  // NOLINT
+
+        const auto result = fit_theil_sen(x, y);
+
+        // Bounds are the 11th and 35th of 45 slopes in ascending order.
+        CHECK_THAT(result.slope_lower, WithinRel(0.9, 1e-6));        // NOLINT
+        CHECK_THAT(result.slope_upper, WithinRel(1.116667, 1e-6));  // NOLINT
+    }
+
+    SECTION("fit many points using sampled pairs") {
+        // About 5e9 pairs exist, so pairs are sampled.
+        constexpr std::size_t num_points = 100000;
+        std::vector<double> x;
+        std::vector<double> y;
+        x.reserve(num_points);
+        y.reserve(num_points);
+        for (std::size_t i = 0; i < num_points; ++i) {
+            x.push_back(static_cast<double>(i + 1));
+            const double noise = (i % 2 == 0) ? 0.5 : -0.5;  // NOLINT
+            y.push_back(2.0 * x.back() + 1.0 + noise);       // NOLINT
+        }
+
+        const auto result = fit_theil_sen(x, y);
+
+        CHECK_THAT(result.slope, WithinRel(2.0, 1e-6));      // NOLINT
+        CHECK_THAT(result.intercept, WithinAbs(1.0, 0.6));  // NOLINT
+        CHECK(result.slope_lower <= 2.0);
+        CHECK(result.slope_upper >= 2.0);
+        CHECK_THAT(result.slope_lower, WithinRel(2.0, 1e-4));  // NOLINT
+        CHECK_THAT(result.slope_upper, WithinRel(2.0, 1e-4));  // NOLINT
+
+        // Same pairs are sampled in every call.
+        CHECK(fit_theil_sen(x, y).slope == result.slope);
+    }
+
+    SECTION("reject many points with the same x") {
+        constexpr std::size_t num_points = 100000;
+        const std::vector<double> x(num_points, 1.0);
+        const std::vector<double> y(num_points, 2.0);
+
+        CHECK_THROWS_AS(fit_theil_sen(x, y), stat_bench::StatBenchException);
+    }
+
+    SECTION("invalid inputs") {
+        CHECK_THROWS_AS(
+            fit_theil_sen({1.0, 2.0}, {1.0}), stat_bench::StatBenchException);
+        CHECK_THROWS_AS(
+            fit_theil_sen({1.0}, {1.0}), stat_bench::StatBenchException);
+        CHECK_THROWS_AS(fit_theil_sen({1.0, 1.0}, {1.0, 2.0}),
+            stat_bench::StatBenchException);
+    }
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to fit models of scalability.
+ */
+#include "stat_bench/stat/scalability_fit.h"
+
+#include <cmath>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+TEST_CASE("stat_bench::stat::evaluate_scalability_model") {
+    using Catch::Matchers::WithinRel;
+    using stat_bench::stat::evaluate_scalability_model;
+    using stat_bench::stat::ScalabilityFitResult;
+
+    ScalabilityFitResult result;
+    result.contention = 0.1;   // NOLINT
+    result.coherency = 0.01;  // NOLINT
+
+    CHECK_THAT(evaluate_scalability_model(result, 1.0), WithinRel(1.0));
+    CHECK_THAT(evaluate_scalability_model(result, 4.0),  // NOLINT
+        WithinRel(4.0 / (1.0 + 0.3 + 0.12)));             // NOLINT
+}
+
+TEST_CASE("stat_bench::stat::calc_peak_num_threads") {
+    using Catch::Matchers::WithinRel;
+    using stat_bench::stat::calc_peak_num_threads;
+    using stat_bench::stat::ScalabilityFitResult;
+
+    ScalabilityFitResult result;
+    result.contention = 0.1;  // NOLINT
+    CHECK(std::isinf(calc_peak_num_threads(result)));
+
+    result.coherency = 0.01;  // NOLINT
+    CHECK_THAT(calc_peak_num_threads(result), WithinRel(std::sqrt(90.0)));
+}
+
+TEST_CASE("stat_bench::stat::fit_amdahl") {
+    using Catch::Matchers::WithinAbs;
+    using Catch::Matchers::WithinRel;
+    using stat_bench::stat::fit_amdahl;
+
+    SECTION("fit data following Amdahl's law") {
+        constexpr double serial_fraction = 0.2;
+        const std::vector<double> nums_threads{1.0, 2.0, 4.0, 8.0};
+        std::vector<double> speedups;
+        for (const double n : nums_threads) {
+            speedups.push_back(n / (1.0 + serial_fraction * (n - 1.0)));
+        }
+
+        const auto result = fit_amdahl(nums_threads, speedups);
+
+        CHECK_THAT(result.contention, WithinRel(serial_fraction));
+        CHECK(result.coherency == 0.0);
+        CHECK_THAT(result.r_squared, WithinAbs(1.0, 1e-10));  // NOLINT
+    }
+
+    SECTION("invalid inputs") {
+        CHECK_THROWS_AS(fit_amdahl({1.0, 2.0}, {1.0}),
+            stat_bench::StatBenchException);
+        CHECK_THROWS_AS(fit_amdahl({1.0, 2.0}, {1.0, 0.0}),
+            stat_bench::StatBenchException);
+    }
+}
+
+TEST_CASE("stat_bench::stat::fit_usl") {
+    using Catch::Matchers::WithinAbs;
+    using Catch::Matchers::WithinRel;
+    using stat_bench::stat::fit_usl;
+
+    SECTION("fit data following USL") {
+        constexpr double contention = 0.05;
+        constexpr double coherency = 0.002;
+        const std::vector<double> nums_threads{1.0, 2.0, 4.0, 8.0, 16.0, 32.0};
+        std::vector<double> speedups;
+        for (const double n : nums_threads) {
+            speedups.push_back(
+                n / (1.0 + contention * (n - 1.0) + coherency * n * (n - 1.0)));
+        }
+
+        const auto result = fit_usl(nums_threads, speedups);
+
+        CHECK_THAT(result.contention, WithinRel(contention, 1e-6));  // NOLINT
+        CHECK_THAT(result.coherency, WithinRel(coherency, 1e-6));    // NOLINT
+        CHECK_THAT(result.r_squared, WithinAbs(1.0, 1e-10));         // NOLINT
+    }
+
+    SECTION("fit superlinear speedups") {
+        const std::vector<double> nums_threads{1.0, 2.0, 4.0};
+        const std::vector<double> speedups{1.0, 2.2, 4.5};
+
+        const auto result = fit_usl(nums_threads, speedups);
+
+        CHECK(result.contention == 0.0);
+        CHECK(result.coherency == 0.0);
+    }
+
+    SECTION("fit with only two numbers of threads") {
+        const std::vector<double> nums_threads{1.0, 4.0};
+        const std::vector<double> speedups{1.0, 2.0};
+
+        const auto result = fit_usl(nums_threads, speedups);
+
+        CHECK_THAT(result.contention, WithinRel(1.0 / 3.0));  // NOLINT
+        CHECK(result.coherency == 0.0);
+    }
+}
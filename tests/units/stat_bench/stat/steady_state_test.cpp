@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to detect steady states.
+ */
+#include "stat_bench/stat/steady_state.h"
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+TEST_CASE("stat_bench::stat::detect_steady_state") {
+    using stat_bench::stat::detect_steady_state;
+
+    SECTION("detect the end of a transient") {
+        constexpr std::size_t transient = 10;
+        constexpr std::size_t num_values = 60;
+        std::vector<double> values;
+        for (std::size_t i = 0; i < num_values; ++i) {
+            // Small alternating noise around 1.0 after a slow start.
+            const double noise = (i % 2 == 0) ? 0.01 : -0.01;  // NOLINT
+            values.push_back(i < transient ? 5.0 : 1.0 + noise);  // NOLINT
+        }
+
+        const auto result = detect_steady_state(values);
+
+        REQUIRE(result.has_value());
+        CHECK(result.value() == transient);  // NOLINT
+    }
+
+    SECTION("detect a steady state from the start") {
+        const std::vector<double> values(20, 1.0);  // NOLINT
+
+        const auto result = detect_steady_state(values);
+
+        REQUIRE(result.has_value());
+        CHECK(result.value() == 0);
+    }
+
+    SECTION("reject series still changing") {
+        constexpr std::size_t num_values = 40;
+        std::vector<double> values;
+        for (std::size_t i = 0; i < num_values; ++i) {
+            values.push_back(
+                std::exp(-0.05 * static_cast<double>(i)));  // NOLINT
+        }
+
+        CHECK_FALSE(detect_steady_state(values).has_value());
+    }
+
+    SECTION("reject too short series") {
+        const std::vector<double> values(19, 1.0);  // NOLINT
+
+        CHECK_FALSE(detect_steady_state(values).has_value());
+    }
+
+    SECTION("invalid batch size") {
+        CHECK_THROWS_AS(detect_steady_state({1.0, 2.0}, 0),
+            stat_bench::StatBenchException);
+    }
+}
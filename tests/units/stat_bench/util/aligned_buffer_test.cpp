@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of AlignedBuffer class.
+ */
+#include "stat_bench/util/aligned_buffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace {
+
+auto address_of(const stat_bench::util::AlignedBuffer& buffer)
+    -> std::uintptr_t {
+    return reinterpret_cast<std::uintptr_t>(buffer.data());  // NOLINT
+}
+
+}  // namespace
+
+TEST_CASE("stat_bench::util::AlignedBuffer") {
+    using stat_bench::util::AlignedBuffer;
+    using stat_bench::util::BufferOptions;
+
+    SECTION("allocate with default options") {
+        constexpr std::size_t size = 1000;
+        const AlignedBuffer buffer{size};
+
+        CHECK(buffer.data() != nullptr);
+        CHECK(buffer.size() == size);
+        CHECK(address_of(buffer) % stat_bench::util::cache_line_size == 0U);
+    }
+
+    SECTION("allocate with alignment and offset") {
+        const std::size_t alignment = GENERATE(8U, 64U, 4096U);  // NOLINT
+        const std::size_t offset = GENERATE(0U, 4U, 24U);        // NOLINT
+        constexpr std::size_t size = 100;
+        BufferOptions options;
+        options.alignment = alignment;
+        options.offset = offset;
+        options.prefault = true;
+
+        const AlignedBuffer buffer{size, options};
+
+        CHECK(address_of(buffer) % alignment == offset % alignment);
+        const auto* array = buffer.as_array<unsigned char>();
+        for (std::size_t i = 0; i < size; ++i) {
+            REQUIRE(array[i] == 0U);  // NOLINT
+        }
+    }
+
+    SECTION("allocate with an invalid alignment") {
+        BufferOptions options;
+        options.alignment = 48;  // NOLINT
+
+        CHECK_THROWS_AS(
+            AlignedBuffer(16, options), stat_bench::StatBenchException);
+    }
+
+#if defined(__linux__)
+    SECTION("allocate with transparent huge pages") {
+        constexpr std::size_t size = 4U * 1024U * 1024U;
+        BufferOptions options;
+        options.huge_pages = stat_bench::util::HugePageMode::transparent;
+        options.offset = 64;  // NOLINT
+        options.prefault = true;
+
+        const AlignedBuffer buffer{size, options};
+
+        CHECK(buffer.size() == size);
+        CHECK(address_of(buffer) % stat_bench::util::huge_page_size == 64U);
+        buffer.as_array<char>()[size - 1U] = 'a';  // NOLINT
+    }
+#endif
+
+    SECTION("move") {
+        constexpr std::size_t size = 100;
+        AlignedBuffer buffer{size};
+        void* const data = buffer.data();
+
+        AlignedBuffer moved{std::move(buffer)};
+        CHECK(moved.data() == data);
+        CHECK(moved.size() == size);
+        CHECK(buffer.data() == nullptr);  // NOLINT
+
+        AlignedBuffer assigned;
+        assigned = std::move(moved);
+        CHECK(assigned.data() == data);
+        CHECK(assigned.size() == size);
+        CHECK(moved.data() == nullptr);  // NOLINT
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of BufferedFileWriter class.
+ */
+#include "stat_bench/util/buffered_file_writer.h"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace {
+
+[[nodiscard]] auto read_file_for_buffered_file_writer_test(
+    const std::string& file_path) -> std::string {
+    std::ifstream stream(file_path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(stream),
+        std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+TEST_CASE("stat_bench::util::BufferedFileWriter") {
+    using stat_bench::util::BufferedFileWriter;
+
+    const std::string file_path = "./BufferedFileWriterTest.txt";
+
+    SECTION("write data smaller than the buffer") {
+        BufferedFileWriter writer(file_path);
+        writer.write("abc");
+        writer.put('d');
+        writer.write(std::string("efg"));
+        writer.close();
+
+        CHECK(read_file_for_buffered_file_writer_test(file_path) == "abcdefg");
+    }
+
+    SECTION("write data larger than the buffer") {
+        constexpr std::size_t buffer_size = 4;
+        BufferedFileWriter writer(file_path, buffer_size);
+        writer.write("ab");
+        writer.write("cdefghijk");
+        writer.put('l');
+        writer.write("mno");
+        writer.put('p');
+        writer.put('q');
+        writer.close();
+
+        CHECK(read_file_for_buffered_file_writer_test(file_path) ==
+            "abcdefghijklmnopq");
+    }
+
+    SECTION("flush in destructor") {
+        {
+            BufferedFileWriter writer(file_path);
+            writer.write("test");
+        }
+
+        CHECK(read_file_for_buffered_file_writer_test(file_path) == "test");
+    }
+
+    SECTION("overwrite a file") {
+        {
+            BufferedFileWriter writer(file_path);
+            writer.write("long contents");
+        }
+        {
+            BufferedFileWriter writer(file_path);
+            writer.write("short");
+        }
+
+        CHECK(read_file_for_buffered_file_writer_test(file_path) == "short");
+    }
+
+    SECTION("write after close") {
+        BufferedFileWriter writer(file_path, 1);
+        writer.close();
+        CHECK_THROWS_AS(writer.write("abc"), stat_bench::StatBenchException);
+    }
+
+    SECTION("open a non-existing directory") {
+        CHECK_THROWS_AS(
+            BufferedFileWriter("./non_existing_directory/test.txt"),
+            stat_bench::StatBenchException);
+    }
+}
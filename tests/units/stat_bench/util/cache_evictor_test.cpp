@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of CacheEvictor class.
+ */
+#include "stat_bench/util/cache_evictor.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("stat_bench::util::default_cache_eviction_size") {
+    CHECK(stat_bench::util::default_cache_eviction_size() > 0U);
+}
+
+TEST_CASE("stat_bench::util::CacheEvictor") {
+    using stat_bench::util::CacheEvictionMethod;
+    using stat_bench::util::CacheEvictor;
+
+    SECTION("evict caches by reading a buffer") {
+        constexpr std::size_t eviction_size = 1024U * 1024U;
+        const CacheEvictor evictor({}, eviction_size);
+
+        CHECK(evictor.method() == CacheEvictionMethod::stream);
+        evictor.evict();
+    }
+
+    SECTION("evict caches by flushing buffers") {
+        constexpr std::size_t size = 1000;
+        std::vector<char> buffer(size, 'a');
+        constexpr std::size_t eviction_size = 1024U * 1024U;
+        const CacheEvictor evictor(
+            {{buffer.data(), buffer.size()}}, eviction_size);
+
+#if defined(__x86_64__) || defined(_M_X64)
+        CHECK(evictor.method() == CacheEvictionMethod::flush);
+#endif
+        evictor.evict();
+        CHECK(buffer.at(size - 1U) == 'a');
+    }
+}
+
+TEST_CASE("stat_bench::util::shared_streaming_cache_evictor") {
+    using stat_bench::util::CacheEvictionMethod;
+    using stat_bench::util::shared_streaming_cache_evictor;
+
+    const auto& evictor = shared_streaming_cache_evictor();
+
+    CHECK(evictor.method() == CacheEvictionMethod::stream);
+    CHECK(&shared_streaming_cache_evictor() == &evictor);
+    evictor.evict();
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to detect sizes of CPU caches.
+ */
+#include "stat_bench/util/cache_sizes.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+void write_cache_info(const std::filesystem::path& dir,
+    const std::string& index, const std::string& level,
+    const std::string& type, const std::string& size) {
+    const auto index_dir = dir / index;
+    std::filesystem::create_directories(index_dir);
+    std::ofstream(index_dir / "level") << level << "\n";
+    std::ofstream(index_dir / "type") << type << "\n";
+    std::ofstream(index_dir / "size") << size << "\n";
+}
+
+}  // namespace
+
+TEST_CASE("stat_bench::util::parse_cache_size") {
+    using stat_bench::util::parse_cache_size;
+
+    SECTION("parse sizes") {
+        CHECK(parse_cache_size("48K") == 48U * 1024U);
+        CHECK(parse_cache_size("2048K") == 2048U * 1024U);
+        CHECK(parse_cache_size("32M") == 32U * 1024U * 1024U);
+        CHECK(parse_cache_size("1G") == 1024U * 1024U * 1024U);
+        CHECK(parse_cache_size("512") == 512U);
+    }
+
+    SECTION("parse invalid sizes") {
+        CHECK(parse_cache_size("") == 0U);
+        CHECK(parse_cache_size("K") == 0U);
+        CHECK(parse_cache_size("12X") == 0U);
+    }
+}
+
+TEST_CASE("stat_bench::util::read_cache_sizes_from_sysfs") {
+    using stat_bench::util::read_cache_sizes_from_sysfs;
+
+    const std::filesystem::path dir = "./cache_sizes_test";
+    std::filesystem::remove_all(dir);
+
+    SECTION("read sizes") {
+        write_cache_info(dir, "index0", "1", "Data", "48K");
+        write_cache_info(dir, "index1", "1", "Instruction", "32K");
+        write_cache_info(dir, "index2", "2", "Unified", "2048K");
+        write_cache_info(dir, "index3", "3", "Unified", "105M");
+
+        const auto sizes = read_cache_sizes_from_sysfs(dir.string());
+
+        CHECK(sizes.l1d == 48U * 1024U);
+        CHECK(sizes.l2 == 2048U * 1024U);
+        CHECK(sizes.l3 == 105U * 1024U * 1024U);
+    }
+
+    SECTION("read from a directory without L3 cache") {
+        write_cache_info(dir, "index0", "1", "Instruction", "32K");
+        write_cache_info(dir, "index1", "1", "Data", "32K");
+        write_cache_info(dir, "index2", "2", "Unified", "1024K");
+
+        const auto sizes = read_cache_sizes_from_sysfs(dir.string());
+
+        CHECK(sizes.l1d == 32U * 1024U);
+        CHECK(sizes.l2 == 1024U * 1024U);
+        CHECK(sizes.l3 == 0U);
+    }
+
+    SECTION("read from a non-existing directory") {
+        const auto sizes = read_cache_sizes_from_sysfs(dir.string());
+
+        CHECK(sizes.l1d == 0U);
+        CHECK(sizes.l2 == 0U);
+        CHECK(sizes.l3 == 0U);
+    }
+}
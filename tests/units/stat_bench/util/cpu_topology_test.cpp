@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to detect the topology of CPUs.
+ */
+#include "stat_bench/util/cpu_topology.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+void write_cpu_info(const std::filesystem::path& dir, std::size_t cpu_index,
+    const std::string& package_id, const std::string& core_id) {
+    const auto topology_dir =
+        dir / ("cpu" + std::to_string(cpu_index)) / "topology";
+    std::filesystem::create_directories(topology_dir);
+    std::ofstream(topology_dir / "physical_package_id") << package_id << "\n";
+    std::ofstream(topology_dir / "core_id") << core_id << "\n";
+}
+
+}  // namespace
+
+TEST_CASE("stat_bench::util::read_cpu_topology_from_sysfs") {
+    using stat_bench::util::read_cpu_topology_from_sysfs;
+
+    const std::filesystem::path dir = "./cpu_topology_test";
+    std::filesystem::remove_all(dir);
+
+    SECTION("read topology with SMT in two sockets") {
+        // 2 sockets x 2 cores x 2 hardware threads.
+        write_cpu_info(dir, 0, "0", "0");
+        write_cpu_info(dir, 1, "0", "1");
+        write_cpu_info(dir, 2, "1", "0");
+        write_cpu_info(dir, 3, "1", "1");
+        write_cpu_info(dir, 4, "0", "0");  // NOLINT
+        write_cpu_info(dir, 5, "0", "1");  // NOLINT
+        write_cpu_info(dir, 6, "1", "0");  // NOLINT
+        write_cpu_info(dir, 7, "1", "1");  // NOLINT
+
+        const auto topology = read_cpu_topology_from_sysfs(dir.string());
+
+        CHECK(topology.logical_cpus == 8);
+        CHECK(topology.physical_cores == 4);
+        CHECK(topology.sockets == 2);
+        CHECK(topology.cores_per_socket() == 2);
+    }
+
+    SECTION("read topology with offline CPUs") {
+        write_cpu_info(dir, 0, "0", "0");
+        write_cpu_info(dir, 2, "0", "2");
+
+        const auto topology = read_cpu_topology_from_sysfs(dir.string());
+
+        CHECK(topology.logical_cpus == 2);
+        CHECK(topology.physical_cores == 2);
+        CHECK(topology.sockets == 1);
+    }
+
+    SECTION("read from a non-existing directory") {
+        const auto topology = read_cpu_topology_from_sysfs(dir.string());
+
+        CHECK(topology.logical_cpus == 0);
+        CHECK(topology.physical_cores == 0);
+        CHECK(topology.sockets == 0);
+    }
+}
+
+TEST_CASE("stat_bench::util::detect_cpu_topology") {
+    const auto& topology = stat_bench::util::detect_cpu_topology();
+
+    CHECK(topology.logical_cpus >= topology.physical_cores);
+    CHECK(topology.physical_cores >= topology.sockets);
+    CHECK(topology.sockets >= 1);
+}
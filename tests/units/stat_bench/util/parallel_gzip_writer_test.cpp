@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of ParallelGzipWriter class.
+ */
+#include "stat_bench/util/parallel_gzip_writer.h"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <zlib.h>
+
+#include "stat_bench/stat_bench_exception.h"
+
+namespace {
+
+[[nodiscard]] auto read_gzip_file_for_parallel_gzip_writer_test(
+    const std::string& file_path) -> std::vector<unsigned char> {
+    std::vector<unsigned char> data;
+    constexpr std::size_t buf_size = 1024;
+    std::array<unsigned char, buf_size> buf{};
+    gzFile file = gzopen(file_path.c_str(), "rb");
+    REQUIRE(file != nullptr);
+    while (true) {
+        const int res = gzread(file, buf.data(), buf.size());
+        REQUIRE(res >= 0);
+        if (res == 0) {
+            break;
+        }
+        data.insert(data.end(), buf.data(),
+            buf.data() + res);  // NOLINT(*-pointer-arithmetic)
+    }
+    int error_number = Z_OK;
+    (void)gzerror(file, &error_number);
+    CHECK(error_number == Z_OK);
+    (void)gzclose(file);
+    return data;
+}
+
+[[nodiscard]] auto create_data_for_parallel_gzip_writer_test(std::size_t size)
+    -> std::vector<unsigned char> {
+    std::vector<unsigned char> data;
+    data.reserve(size);
+    unsigned int state = 1;
+    for (std::size_t i = 0; i < size; ++i) {
+        // Mixture of repeated and pseudo-random data.
+        state = state * 1103515245U + 12345U;  // NOLINT
+        data.push_back(static_cast<unsigned char>(
+            (i % 3 == 0) ? (state >> 24U) : (i % 7)));  // NOLINT
+    }
+    return data;
+}
+
+}  // namespace
+
+TEST_CASE("stat_bench::util::ParallelGzipWriter") {
+    using stat_bench::util::ParallelGzipWriter;
+
+    const std::string file_path = "./ParallelGzipWriterTest.gz";
+
+    SECTION("write data") {
+        const std::size_t data_size = GENERATE(0, 1, 100, 1000, 100000);
+        const std::size_t block_size = GENERATE(1, 256, 100000);
+        const std::size_t num_threads = GENERATE(1, 4);
+        const int compression_level = GENERATE(1, 6, 9);
+        INFO("data_size = " << data_size);
+        INFO("block_size = " << block_size);
+        INFO("num_threads = " << num_threads);
+        INFO("compression_level = " << compression_level);
+        if (block_size == 1 && data_size > 1000) {
+            return;
+        }
+
+        const auto data = create_data_for_parallel_gzip_writer_test(data_size);
+        ParallelGzipWriter writer(
+            file_path, compression_level, num_threads, block_size);
+        constexpr std::size_t chunk_size = 77;
+        for (std::size_t i = 0; i < data.size(); i += chunk_size) {
+            writer.write(data.data() + i,  // NOLINT(*-pointer-arithmetic)
+                std::min(chunk_size, data.size() - i));
+        }
+        writer.close();
+
+        CHECK(read_gzip_file_for_parallel_gzip_writer_test(file_path) == data);
+    }
+
+    SECTION("close in destructor") {
+        const auto data = create_data_for_parallel_gzip_writer_test(1000);
+        {
+            ParallelGzipWriter writer(file_path);
+            writer.write(data.data(), data.size());
+        }
+
+        CHECK(read_gzip_file_for_parallel_gzip_writer_test(file_path) == data);
+    }
+
+    SECTION("write after close") {
+        ParallelGzipWriter writer(file_path);
+        writer.close();
+        const std::array<unsigned char, 1> data{1};
+        CHECK_THROWS_AS(writer.write(data.data(), data.size()),
+            stat_bench::StatBenchException);
+    }
+
+    SECTION("invalid compression level") {
+        CHECK_THROWS_AS(ParallelGzipWriter(file_path, 0),
+            stat_bench::StatBenchException);
+        CHECK_THROWS_AS(ParallelGzipWriter(file_path, 10),
+            stat_bench::StatBenchException);
+    }
+
+    SECTION("keep an existing file for invalid arguments") {
+        const auto data = create_data_for_parallel_gzip_writer_test(1000);
+        {
+            ParallelGzipWriter writer(file_path);
+            writer.write(data.data(), data.size());
+        }
+
+        CHECK_THROWS_AS(ParallelGzipWriter(file_path, 0),
+            stat_bench::StatBenchException);
+        constexpr int level = ParallelGzipWriter::default_compression_level;
+        CHECK_THROWS_AS(ParallelGzipWriter(file_path, level, 1, 0),
+            stat_bench::StatBenchException);
+
+        CHECK(read_gzip_file_for_parallel_gzip_writer_test(file_path) == data);
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of SpscQueue class.
+ */
+#include "stat_bench/util/spsc_queue.h"
+
+#include <cstddef>
+#include <thread>
+#include <utility>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+TEST_CASE("stat_bench::util::SpscQueue") {
+    using stat_bench::util::SpscQueue;
+
+    SECTION("push and pop") {
+        SpscQueue<int> queue{2};
+
+        CHECK(queue.empty());
+        CHECK(queue.try_push(1));
+        CHECK(queue.try_push(2));
+        CHECK_FALSE(queue.try_push(3));
+        CHECK_FALSE(queue.empty());
+
+        int value = 0;
+        CHECK(queue.try_pop(value));
+        CHECK(value == 1);
+        CHECK(queue.try_push(3));
+        CHECK(queue.try_pop(value));
+        CHECK(value == 2);
+        CHECK(queue.try_pop(value));
+        CHECK(value == 3);
+        CHECK_FALSE(queue.try_pop(value));
+        CHECK(queue.empty());
+    }
+
+    SECTION("push and pop in different threads") {
+        constexpr std::size_t num_values = 10000;
+        SpscQueue<std::size_t> queue{4};
+
+        std::thread producer{[&queue] {
+            for (std::size_t i = 0; i < num_values; ++i) {
+                std::size_t value = i;
+                while (!queue.try_push(std::move(value))) {
+                    std::this_thread::yield();
+                }
+            }
+        }};
+
+        bool is_ordered = true;
+        for (std::size_t i = 0; i < num_values; ++i) {
+            std::size_t value = 0;
+            while (!queue.try_pop(value)) {
+                std::this_thread::yield();
+            }
+            if (value != i) {
+                is_ordered = false;
+            }
+        }
+        producer.join();
+        CHECK(is_ordered);
+        CHECK(queue.empty());
+    }
+
+    SECTION("invalid capacity") {
+        CHECK_THROWS_AS(SpscQueue<int>(0), stat_bench::StatBenchException);
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of WorkerPool class.
+ */
+#include "stat_bench/util/worker_pool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "stat_bench/stat_bench_exception.h"
+
+TEST_CASE("stat_bench::util::WorkerPool") {
+    using stat_bench::util::WorkerPool;
+
+    SECTION("process tasks") {
+        constexpr std::size_t num_threads = 4;
+        constexpr std::size_t max_pending_tasks = 2;
+        constexpr std::size_t num_tasks = 1000;
+        WorkerPool pool{num_threads, max_pending_tasks};
+
+        std::atomic<std::size_t> sum{0};
+        for (std::size_t i = 1; i <= num_tasks; ++i) {
+            pool.submit([&sum, i] { sum.fetch_add(i); });
+        }
+        pool.wait();
+
+        CHECK(sum.load() == num_tasks * (num_tasks + 1) / 2);
+    }
+
+    SECTION("process remaining tasks in destructor") {
+        std::atomic<std::size_t> count{0};
+        {
+            WorkerPool pool{1, 4};
+            for (std::size_t i = 0; i < 4; ++i) {
+                pool.submit([&count] { count.fetch_add(1); });
+            }
+        }
+
+        CHECK(count.load() == 4);
+    }
+
+    SECTION("rethrow an exception in tasks") {
+        WorkerPool pool{2, 2};
+        pool.submit([] { throw std::runtime_error("Test exception."); });
+
+        CHECK_THROWS_AS(pool.wait(), std::runtime_error);
+        CHECK_THROWS_AS(pool.submit([] {}), std::runtime_error);
+    }
+
+    SECTION("invalid arguments") {
+        CHECK_THROWS_AS(WorkerPool(0, 1), stat_bench::StatBenchException);
+        CHECK_THROWS_AS(WorkerPool(1, 0), stat_bench::StatBenchException);
+    }
+}